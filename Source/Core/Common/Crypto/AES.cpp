@@ -0,0 +1,130 @@
+// Copyright 2013 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include "Common/CPUDetect.h"
+#include "Common/Crypto/AES.h"
+#include "Common/Intrinsics.h"
+
+#if defined(_M_X86) && !defined(_M_GENERIC)
+#define HAVE_AESNI 1
+#ifdef _MSC_VER
+#define AESNI_TARGET
+#else
+// The rest of the build does not assume AES-NI, only these functions use it
+#define AESNI_TARGET __attribute__((__target__("aes,sse2")))
+#endif
+#endif
+
+namespace Common
+{
+namespace AES
+{
+#ifdef HAVE_AESNI
+AESNI_TARGET static inline __m128i ExpandKeyStep(__m128i key, __m128i assist)
+{
+	assist = _mm_shuffle_epi32(assist, _MM_SHUFFLE(3, 3, 3, 3));
+	key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+	key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+	key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+	return _mm_xor_si128(key, assist);
+}
+
+AESNI_TARGET static void ExpandDecryptionKeyAESNI(const u8* key, u8* round_keys)
+{
+	__m128i enc[11];
+	enc[0] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(key));
+	// The round constant has to be an immediate
+	enc[1] = ExpandKeyStep(enc[0], _mm_aeskeygenassist_si128(enc[0], 0x01));
+	enc[2] = ExpandKeyStep(enc[1], _mm_aeskeygenassist_si128(enc[1], 0x02));
+	enc[3] = ExpandKeyStep(enc[2], _mm_aeskeygenassist_si128(enc[2], 0x04));
+	enc[4] = ExpandKeyStep(enc[3], _mm_aeskeygenassist_si128(enc[3], 0x08));
+	enc[5] = ExpandKeyStep(enc[4], _mm_aeskeygenassist_si128(enc[4], 0x10));
+	enc[6] = ExpandKeyStep(enc[5], _mm_aeskeygenassist_si128(enc[5], 0x20));
+	enc[7] = ExpandKeyStep(enc[6], _mm_aeskeygenassist_si128(enc[6], 0x40));
+	enc[8] = ExpandKeyStep(enc[7], _mm_aeskeygenassist_si128(enc[7], 0x80));
+	enc[9] = ExpandKeyStep(enc[8], _mm_aeskeygenassist_si128(enc[8], 0x1B));
+	enc[10] = ExpandKeyStep(enc[9], _mm_aeskeygenassist_si128(enc[9], 0x36));
+
+	// Equivalent inverse cipher: reversed order, InvMixColumns on the middle rounds
+	__m128i* dec = reinterpret_cast<__m128i*>(round_keys);
+	_mm_storeu_si128(&dec[0], enc[10]);
+	for (int i = 1; i < 10; i++)
+		_mm_storeu_si128(&dec[i], _mm_aesimc_si128(enc[10 - i]));
+	_mm_storeu_si128(&dec[10], enc[0]);
+}
+
+AESNI_TARGET static void DecryptCBCAESNI(const u8* round_keys, const u8* iv, const u8* src, u8* dst, size_t size)
+{
+	__m128i rk[11];
+	for (int i = 0; i < 11; i++)
+		rk[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(round_keys) + i);
+	const __m128i* in = reinterpret_cast<const __m128i*>(src);
+	__m128i* out = reinterpret_cast<__m128i*>(dst);
+	__m128i prev = _mm_loadu_si128(reinterpret_cast<const __m128i*>(iv));
+	size_t blocks = size / BLOCK_SIZE;
+
+	// Unlike encryption, CBC decryption has no dependency between blocks,
+	// eight of them keep the AES unit busy
+	while (blocks >= 8)
+	{
+		__m128i c[8], x[8];
+		for (int i = 0; i < 8; i++)
+		{
+			c[i] = _mm_loadu_si128(in + i);
+			x[i] = _mm_xor_si128(c[i], rk[0]);
+		}
+		for (int r = 1; r < 10; r++)
+		{
+			for (int i = 0; i < 8; i++)
+				x[i] = _mm_aesdec_si128(x[i], rk[r]);
+		}
+		for (int i = 0; i < 8; i++)
+			x[i] = _mm_aesdeclast_si128(x[i], rk[10]);
+		_mm_storeu_si128(out, _mm_xor_si128(x[0], prev));
+		for (int i = 1; i < 8; i++)
+			_mm_storeu_si128(out + i, _mm_xor_si128(x[i], c[i - 1]));
+		prev = c[7];
+		in += 8;
+		out += 8;
+		blocks -= 8;
+	}
+	for (; blocks > 0; blocks--)
+	{
+		__m128i c = _mm_loadu_si128(in);
+		__m128i x = _mm_xor_si128(c, rk[0]);
+		for (int r = 1; r < 10; r++)
+			x = _mm_aesdec_si128(x, rk[r]);
+		x = _mm_aesdeclast_si128(x, rk[10]);
+		_mm_storeu_si128(out, _mm_xor_si128(x, prev));
+		prev = c;
+		in++;
+		out++;
+	}
+}
+#endif
+
+bool HasHardwareSupport()
+{
+#ifdef HAVE_AESNI
+	return cpu_info.bAES;
+#else
+	return false;
+#endif
+}
+
+void ExpandDecryptionKey(const u8* key, u8* round_keys)
+{
+#ifdef HAVE_AESNI
+	ExpandDecryptionKeyAESNI(key, round_keys);
+#endif
+}
+
+void DecryptCBC(const u8* round_keys, const u8* iv, const u8* src, u8* dst, size_t size)
+{
+#ifdef HAVE_AESNI
+	DecryptCBCAESNI(round_keys, iv, src, dst, size);
+#endif
+}
+}
+}
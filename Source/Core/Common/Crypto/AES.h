@@ -0,0 +1,33 @@
+// Copyright 2013 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <cstddef>
+
+#include "Common/CommonTypes.h"
+
+// Hardware accelerated AES-128 for the hot paths (Wii disc decryption).
+// Callers keep a software fallback for CPUs without the AES instructions.
+namespace Common
+{
+namespace AES
+{
+enum
+{
+	BLOCK_SIZE = 16,
+	ROUND_KEYS_SIZE = 11 * BLOCK_SIZE,
+};
+
+// True if the functions below can be used on this CPU
+bool HasHardwareSupport();
+
+// Expands a 128-bit key into the round keys DecryptCBC expects
+void ExpandDecryptionKey(const u8* key, u8* round_keys);
+
+// Decrypts size bytes (a multiple of BLOCK_SIZE) of AES-128-CBC.
+// Several blocks are decrypted at once, src and dst may be the same buffer.
+void DecryptCBC(const u8* round_keys, const u8* iv, const u8* src, u8* dst, size_t size);
+}
+}
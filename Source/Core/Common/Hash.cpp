@@ -576,31 +576,214 @@ u64 GetHashHiresTexture(const u8* src, u32 len, u32 samples)
 }
 #endif
 
-u64 GetHash64(const u8* src, u32 len, u32 samples)
+//-----------------------------------------------------------------------------
+// Stripe hash, built like XXH3: eight 64-bit lanes multiply-accumulate 64-byte
+// stripes that are XORed with a sliding key and get scrambled every 16 stripes.
+// The lanes are independent so the SIMD variants keep several multiplies in
+// flight, and all variants return the same values.
+
+#if defined(_M_X86) && !defined(_M_GENERIC)
+#define HAVE_STRIPE_HASH_SIMD 1
+#endif
+
+static const u32 STRIPE_SIZE = 64;
+static const u32 STRIPES_PER_SCRAMBLE = 16;
+static const u64 STRIPE_PRIME32_1 = 0x9E3779B1;
+static const u64 STRIPE_PRIME64_1 = 0x9E3779B185EBCA87;
+
+// 8 lanes for every stripe offset, the scramble key is the last 8
+alignas(32) static const u64 s_stripe_key[STRIPES_PER_SCRAMBLE + 8] = {
+	0x76fba653e3d3bb32, 0x15930763be7bc931, 0xbf9a35fd7ff5cd68, 0xb3a97e39d89696d5,
+	0x1d0b18948e99c2eb, 0x894e2b5616ad2f4a, 0x27eba9feb6cc669b, 0x69a36f60687a80b3,
+	0x59ea14252dedcdc2, 0xe91a20cf7cb549bb, 0x1a6746d51f51029f, 0x9ae4da91d763b4ad,
+	0x61ccf5f446ab9603, 0xbef89a29e01b52fb, 0x35c3460a9632e78d, 0x7447cbbe1ef5e246,
+	0x3e10b54852a84355, 0xac8d1adc1f33b2a2, 0x6ee28e0a915b60c3, 0x70bfed5fcef8c863,
+	0xbe6c90ca82dea41a, 0x817c0a7c356a7c5a, 0x752d15cdf6df62c8, 0xde22ed642d6fddc9,
+};
+static const u64* const s_scramble_key = s_stripe_key + STRIPES_PER_SCRAMBLE;
+
+static inline void AccumulateStripe(u64* acc, const u8* stripe, const u64* key)
 {
-	return ptrHashFunction(src, len, samples);
+	for (int i = 0; i < 8; i++)
+	{
+		u64 data;
+		memcpy(&data, stripe + i * sizeof(u64), sizeof(u64));
+		const u64 data_key = data ^ key[i];
+		acc[i ^ 1] += data;
+		acc[i] += (data_key & 0xFFFFFFFF) * (data_key >> 32);
+	}
 }
 
-// sets the hash function used for the texture cache
-void SetHash64Function()
+static inline void ScrambleStripes(u64* acc)
 {
-#if _M_SSE >= 0x402
-	if (cpu_info.bSSE4_2) // sse crc32 version
+	for (int i = 0; i < 8; i++)
 	{
-		ptrHashFunction = &GetCRC32;
+		acc[i] ^= acc[i] >> 47;
+		acc[i] ^= s_scramble_key[i];
+		acc[i] *= STRIPE_PRIME32_1;
 	}
-	else
-#elif defined(_M_ARM_64)
-	if (cpu_info.bCRC32)
+}
+
+// Accumulates count stripes that are stride bytes apart
+static void HashStripesGeneric(u64* acc, const u8* data, size_t stride, u32 count)
+{
+	for (u32 i = 0; i < count; i++)
 	{
-		ptrHashFunction = &GetCRC32;
+		AccumulateStripe(acc, data + i * stride, s_stripe_key + (i % STRIPES_PER_SCRAMBLE));
+		if (i % STRIPES_PER_SCRAMBLE == STRIPES_PER_SCRAMBLE - 1)
+			ScrambleStripes(acc);
 	}
-	else
-#endif
+}
+
+#ifdef HAVE_STRIPE_HASH_SIMD
+static void HashStripesSSE2(u64* acc, const u8* data, size_t stride, u32 count)
+{
+	__m128i a[4];
+	for (int j = 0; j < 4; j++)
+		a[j] = _mm_loadu_si128((const __m128i*)acc + j);
+	const __m128i prime = _mm_set1_epi32((u32)STRIPE_PRIME32_1);
+	for (u32 i = 0; i < count; i++)
+	{
+		const __m128i* stripe = (const __m128i*)(data + i * stride);
+		const __m128i* key = (const __m128i*)(s_stripe_key + (i % STRIPES_PER_SCRAMBLE));
+		for (int j = 0; j < 4; j++)
+		{
+			const __m128i d = _mm_loadu_si128(stripe + j);
+			const __m128i dk = _mm_xor_si128(d, _mm_loadu_si128(key + j));
+			a[j] = _mm_add_epi64(a[j], _mm_shuffle_epi32(d, _MM_SHUFFLE(1, 0, 3, 2)));
+			a[j] = _mm_add_epi64(a[j], _mm_mul_epu32(dk, _mm_srli_epi64(dk, 32)));
+		}
+		if (i % STRIPES_PER_SCRAMBLE == STRIPES_PER_SCRAMBLE - 1)
+		{
+			for (int j = 0; j < 4; j++)
+			{
+				__m128i x = _mm_xor_si128(a[j], _mm_srli_epi64(a[j], 47));
+				x = _mm_xor_si128(x, _mm_load_si128((const __m128i*)s_scramble_key + j));
+				a[j] = _mm_add_epi64(_mm_mul_epu32(x, prime),
+					_mm_slli_epi64(_mm_mul_epu32(_mm_srli_epi64(x, 32), prime), 32));
+			}
+		}
+	}
+	for (int j = 0; j < 4; j++)
+		_mm_storeu_si128((__m128i*)acc + j, a[j]);
+}
+
+AVX2_TARGET static void HashStripesAVX2(u64* acc, const u8* data, size_t stride, u32 count)
+{
+	__m256i a[2];
+	for (int j = 0; j < 2; j++)
+		a[j] = _mm256_loadu_si256((const __m256i*)acc + j);
+	const __m256i prime = _mm256_set1_epi32((u32)STRIPE_PRIME32_1);
+	for (u32 i = 0; i < count; i++)
 	{
-		ptrHashFunction = &GetMurmurHash3;
+		const __m256i* stripe = (const __m256i*)(data + i * stride);
+		const __m256i* key = (const __m256i*)(s_stripe_key + (i % STRIPES_PER_SCRAMBLE));
+		for (int j = 0; j < 2; j++)
+		{
+			const __m256i d = _mm256_loadu_si256(stripe + j);
+			const __m256i dk = _mm256_xor_si256(d, _mm256_loadu_si256(key + j));
+			a[j] = _mm256_add_epi64(a[j], _mm256_shuffle_epi32(d, _MM_SHUFFLE(1, 0, 3, 2)));
+			a[j] = _mm256_add_epi64(a[j], _mm256_mul_epu32(dk, _mm256_srli_epi64(dk, 32)));
+		}
+		if (i % STRIPES_PER_SCRAMBLE == STRIPES_PER_SCRAMBLE - 1)
+		{
+			for (int j = 0; j < 2; j++)
+			{
+				__m256i x = _mm256_xor_si256(a[j], _mm256_srli_epi64(a[j], 47));
+				x = _mm256_xor_si256(x, _mm256_load_si256((const __m256i*)s_scramble_key + j));
+				a[j] = _mm256_add_epi64(_mm256_mul_epu32(x, prime),
+					_mm256_slli_epi64(_mm256_mul_epu32(_mm256_srli_epi64(x, 32), prime), 32));
+			}
+		}
 	}
+	for (int j = 0; j < 2; j++)
+		_mm256_storeu_si256((__m256i*)acc + j, a[j]);
+}
+#endif
+
+// Folds the 128-bit product of a and b into 64 bits
+static inline u64 Mul128Fold64(u64 a, u64 b)
+{
+#if defined(_MSC_VER) && defined(_M_X86_64)
+	u64 hi;
+	const u64 lo = _umul128(a, b, &hi);
+	return lo ^ hi;
+#elif defined(__SIZEOF_INT128__)
+	const unsigned __int128 product = (unsigned __int128)a * b;
+	return (u64)product ^ (u64)(product >> 64);
+#else
+	const u64 lo_lo = (a & 0xFFFFFFFF) * (b & 0xFFFFFFFF);
+	const u64 hi_lo = (a >> 32) * (b & 0xFFFFFFFF);
+	const u64 lo_hi = (a & 0xFFFFFFFF) * (b >> 32);
+	const u64 hi_hi = (a >> 32) * (b >> 32);
+	const u64 cross = (lo_lo >> 32) + (hi_lo & 0xFFFFFFFF) + lo_hi;
+	return ((cross << 32) | (lo_lo & 0xFFFFFFFF)) ^ (hi_hi + (hi_lo >> 32) + (cross >> 32));
+#endif
 }
 
+u64 GetStripeHash64(const u8* src, u32 len, u32 samples)
+{
+	u64 acc[8] = {
+		0xC2B2AE3D, 0x9E3779B185EBCA87, 0xC2B2AE3D27D4EB4F, 0x165667B19E3779F9,
+		0x85EBCA77C2B2AE63, 0x85EBCA77, 0x27D4EB2F165667C5, 0x9E3779B1,
+	};
+	void(*hash_stripes)(u64* acc, const u8* data, size_t stride, u32 count) = &HashStripesGeneric;
+#ifdef HAVE_STRIPE_HASH_SIMD
+	if (cpu_info.bAVX2)
+		hash_stripes = &HashStripesAVX2;
+	else if (cpu_info.bSSE2)
+		hash_stripes = &HashStripesSSE2;
+#endif
 
+	// The last stripe always ends at the end of the data, the ones before it are
+	// all hashed or spread evenly over the data when sampling.
+	const u32 stripes = len > STRIPE_SIZE ? (len - 1) / STRIPE_SIZE : 0;
+	if (samples == 0 || samples >= stripes)
+	{
+		hash_stripes(acc, src, STRIPE_SIZE, stripes);
+	}
+	else
+	{
+		const u32 step = (stripes + samples - 1) / samples;
+		hash_stripes(acc, src, (size_t)step * STRIPE_SIZE, (stripes + step - 1) / step);
+	}
+
+	u8 last[STRIPE_SIZE] = {};
+	if (len >= STRIPE_SIZE)
+		memcpy(last, src + len - STRIPE_SIZE, STRIPE_SIZE);
+	else
+		memcpy(last, src, len);
+	AccumulateStripe(acc, last, s_stripe_key + 9);
+
+	u64 h = len * STRIPE_PRIME64_1;
+	for (int i = 0; i < 4; i++)
+		h += Mul128Fold64(acc[2 * i] ^ s_stripe_key[11 + 2 * i], acc[2 * i + 1] ^ s_stripe_key[12 + 2 * i]);
+	h ^= h >> 37;
+	h *= 0x165667919E3779F9;
+	h ^= h >> 32;
+	return h;
+}
 
+u64 GetHash64(const u8* src, u32 len, u32 samples)
+{
+	return ptrHashFunction(src, len, samples);
+}
+
+// sets the hash function used for the texture cache
+void SetHash64Function()
+{
+#ifdef HAVE_STRIPE_HASH_SIMD
+	// The AVX2 stripe hash outruns the CRC32 one, the SSE2 version still beats Murmur3.
+	// A sample reads a stripe where CRC32 reads 8 bytes, which costs a cache line for both.
+#if _M_SSE >= 0x402
+	if (cpu_info.bSSE4_2 && !cpu_info.bAVX2)
+		ptrHashFunction = &GetCRC32;
+	else
+#endif
+		ptrHashFunction = &GetStripeHash64;
+#elif defined(_M_ARM_64)
+	ptrHashFunction = cpu_info.bCRC32 ? &GetCRC32 : &GetMurmurHash3;
+#else
+	ptrHashFunction = &GetMurmurHash3;
+#endif
+}
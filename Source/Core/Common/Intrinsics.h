@@ -28,4 +28,12 @@
 # endif
 #endif
 
+// For functions using AVX2 that are only called after checking cpu_info.bAVX2, the rest of
+// the build does not assume it. MSVC accepts the intrinsics without it.
+#ifdef _MSC_VER
+#define AVX2_TARGET
+#else
+#define AVX2_TARGET __attribute__((__target__("avx2")))
+#endif
+
 #endif // _M_X86
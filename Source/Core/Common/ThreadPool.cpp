@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include "Common/Common.h"
 #include "Common/CPUDetect.h"
 #include "Common/ThreadPool.h"
@@ -45,6 +47,66 @@ void ThreadPool::NotifyWorkPending()
 	ThreadPool::Getinstance().m_workflag.fetch_add(2);
 }
 
+size_t ThreadPool::WorkerCount()
+{
+	return ThreadPool::Getinstance().m_workerThreads.size();
+}
+
+struct LoopState
+{
+	std::atomic<s32> next;
+	std::atomic<s32> done;
+	s32 lower;
+	s32 range;
+	s32 bands;
+};
+
+static void RunLoopBands(LoopState &state, const std::function<void(int, int)> &func)
+{
+	s32 band;
+	while ((band = state.next.fetch_add(1)) < state.bands)
+	{
+		s32 l = state.lower + (s32)((s64)state.range * band / state.bands);
+		s32 u = state.lower + (s32)((s64)state.range * (band + 1) / state.bands);
+		func(l, u);
+		state.done.fetch_add(1);
+	}
+}
+
+void ThreadPool::Loop(const std::function<void(int, int)> &func, int lower, int upper, int min_band, int max_threads)
+{
+	s32 range = upper - lower;
+	s32 threads = (s32)WorkerCount() + 1;
+	if (max_threads > 0 && max_threads < threads)
+		threads = max_threads;
+	min_band = min_band < 1 ? 1 : min_band;
+	// A couple of bands per thread to even out the load between them
+	s32 bands = std::min(threads * 2, range / min_band);
+	if (threads < 2 || bands < 2)
+	{
+		if (range > 0)
+			func(lower, upper);
+		return;
+	}
+	std::shared_ptr<LoopState> state = std::make_shared<LoopState>();
+	state->next.store(0);
+	state->done.store(0);
+	state->lower = lower;
+	state->range = range;
+	state->bands = bands;
+	// Helpers that start after the loop is over find no band left and never touch func
+	for (s32 i = 1; i < threads; i++)
+	{
+		AsyncWorker::ExecuteAsync([state, &func]()
+		{
+			RunLoopBands(*state, func);
+		});
+	}
+	RunLoopBands(*state, func);
+	while (state->done.load() < bands)
+		Common::YieldCPU();
+}
+
 static SpinLock<true> workerLock;
 void ThreadPool::RegisterWorker(IWorker* worker)
 {
@@ -149,7 +211,13 @@ void AsyncWorker::ExecuteAsync(std::function<void()> &&func)
 {
 	AsyncWorker& instance = Getinstance();
 	instance.m_inputsize.fetch_add(1);
-	instance.m_TaskQueue.push(std::move(func));
+	if (!instance.m_TaskQueue.push(std::move(func)))
+	{
+		// The queue is full, dropping the task would leave its owner waiting forever
+		instance.m_inputsize.fetch_sub(1);
+		func();
+		return;
+	}
 	ThreadPool::NotifyWorkPending();
 }
 
@@ -281,7 +281,8 @@ public:
 		if (current_head == m_tail.load(std::memory_order_acquire))
 			return false; // empty queue
 
-		item = m_container[current_head];
+		// Moved out so the slot does not keep whatever the item owns alive
+		item = std::move(m_container[current_head]);
 		m_head.store(increment(current_head), std::memory_order_release);
 		return true;
 	}
@@ -457,6 +458,12 @@ public:
 	static void NotifyWorkPending();
 	static void RegisterWorker(IWorker* worker);
 	static void UnregisterWorker(IWorker* worker);
+	static size_t WorkerCount();
+	// Splits [lower, upper) in bands of at least min_band items and runs func
+	// over them on the worker threads. The calling thread processes bands too
+	// and only returns once all of them are done.
+	// max_threads limits the number of threads taking part (0 = all of them).
+	static void Loop(const std::function<void(int, int)> &func, int lower, int upper, int min_band = 1, int max_threads = 0);
 };
 
 class AsyncWorker final: IWorker
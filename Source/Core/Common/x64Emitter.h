@@ -284,10 +284,12 @@ private:
 	void WriteSSEOp(u8 opPrefix, u16 op, X64Reg regOp, OpArg arg, int extrabytes = 0);
 	void WriteSSSE3Op(u8 opPrefix, u16 op, X64Reg regOp, const OpArg& arg, int extrabytes = 0);
 	void WriteSSE41Op(u8 opPrefix, u16 op, X64Reg regOp, const OpArg& arg, int extrabytes = 0);
-	void WriteVEXOp(u8 opPrefix, u16 op, X64Reg regOp1, X64Reg regOp2, const OpArg& arg, int W = 0, int extrabytes = 0);
+	void WriteVEXOp(u8 opPrefix, u16 op, X64Reg regOp1, X64Reg regOp2, const OpArg& arg, int W = 0, int extrabytes = 0, int L = 0);
 	void WriteVEXOp4(u8 opPrefix, u16 op, X64Reg regOp1, X64Reg regOp2, const OpArg& arg, X64Reg regOp3, int W = 0);
 	void WriteAVXOp(u8 opPrefix, u16 op, X64Reg regOp1, X64Reg regOp2, const OpArg& arg, int W = 0, int extrabytes = 0);
 	void WriteAVXOp4(u8 opPrefix, u16 op, X64Reg regOp1, X64Reg regOp2, const OpArg& arg, X64Reg regOp3, int W = 0);
+	void WriteAVXVectorOp(int bits, u8 opPrefix, u16 op, X64Reg regOp1, X64Reg regOp2, const OpArg& arg, int W = 0, int extrabytes = 0);
+	void WriteAVX2VectorOp(int bits, u8 opPrefix, u16 op, X64Reg regOp1, X64Reg regOp2, const OpArg& arg, int W = 0, int extrabytes = 0);
 	void WriteFMA3Op(u8 op, X64Reg regOp1, X64Reg regOp2, const OpArg& arg, int W = 0);
 	void WriteFMA4Op(u8 op, X64Reg dest, X64Reg regOp1, X64Reg regOp2, const OpArg& arg, int W = 0);
 	void WriteBMIOp(int size, u8 opPrefix, u16 op, X64Reg regOp1, X64Reg regOp2, const OpArg& arg, int extrabytes = 0);
@@ -792,6 +794,23 @@ public:
 	void VPOR(X64Reg regOp1, X64Reg regOp2, const OpArg& arg);
 	void VPXOR(X64Reg regOp1, X64Reg regOp2, const OpArg& arg);
 
+	// AVX with a vector size, bits is 128 or 256. 256-bit integer instructions need AVX2.
+	void VMOVD_xmm(X64Reg dest, const OpArg& arg);
+	void VMOVQ_xmm(X64Reg dest, const OpArg& arg);
+	void VMOVDQU(int bits, X64Reg dest, const OpArg& arg);
+	void VMOVUPS(int bits, const OpArg& arg, X64Reg src);
+	void VMOVLPS(const OpArg& arg, X64Reg src);
+	void VMOVSS(const OpArg& arg, X64Reg src);
+	void VBROADCASTF128(X64Reg dest, const OpArg& arg);
+	void VINSERTI128(X64Reg dest, X64Reg src, const OpArg& arg, u8 lane);
+	void VEXTRACTI128(const OpArg& arg, X64Reg src, u8 lane);
+	void VPSHUFB(int bits, X64Reg regOp1, X64Reg regOp2, const OpArg& arg);
+	void VPSRAD(int bits, X64Reg dest, X64Reg src, u8 shift);
+	void VCVTDQ2PS(int bits, X64Reg dest, const OpArg& arg);
+	void VCVTSI2SS(X64Reg regOp1, X64Reg regOp2, const OpArg& arg);
+	void VMULPS(int bits, X64Reg regOp1, X64Reg regOp2, const OpArg& arg);
+	void VZEROUPPER();
+
 	// FMA3
 	void VFMADD132PS(X64Reg regOp1, X64Reg regOp2, const OpArg& arg);
 	void VFMADD213PS(X64Reg regOp1, X64Reg regOp2, const OpArg& arg);
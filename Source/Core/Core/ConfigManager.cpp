@@ -269,6 +269,10 @@ void SConfig::SaveCoreSettings(IniFile& ini)
 	core->Set("DVDRoot", m_strDVDRoot);
 	core->Set("Apploader", m_strApploader);
 	core->Set("EnableCheats", bEnableCheats);
+	core->Set("StateCompression", iStateCompression);
+	core->Set("Rewind", bRewind);
+	core->Set("RewindInterval", iRewindInterval);
+	core->Set("RewindBufferSize", iRewindBufferSize);
 	core->Set("SelectedLanguage", SelectedLanguage);
 	core->Set("OverrideGCLang", bOverrideGCLanguage);
 	core->Set("DPL2Decoder", bDPL2Decoder);
@@ -583,6 +587,10 @@ void SConfig::LoadCoreSettings(IniFile& ini)
 	core->Get("DVDRoot", &m_strDVDRoot);
 	core->Get("Apploader", &m_strApploader);
 	core->Get("EnableCheats", &bEnableCheats, false);
+	core->Get("StateCompression", &iStateCompression, 1);
+	core->Get("Rewind", &bRewind, false);
+	core->Get("RewindInterval", &iRewindInterval, 30);
+	core->Get("RewindBufferSize", &iRewindBufferSize, 256);
 	core->Get("SelectedLanguage", &SelectedLanguage, 0);
 	core->Get("OverrideGCLang", &bOverrideGCLanguage, false);
 	core->Get("DPL2Decoder", &bDPL2Decoder, false);
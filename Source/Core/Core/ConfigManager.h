@@ -122,6 +122,13 @@ struct SConfig : NonCopyable
 	bool bForceNTSCJ = false;
 	bool bHLE_BS2 = true;
 	bool bEnableCheats = false;
+	// State::Compression used for new savestates
+	int iStateCompression = 1;
+	bool bRewind = false;
+	// Frames between two rewind snapshots
+	int iRewindInterval = 30;
+	// In MiB
+	int iRewindBufferSize = 256;
 	bool bEnableMemcardSdWriting = true;
 	bool bAllowAllNetplayVersions = false;
 	bool bQoSEnabled = true;
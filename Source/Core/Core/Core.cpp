@@ -866,6 +866,8 @@ void VideoThrottle()
 		float Speed = (float)(s_drawn_video.load() * 1000.0 / (VideoInterface::GetTargetRefreshRate() * ElapseTime));
 		g_sound_stream->GetMixer()->UpdateSpeed((float)Speed);
 	}
+
+	State::UpdateRewind();
 }
 
 // Executed from GPU thread
@@ -63,6 +63,7 @@ static std::vector<Event> s_event_queue;
 static u64 s_event_fifo_id;
 static std::mutex s_ts_write_lock;
 static Common::FifoQueue<Event, false> s_ts_queue;
+static std::vector<void (*)()> s_slice_end_callbacks;
 
 static float s_last_OC_factor;
 float g_last_OC_factor_inverted;
@@ -228,6 +229,7 @@ u64 GetIdleTicks()
 void ClearPendingEvents()
 {
 	s_event_queue.clear();
+	s_slice_end_callbacks.clear();
 }
 
 void ScheduleEvent(s64 cycles_into_future, EventType* event_type, u64 userdata, FromThread from)
@@ -365,6 +367,19 @@ void Advance()
 	// until the next slice:
 	//        Pokemon Box refuses to boot if the first exception from the audio DMA is received late
 	PowerPC::CheckExternalExceptions();
+
+	if (!s_slice_end_callbacks.empty())
+	{
+		std::vector<void (*)()> callbacks;
+		callbacks.swap(s_slice_end_callbacks);
+		for (auto callback : callbacks)
+			callback();
+	}
+}
+
+void RunAtSliceEnd(void (*callback)())
+{
+	s_slice_end_callbacks.push_back(callback);
 }
 
 void LogPendingEvents()
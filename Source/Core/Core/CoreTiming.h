@@ -82,6 +82,12 @@ void Advance();
 void MoveEvents();
 void ProcessFifoWaitEvents();
 
+// Runs callback once at the end of the current (or, outside of one, the next) Advance, after the
+// events that were due ran and rescheduled themselves and the next slice is set up. The scheduler
+// is then in the state a paused CPU thread would save, so callback may use DoState, which an event
+// callback must not. CPU thread only.
+void RunAtSliceEnd(void (*callback)());
+
 // Pretend that the main CPU has executed enough cycles to reach the next event.
 void Idle();
 
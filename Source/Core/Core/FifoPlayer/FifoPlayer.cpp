@@ -76,6 +76,7 @@ public:
 		IsPlayingBackFifologWithBrokenEFBCopies = m_parent->m_File->HasBrokenEFBCopies();
 
 		m_parent->m_CurrentFrame = m_parent->m_FrameRangeStart;
+		m_parent->m_PlaybacksDone = 0;
 		m_parent->LoadMemory();
 	}
 
@@ -120,7 +121,8 @@ int FifoPlayer::AdvanceFrame()
 {
 	if (m_CurrentFrame >= m_FrameRangeEnd)
 	{
-		if (!m_Loop)
+		const bool loop = m_PlaybackCount ? ++m_PlaybacksDone < m_PlaybackCount : m_Loop;
+		if (!loop)
 			return CPU::CPU_POWERDOWN;
 		// If there are zero frames in the range then sleep instead of busy spinning
 		if (m_FrameRangeStart >= m_FrameRangeEnd)
@@ -206,7 +208,7 @@ FifoPlayer& FifoPlayer::GetInstance()
 }
 
 FifoPlayer::FifoPlayer()
-	: m_CurrentFrame(0), m_FrameRangeStart(0), m_FrameRangeEnd(0), m_ObjectRangeStart(0),
+	: m_PlaybackCount(0), m_PlaybacksDone(0), m_CurrentFrame(0), m_FrameRangeStart(0), m_FrameRangeEnd(0), m_ObjectRangeStart(0),
 	m_ObjectRangeEnd(10000), m_EarlyMemoryUpdates(false), m_FileLoadedCb(nullptr),
 	m_FrameWrittenCb(nullptr), m_File(nullptr)
 {
@@ -335,6 +337,7 @@ void FifoPlayer::WriteMemory(const MemoryUpdate& memUpdate)
 		mem = &Memory::m_pRAM[memUpdate.address & Memory::RAM_MASK];
 
 	std::copy(memUpdate.data.begin(), memUpdate.data.end(), mem);
+	Memory::MarkWritten(memUpdate.address, memUpdate.data.size());
 }
 
 void FifoPlayer::WriteFifo(const u8* data, u32 start, u32 end)
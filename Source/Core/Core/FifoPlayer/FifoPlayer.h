@@ -81,6 +81,8 @@ public:
 	void SetObjectRangeStart(u32 start) { m_ObjectRangeStart = start; }
 	u32 GetObjectRangeEnd() const { return m_ObjectRangeEnd; }
 	void SetObjectRangeEnd(u32 end) { m_ObjectRangeEnd = end; }
+	// Plays the frame range count times and stops, 0 loops as configured
+	void SetPlaybackCount(u32 count) { m_PlaybackCount = count; }
 	// If enabled then all memory updates happen at once before the first frame
 	// Default is disabled
 	void SetEarlyMemoryUpdates(bool enabled) { m_EarlyMemoryUpdates = enabled; }
@@ -129,6 +131,8 @@ private:
 	static bool IsHighWatermarkSet();
 
 	bool m_Loop;
+	u32 m_PlaybackCount;
+	u32 m_PlaybacksDone;
 
 	u32 m_CurrentFrame;
 	u32 m_FrameRangeStart;
@@ -7,7 +7,9 @@
 // However, if a JITed instruction (for example lwz) wants to access a bad memory area that call
 // may be redirected here (for example to Read_U32()).
 
+#include <algorithm>
 #include <cstring>
+#include <iterator>
 #include <memory>
 
 #include "Common/ChunkFile.h"
@@ -15,6 +17,7 @@
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
 #include "Common/MemArena.h"
+#include "Common/MemoryUtil.h"
 #include "Core/ConfigManager.h"
 #include "Core/HW/AudioInterface.h"
 #include "Core/HW/DSP.h"
@@ -48,6 +51,20 @@ u8* logical_base = nullptr;
 static MemArena g_arena;
 // ==============
 
+// Write watching (see Memmap.h). The page states are only changed under
+// s_watch_lock, the fault handler takes it too so it has to be a spin lock.
+static const u32 WATCH_PAGE_SHIFT = 12;
+static const u32 WATCH_RAM_PAGES = RAM_SIZE >> WATCH_PAGE_SHIFT;
+static const u32 WATCH_PAGES = WATCH_RAM_PAGES + (EXRAM_SIZE >> WATCH_PAGE_SHIFT);
+std::atomic<bool> bWriteWatchActive{ false };
+static bool s_write_watch_supported = false;
+static std::atomic<u64> s_write_stamp{ 1 };
+// Every page counts as written at this stamp (memory cleared or loaded from a state)
+static std::atomic<u64> s_reset_stamp{ 0 };
+static std::atomic<u64> s_page_stamps[WATCH_PAGES];
+static bool s_page_protected[WATCH_PAGES];
+static std::atomic_flag s_watch_lock = ATOMIC_FLAG_INIT;
+
 // STATE_TO_SAVE
 static bool m_IsInitialized = false;  // Save the Init(), Shutdown() state
 																			// END STATE_TO_SAVE
@@ -193,6 +210,10 @@ void Init()
 
 	Clear();
 
+	// The pages can only be protected if the fault handler is installed
+	s_write_watch_supported = SConfig::GetInstance().bFastmem && logical_base;
+	std::fill(std::begin(s_page_protected), std::end(s_page_protected), false);
+
 	INFO_LOG(MEMMAP, "Memory system initialized. RAM at %p", m_pRAM);
 	m_IsInitialized = true;
 }
@@ -209,11 +230,16 @@ void DoState(PointerWrap& p)
 	if (wii)
 		p.DoArray(m_pEXRAM, EXRAM_SIZE);
 	p.DoMarker("Memory EXRAM");
+	if (p.GetMode() == PointerWrap::MODE_READ)
+		s_reset_stamp = ++s_write_stamp;
 }
 
 void Shutdown()
 {
 	m_IsInitialized = false;
+	// The views go away with their protection
+	bWriteWatchActive = false;
+	s_write_watch_supported = false;
 	u32 flags = 0;
 	if (SConfig::GetInstance().bWii)
 		flags |= MV_WII_ONLY;
@@ -235,6 +261,7 @@ void Clear()
 		memset(m_pL1Cache, 0, L1_CACHE_SIZE);
 	if (SConfig::GetInstance().bWii && m_pEXRAM)
 		memset(m_pEXRAM, 0, EXRAM_SIZE);
+	s_reset_stamp = ++s_write_stamp;
 }
 
 bool AreMemoryBreakpointsActivated()
@@ -286,6 +313,7 @@ void CopyToEmu(u32 address, const void* data, size_t size)
 		return;
 	}
 	memcpy(pointer, data, size);
+	MarkWritten(address, size);
 }
 
 void Memset(u32 address, u8 value, size_t size)
@@ -300,6 +328,7 @@ void Memset(u32 address, u8 value, size_t size)
 		return;
 	}
 	memset(pointer, value, size);
+	MarkWritten(address, size);
 }
 
 std::string GetString(u32 em_address, size_t size)
@@ -361,34 +390,199 @@ u64 Read_U64(u32 address)
 void Write_U8(u8 value, u32 address)
 {
 	*GetPointer(address) = value;
+	MarkWritten(address, sizeof(u8));
 }
 
 void Write_U16(u16 value, u32 address)
 {
 	u16 swapped_value = Common::swap16(value);
 	std::memcpy(GetPointer(address), &swapped_value, sizeof(u16));
+	MarkWritten(address, sizeof(u16));
 }
 
 void Write_U32(u32 value, u32 address)
 {
 	u32 swapped_value = Common::swap32(value);
 	std::memcpy(GetPointer(address), &swapped_value, sizeof(u32));
+	MarkWritten(address, sizeof(u32));
 }
 
 void Write_U64(u64 value, u32 address)
 {
 	u64 swapped_value = Common::swap64(value);
 	std::memcpy(GetPointer(address), &swapped_value, sizeof(u64));
+	MarkWritten(address, sizeof(u64));
 }
 
 void Write_U32_Swap(u32 value, u32 address)
 {
 	std::memcpy(GetPointer(address), &value, sizeof(u32));
+	MarkWritten(address, sizeof(u32));
 }
 
 void Write_U64_Swap(u64 value, u32 address)
 {
 	std::memcpy(GetPointer(address), &value, sizeof(u64));
+	MarkWritten(address, sizeof(u64));
+}
+
+class WatchLock
+{
+public:
+	WatchLock()
+	{
+		while (s_watch_lock.test_and_set(std::memory_order_acquire))
+		{
+		}
+	}
+	~WatchLock() { s_watch_lock.clear(std::memory_order_release); }
+};
+
+// Page of a device address, the same mapping as GetPointer. Returns -1 outside of RAM/EXRAM.
+static int GetWatchPage(u32 address)
+{
+	address &= 0x3FFFFFFF;
+	if (address < RAM_SIZE)
+		return address >> WATCH_PAGE_SHIFT;
+	if (m_pEXRAM && (address >> 28) == 0x1 && (address & 0x0fffffff) < EXRAM_SIZE)
+		return WATCH_RAM_PAGES + ((address & EXRAM_MASK) >> WATCH_PAGE_SHIFT);
+	return -1;
+}
+
+static bool GetWatchPages(u32 address, size_t size, int* first, int* last)
+{
+	if (size == 0 || size >= EXRAM_SIZE)
+		return false;
+	*first = GetWatchPage(address);
+	*last = GetWatchPage(address + u32(size) - 1);
+	return *first >= 0 && *last >= *first &&
+		(*first < (int)WATCH_RAM_PAGES) == (*last < (int)WATCH_RAM_PAGES);
+}
+
+// Changes the protection of pages in all the logical views of their bank
+static void SetPagesWritable(int first, int count, bool writable)
+{
+	static const u32 ram_views[] = { 0x00000000, 0x80000000, 0xC0000000 };
+	static const u32 exram_views[] = { 0x90000000, 0xD0000000 };
+	const bool exram = first >= (int)WATCH_RAM_PAGES;
+	const u32 offset = (u32)(exram ? first - WATCH_RAM_PAGES : first) << WATCH_PAGE_SHIFT;
+	const size_t size = (size_t)count << WATCH_PAGE_SHIFT;
+	const u32* view_offsets = exram ? exram_views : ram_views;
+	const size_t view_count = exram ? ArraySize(exram_views) : ArraySize(ram_views);
+	for (size_t i = 0; i < view_count; i++)
+	{
+		u8* pointer = logical_base + view_offsets[i] + offset;
+		if (writable)
+			Common::UnWriteProtectMemory(pointer, size);
+		else
+			Common::WriteProtectMemory(pointer, size);
+	}
+}
+
+bool IsWriteWatchSupported()
+{
+	return s_write_watch_supported;
+}
+
+u64 WatchPages(u32 address, u32 size)
+{
+	int first, last;
+	if (!s_write_watch_supported || !GetWatchPages(address, size, &first, &last))
+		return 0;
+	// Writes are only marked from now on, so this range can't be trusted yet
+	if (!bWriteWatchActive.load())
+	{
+		bWriteWatchActive = true;
+		return 0;
+	}
+
+	// Taken before the pages are protected: a write that slips in between is
+	// either seen by the caller reading the data, or faults with a newer stamp.
+	const u64 stamp = s_write_stamp.load();
+	WatchLock lock;
+	int run = -1;
+	for (int page = first; page <= last + 1; page++)
+	{
+		if (page <= last && !s_page_protected[page])
+		{
+			s_page_protected[page] = true;
+			if (run < 0)
+				run = page;
+		}
+		else if (run >= 0)
+		{
+			SetPagesWritable(run, page - run, false);
+			run = -1;
+		}
+	}
+	return stamp;
+}
+
+bool WrittenSince(u32 address, u32 size, u64 stamp)
+{
+	int first, last;
+	if (!stamp || s_reset_stamp.load() > stamp || !GetWatchPages(address, size, &first, &last))
+		return true;
+	for (int page = first; page <= last; page++)
+	{
+		if (s_page_stamps[page].load(std::memory_order_relaxed) > stamp)
+			return true;
+	}
+	return false;
+}
+
+void MarkPagesWritten(u32 address, size_t size)
+{
+	int first, last;
+	if (!GetWatchPages(address, size, &first, &last))
+	{
+		// A range that can't be mapped to pages marks everything
+		if (size)
+			s_reset_stamp = ++s_write_stamp;
+		return;
+	}
+	const u64 stamp = ++s_write_stamp;
+	for (int page = first; page <= last; page++)
+		s_page_stamps[page].store(stamp, std::memory_order_relaxed);
+}
+
+bool HandleWriteWatchFault(uintptr_t fault_address)
+{
+	if (!bWriteWatchActive.load(std::memory_order_relaxed) || !logical_base)
+		return false;
+	const uintptr_t base = reinterpret_cast<uintptr_t>(logical_base);
+	if (fault_address < base || fault_address - base >= 0x100000000ULL)
+		return false;
+
+	const u32 address = (u32)(fault_address - base);
+	int page;
+	switch (address >> 28)
+	{
+	case 0x0:
+	case 0x8:
+	case 0xC:
+		if ((address & 0x0fffffff) >= RAM_SIZE)
+			return false;
+		page = (address & RAM_MASK) >> WATCH_PAGE_SHIFT;
+		break;
+	case 0x9:
+	case 0xD:
+		if (!m_pEXRAM || (address & 0x0fffffff) >= EXRAM_SIZE)
+			return false;
+		page = WATCH_RAM_PAGES + ((address & EXRAM_MASK) >> WATCH_PAGE_SHIFT);
+		break;
+	default:
+		return false;
+	}
+
+	WatchLock lock;
+	if (!s_page_protected[page])
+		return false;
+	// Unprotected before the new stamp, see WatchPages
+	SetPagesWritable(page, 1, true);
+	s_page_protected[page] = false;
+	s_page_stamps[page] = ++s_write_stamp;
+	return true;
 }
 
 }  // namespace
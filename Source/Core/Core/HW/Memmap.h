@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstddef>
 #include <memory>
 #include <string>
 
@@ -85,6 +87,26 @@ u8* GetPointer(const u32 address);
 void CopyFromEmu(void* data, u32 address, size_t size);
 void CopyToEmu(u32 address, const void* data, size_t size);
 void Memset(u32 address, u8 value, size_t size);
+
+// Write watching, lets the texture cache skip hashing memory nothing wrote to.
+// WatchPages write-protects the pages of a range in the logical CPU views, so the
+// first fastmem write to one of them faults and marks the page written. Writes
+// through m_pRAM/m_pEXRAM (DMA, HLE, the slow CPU paths) don't fault, their
+// writers call MarkWritten after the data is in memory.
+extern std::atomic<bool> bWriteWatchActive;
+bool IsWriteWatchSupported();
+// Returns a stamp for WrittenSince, 0 if the range can't be watched. Data read
+// after the call is only stale if WrittenSince says so.
+u64 WatchPages(u32 address, u32 size);
+bool WrittenSince(u32 address, u32 size, u64 stamp);
+void MarkPagesWritten(u32 address, size_t size);
+inline void MarkWritten(u32 address, size_t size)
+{
+	if (bWriteWatchActive.load(std::memory_order_relaxed))
+		MarkPagesWritten(address, size);
+}
+// Called by the fault handler, returns true if the fault was a watched page
+bool HandleWriteWatchFault(uintptr_t fault_address);
 u8 Read_U8(const u32 address);
 u16 Read_U16(const u32 address);
 u32 Read_U32(const u32 address);
@@ -119,5 +141,6 @@ void CopyToEmuSwapped(u32 address, const T* data, size_t size)
 
 	for (size_t i = 0; i < size / sizeof(T); i++)
 		dest[i] = Common::FromBigEndian(data[i]);
+	MarkWritten(address, size);
 }
 }
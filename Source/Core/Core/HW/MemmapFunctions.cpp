@@ -501,6 +501,7 @@ void DMA_LCToMemory(const u32 memAddr, const u32 cacheAddr, const u32 numBlocks)
 		return;
 
 	memcpy(dst, src, 32 * numBlocks);
+	Memory::MarkWritten(memAddr, 32 * numBlocks);
 }
 
 void DMA_MemoryToLC(const u32 cacheAddr, const u32 memAddr, const u32 numBlocks)
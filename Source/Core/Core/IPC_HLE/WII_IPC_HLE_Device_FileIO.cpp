@@ -243,6 +243,7 @@ IPCCommandResult CWII_IPC_HLE_Device_FileIO::Read(u32 _CommandAddress)
 				m_name.c_str());
 			m_file->Seek(m_SeekPos, SEEK_SET);  // File might be opened twice, need to seek before we read
 			ReturnValue = (u32)fread(Memory::GetPointer(Address), 1, Size, m_file->GetHandle());
+			Memory::MarkWritten(Address, Size);
 			if (ReturnValue != Size && ferror(m_file->GetHandle()))
 			{
 				ReturnValue = FS_EACCESS;
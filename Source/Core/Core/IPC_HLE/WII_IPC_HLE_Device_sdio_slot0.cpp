@@ -389,6 +389,7 @@ u32 CWII_IPC_HLE_Device_sdio_slot0::ExecuteCommand(u32 _BufferIn, u32 _BufferInS
 
 			if (m_Card.ReadBytes(Memory::GetPointer(req.addr), size))
 			{
+				Memory::MarkWritten(req.addr, size);
 				DEBUG_LOG(WII_IPC_SD, "Outbuffer size %i got %i", _rwBufferSize, size);
 			}
 			else
@@ -44,7 +44,7 @@ LONG NTAPI Handler(PEXCEPTION_POINTERS pPtrs)
 		uintptr_t badAddress = (uintptr_t)pPtrs->ExceptionRecord->ExceptionInformation[1];
 		CONTEXT* ctx = pPtrs->ContextRecord;
 
-		if (JitInterface::HandleFault(badAddress, ctx))
+		if (Memory::HandleWriteWatchFault(badAddress) || JitInterface::HandleFault(badAddress, ctx))
 		{
 			return (DWORD)EXCEPTION_CONTINUE_EXECUTION;
 		}
@@ -171,7 +171,8 @@ static void ExceptionThread(mach_port_t port)
 
 		x86_thread_state64_t* state = (x86_thread_state64_t*)msg_in.old_state;
 
-		bool ok = JitInterface::HandleFault((uintptr_t)msg_in.code[1], state);
+		bool ok = Memory::HandleWriteWatchFault((uintptr_t)msg_in.code[1]) ||
+			JitInterface::HandleFault((uintptr_t)msg_in.code[1], state);
 
 		// Set up the reply.
 		msg_out.Head.msgh_bits = MACH_MSGH_BITS(MACH_MSGH_BITS_REMOTE(msg_in.Head.msgh_bits), 0);
@@ -254,6 +255,9 @@ static void sigsegv_handler(int sig, siginfo_t* info, void* raw_context)
 #else
 	mcontext_t* ctx = &context->uc_mcontext;
 #endif
+	// Pages of watched textures are write-protected
+	if (Memory::HandleWriteWatchFault(bad_address))
+		return;
 	// assume it's not a write
 	if (!JitInterface::HandleFault(bad_address,
 #ifdef __APPLE__
@@ -268,6 +268,7 @@ __forceinline static void WriteToHardware(u32 em_address, const T data)
 			// mirrors of memory).
 			// TODO: Only the first REALRAM_SIZE is supposed to be backed by actual memory.
 			*(T*)&Memory::m_pRAM[em_address & Memory::RAM_MASK] = bswap(data);
+			Memory::MarkWritten(em_address & Memory::RAM_MASK, sizeof(T));
 			return;
 		}
 		if (Memory::m_pEXRAM && (segment == 0x9 || segment == 0xD) && (em_address & 0x0FFFFFFF) < Memory::EXRAM_SIZE)
@@ -275,6 +276,7 @@ __forceinline static void WriteToHardware(u32 em_address, const T data)
 			// Handle EXRAM.
 			// TODO: Is this supposed to be mirrored like main RAM?
 			*(T*)&Memory::m_pEXRAM[em_address & 0x0FFFFFFF] = bswap(data);
+			Memory::MarkWritten(0x10000000 | (em_address & 0x0FFFFFFF), sizeof(T));
 			return;
 		}
 		if (segment == 0xE && (em_address < (0xE0000000 + Memory::L1_CACHE_SIZE)))
@@ -323,11 +325,13 @@ __forceinline static void WriteToHardware(u32 em_address, const T data)
 			// mirrors of memory).
 			// TODO: Only the first REALRAM_SIZE is supposed to be backed by actual memory.
 			*(T*)&Memory::m_pRAM[em_address & Memory::RAM_MASK] = bswap(data);
+			Memory::MarkWritten(em_address & Memory::RAM_MASK, sizeof(T));
 			return;
 		}
 		if (Memory::m_pEXRAM && segment == 0x1 && (em_address & 0x0FFFFFFF) < Memory::EXRAM_SIZE)
 		{
 			*(T*)&Memory::m_pEXRAM[em_address & 0x0FFFFFFF] = bswap(data);
+			Memory::MarkWritten(0x10000000 | (em_address & 0x0FFFFFFF), sizeof(T));
 			return;
 		}
 		PanicAlert("Unable to resolve write address %x PC %x", em_address, PC);
@@ -362,12 +366,14 @@ __forceinline static void WriteToHardware(u32 em_address, const T data)
 			if (addr == em_address_next_page)
 				tlb_addr = tlb_addr_next_page;
 			Memory::physical_base[tlb_addr] = (u8)val;
+			Memory::MarkWritten(tlb_addr, 1);
 		}
 		return;
 	}
 
 	// The easy case!
 	*(T*)&Memory::physical_base[tlb_addr] = bswap(data);
+	Memory::MarkWritten(tlb_addr, sizeof(T));
 }
 // =====================
 
@@ -0,0 +1,184 @@
+// Copyright 2013 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include <cstring>
+#include <lzo/lzo1x.h>
+#include <memory>
+
+#include "Common/ThreadPool.h"
+#include "Core/RewindBuffer.h"
+
+namespace State
+{
+static const u32 DELTA_BLOCK_SIZE = 64 * 1024;
+static const u32 DELTA_BLOCK_BOUND = DELTA_BLOCK_SIZE + (DELTA_BLOCK_SIZE / 16) + 64 + 3;
+static const u32 DELTA_BLOCK_RAW = 0x80000000;
+// Blocks handled by a thread at once, keeps the bands away from single blocks
+static const int DELTA_BLOCKS_PER_BAND = 16;
+
+static u8* GetScratchBlock()
+{
+	thread_local std::unique_ptr<u8[]> block(new u8[DELTA_BLOCK_BOUND]);
+	return block.get();
+}
+
+// Encodes the XOR of the block at offset in a and b (missing bytes count as zero)
+// into out, returns false if the block is the same in both.
+static bool EncodeBlock(const std::vector<u8>& a, const std::vector<u8>& b, size_t offset,
+	size_t length, std::vector<u8>& out)
+{
+	const size_t a_length = offset < a.size() ? std::min(length, a.size() - offset) : 0;
+	const size_t b_length = offset < b.size() ? std::min(length, b.size() - offset) : 0;
+	if (a_length == length && b_length == length && !memcmp(&a[offset], &b[offset], length))
+		return false;
+
+	u8* x = GetScratchBlock();
+	const size_t common = std::min(a_length, b_length);
+	for (size_t i = 0; i < common; i++)
+		x[i] = a[offset + i] ^ b[offset + i];
+	if (a_length > common)
+		memcpy(x + common, &a[offset + common], a_length - common);
+	if (b_length > common)
+		memcpy(x + common, &b[offset + common], b_length - common);
+	memset(x + std::max(a_length, b_length), 0, length - std::max(a_length, b_length));
+
+	thread_local std::unique_ptr<lzo_align_t[]> wrkmem(
+		new lzo_align_t[(LZO1X_1_MEM_COMPRESS + sizeof(lzo_align_t) - 1) / sizeof(lzo_align_t)]);
+	out.resize(2 * sizeof(u32) + DELTA_BLOCK_BOUND);
+	lzo_uint out_length = 0;
+	u32 size;
+	if (lzo1x_1_compress(x, (lzo_uint)length, &out[2 * sizeof(u32)], &out_length, wrkmem.get()) ==
+		LZO_E_OK && out_length < length)
+	{
+		size = (u32)out_length;
+	}
+	else
+	{
+		memcpy(&out[2 * sizeof(u32)], x, length);
+		out_length = length;
+		size = (u32)length | DELTA_BLOCK_RAW;
+	}
+	const u32 index = (u32)(offset / DELTA_BLOCK_SIZE);
+	memcpy(&out[0], &index, sizeof(u32));
+	memcpy(&out[sizeof(u32)], &size, sizeof(u32));
+	out.resize(2 * sizeof(u32) + out_length);
+	return true;
+}
+
+RewindBuffer::RewindBuffer(size_t memory_budget) : m_memory_budget(memory_budget)
+{
+}
+
+void RewindBuffer::Push(std::vector<u8>& state)
+{
+	if (!m_newest.empty())
+	{
+		// The delta turns the new snapshot back into the current newest one
+		const size_t length = std::max(m_newest.size(), state.size());
+		const int block_count = (int)((length + DELTA_BLOCK_SIZE - 1) / DELTA_BLOCK_SIZE);
+		std::vector<std::vector<u8>> blocks(block_count);
+		Common::ThreadPool::Loop([&](int lower, int upper) {
+			for (int i = lower; i < upper; i++)
+			{
+				const size_t offset = (size_t)i * DELTA_BLOCK_SIZE;
+				if (!EncodeBlock(m_newest, state, offset, std::min<size_t>(DELTA_BLOCK_SIZE, length - offset),
+					blocks[i]))
+				{
+					blocks[i].clear();
+				}
+			}
+		}, 0, block_count, DELTA_BLOCKS_PER_BAND);
+
+		Delta delta;
+		delta.size = (u32)m_newest.size();
+		size_t delta_size = 0;
+		for (const std::vector<u8>& block : blocks)
+			delta_size += block.size();
+		delta.data.reserve(delta_size);
+		for (const std::vector<u8>& block : blocks)
+			delta.data.insert(delta.data.end(), block.begin(), block.end());
+
+		m_memory_usage += delta.data.size();
+		m_deltas.push_back(std::move(delta));
+		m_memory_usage -= m_newest.size();
+	}
+	m_newest.swap(state);
+	m_memory_usage += m_newest.size();
+	m_uncompressed_size += m_newest.size();
+	Trim();
+}
+
+bool RewindBuffer::Pop()
+{
+	if (m_deltas.empty())
+		return false;
+
+	const Delta& delta = m_deltas.back();
+	std::vector<size_t> offsets;
+	for (size_t offset = 0; offset < delta.data.size();)
+	{
+		u32 size;
+		memcpy(&size, &delta.data[offset + sizeof(u32)], sizeof(u32));
+		offsets.push_back(offset);
+		offset += 2 * sizeof(u32) + (size & ~DELTA_BLOCK_RAW);
+	}
+
+	const size_t old_size = m_newest.size();
+	m_newest.resize(std::max<size_t>(old_size, delta.size), 0);
+	Common::ThreadPool::Loop([&](int lower, int upper) {
+		for (int i = lower; i < upper; i++)
+		{
+			u32 index, size;
+			memcpy(&index, &delta.data[offsets[i]], sizeof(u32));
+			memcpy(&size, &delta.data[offsets[i] + sizeof(u32)], sizeof(u32));
+			const u8* data = &delta.data[offsets[i] + 2 * sizeof(u32)];
+			const size_t offset = (size_t)index * DELTA_BLOCK_SIZE;
+			const size_t length = std::min<size_t>(DELTA_BLOCK_SIZE, m_newest.size() - offset);
+			const u8* x = data;
+			if (!(size & DELTA_BLOCK_RAW))
+			{
+				u8* block = GetScratchBlock();
+				lzo_uint block_length = DELTA_BLOCK_SIZE;
+				lzo1x_decompress_safe(data, size, block, &block_length, nullptr);
+				x = block;
+			}
+			for (size_t j = 0; j < length; j++)
+				m_newest[offset + j] ^= x[j];
+		}
+	}, 0, (int)offsets.size(), DELTA_BLOCKS_PER_BAND);
+	m_newest.resize(delta.size);
+
+	m_memory_usage += m_newest.size();
+	m_memory_usage -= old_size + delta.data.size();
+	m_uncompressed_size -= old_size;
+	m_deltas.pop_back();
+	return true;
+}
+
+void RewindBuffer::Clear()
+{
+	m_newest.clear();
+	m_newest.shrink_to_fit();
+	m_deltas.clear();
+	m_memory_usage = 0;
+	m_uncompressed_size = 0;
+}
+
+void RewindBuffer::SetMemoryBudget(size_t memory_budget)
+{
+	m_memory_budget = memory_budget;
+	Trim();
+}
+
+void RewindBuffer::Trim()
+{
+	while (m_memory_usage > m_memory_budget && !m_deltas.empty())
+	{
+		m_memory_usage -= m_deltas.front().data.size();
+		m_uncompressed_size -= m_deltas.front().size;
+		m_deltas.pop_front();
+	}
+}
+}
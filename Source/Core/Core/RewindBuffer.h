@@ -0,0 +1,78 @@
+// Copyright 2013 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+// Bounded in-memory history of savestates, used for rewinding.
+
+#pragma once
+
+#include <deque>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/NonCopyable.h"
+
+namespace State
+{
+// Only the newest snapshot is kept whole. Every older snapshot is stored as the
+// XOR of itself and the next one, split in blocks: the blocks that did not change
+// (most of MEM1/MEM2 between two snapshots) are skipped and the others are LZO
+// compressed, which turns the long runs of zeros into almost nothing.
+class RewindBuffer : NonCopyable
+{
+public:
+	explicit RewindBuffer(size_t memory_budget);
+
+	// Makes state the newest snapshot. state receives the memory of a previous
+	// snapshot so the caller can reuse it for the next one.
+	void Push(std::vector<u8>& state);
+	// Drops the newest snapshot so the one before it becomes the newest.
+	// Returns false (and keeps the snapshot) if there is only one left.
+	bool Pop();
+	void Clear();
+
+	bool IsEmpty() const
+	{
+		return m_newest.empty();
+	}
+	std::vector<u8>& GetNewest()
+	{
+		return m_newest;
+	}
+
+	// The oldest snapshots are dropped when the buffer uses more memory than this
+	void SetMemoryBudget(size_t memory_budget);
+
+	size_t GetSnapshotCount() const
+	{
+		return m_newest.empty() ? 0 : m_deltas.size() + 1;
+	}
+	size_t GetMemoryUsage() const
+	{
+		return m_memory_usage;
+	}
+	// Memory the snapshots would use if they were all stored whole
+	u64 GetUncompressedSize() const
+	{
+		return m_uncompressed_size;
+	}
+
+private:
+	struct Delta
+	{
+		// Size of the snapshot this delta restores
+		u32 size;
+		// Changed blocks: u32 block index, u32 size (DELTA_BLOCK_RAW if stored as is), data
+		std::vector<u8> data;
+	};
+
+	void Trim();
+
+	std::vector<u8> m_newest;
+	// Oldest first
+	std::deque<Delta> m_deltas;
+	size_t m_memory_budget;
+	size_t m_memory_usage = 0;
+	u64 m_uncompressed_size = 0;
+};
+}
@@ -2,13 +2,18 @@
 // Licensed under GPLv2+
 // Refer to the license.txt file included.
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <lzo/lzo1x.h>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <thread>
 #include <utility>
 #include <vector>
+#include <zlib.h>
 
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
@@ -18,21 +23,27 @@
 #include "Common/ScopeGuard.h"
 #include "Common/StringUtil.h"
 #include "Common/Thread.h"
+#include "Common/ThreadPool.h"
 #include "Common/Timer.h"
 
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
+#include "Core/DSPEmulator.h"
 #include "Core/GeckoCode.h"
+#include "Core/HW/DSP.h"
+#include "Core/HW/EXI.h"
 #include "Core/HW/HW.h"
 #include "Core/HW/Wiimote.h"
 #include "Core/Host.h"
 #include "Core/Movie.h"
 #include "Core/NetPlayClient.h"
 #include "Core/PowerPC/PowerPC.h"
+#include "Core/RewindBuffer.h"
 #include "Core/State.h"
 
 #include "VideoCommon/AVIDump.h"
+#include "VideoCommon/Fifo.h"
 #include "VideoCommon/OnScreenDisplay.h"
 #include "VideoCommon/VideoBackendBase.h"
 
@@ -48,12 +59,14 @@ static const u32 IN_LEN = 128 * 1024u;
 
 static const u32 OUT_LEN = IN_LEN + (IN_LEN / 16) + 64 + 3;
 
-static unsigned char __LZO_MMODEL out[OUT_LEN];
-
-#define HEAP_ALLOC(var, size)                                                                      \
-  lzo_align_t __LZO_MMODEL var[((size) + (sizeof(lzo_align_t) - 1)) / sizeof(lzo_align_t)]
-
-static HEAP_ALLOC(wrkmem, LZO1X_1_MEM_COMPRESS);
+// Chunked states: the header is followed by CHUNK_TABLE_MAGIC, the chunk size,
+// the chunk count and the compressed size of every chunk, then the chunks.
+// Every chunk is compressed on its own so they are processed on all the cores.
+// States without the magic are a stream of (u32 size, LZO data) IN_LEN chunks.
+static const u32 CHUNK_TABLE_MAGIC = 0x4B4E4843;  // "CHNK"
+static const u32 CHUNK_SIZE = 1024 * 1024;
+// Chunks compressed before they are written, bounds the memory used on save
+static const u32 CHUNKS_PER_BATCH = 32;
 
 static std::string g_last_filename;
 
@@ -70,6 +83,15 @@ static Common::Event g_compressAndDumpStateSyncEvent;
 
 static std::thread g_save_thread;
 
+// Rewind history, snapshots are taken on the CPU thread every SConfig::iRewindInterval frames
+static std::unique_ptr<RewindBuffer> g_rewind_buffer;
+static std::vector<u8> g_rewind_scratch;
+static std::mutex g_cs_rewind_buffer;
+static int g_rewind_frames = 0;
+static RewindStats g_rewind_stats;
+static double g_rewind_total_snapshot_ms = 0;
+static u64 g_rewind_snapshots_taken = 0;
+
 // Don't forget to increase this after doing changes on the savestate system
 static const u32 STATE_VERSION = 68;  // Last changed in PR 4638
 
@@ -229,6 +251,120 @@ void VerifyBuffer(std::vector<u8>& buffer)
 	Core::PauseAndLock(false, wasUnpaused);
 }
 
+// The CPU thread can't pause itself with Core::PauseAndLock, but it is not running
+// while it takes a snapshot so only the systems working next to it are stopped.
+static void LockAdjacentSystems(bool do_lock)
+{
+	ExpansionInterface::PauseAndLock(do_lock, false);
+	DSP::GetDSPEmulator()->PauseAndLock(do_lock, false);
+	if (do_lock)
+	{
+		Fifo::SyncGPU(Fifo::SyncGPUReason::Other);
+		Fifo::FlushGpu();
+	}
+}
+
+// Runs at the end of a CoreTiming slice rather than from the VI event that counts the frames:
+// during event processing the VI event is not rescheduled yet and the timer is half updated, so
+// a snapshot taken there loads without a VI event and the game freezes.
+static void TakeRewindSnapshot()
+{
+	// Skip the snapshot if the host is rewinding right now
+	std::unique_lock<std::mutex> lk(g_cs_rewind_buffer, std::try_to_lock);
+	if (!lk.owns_lock())
+		return;
+
+	const SConfig& config = SConfig::GetInstance();
+	const auto start = std::chrono::steady_clock::now();
+	const size_t budget = (size_t)std::max(config.iRewindBufferSize, 1) * 1024 * 1024;
+	if (!g_rewind_buffer)
+		g_rewind_buffer = std::make_unique<RewindBuffer>(budget);
+	else
+		g_rewind_buffer->SetMemoryBudget(budget);
+
+	LockAdjacentSystems(true);
+	u8* ptr = nullptr;
+	PointerWrap p(&ptr, PointerWrap::MODE_MEASURE);
+	DoState(p);
+	g_rewind_scratch.resize(reinterpret_cast<size_t>(ptr));
+	ptr = g_rewind_scratch.data();
+	p.SetMode(PointerWrap::MODE_WRITE);
+	DoState(p);
+	LockAdjacentSystems(false);
+
+	if (p.GetMode() == PointerWrap::MODE_WRITE)
+		g_rewind_buffer->Push(g_rewind_scratch);
+
+	const double elapsed_ms =
+		std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	g_rewind_total_snapshot_ms += elapsed_ms;
+	g_rewind_snapshots_taken++;
+	g_rewind_stats.snapshot_count = (u32)g_rewind_buffer->GetSnapshotCount();
+	g_rewind_stats.memory_usage = g_rewind_buffer->GetMemoryUsage();
+	g_rewind_stats.uncompressed_size = g_rewind_buffer->GetUncompressedSize();
+	g_rewind_stats.last_snapshot_ms = elapsed_ms;
+	g_rewind_stats.average_snapshot_ms = g_rewind_total_snapshot_ms / g_rewind_snapshots_taken;
+}
+
+void UpdateRewind()
+{
+	const SConfig& config = SConfig::GetInstance();
+	if (!config.bRewind)
+	{
+		if (g_rewind_buffer)
+		{
+			std::lock_guard<std::mutex> lk(g_cs_rewind_buffer);
+			g_rewind_buffer.reset();
+			std::vector<u8>().swap(g_rewind_scratch);
+		}
+		return;
+	}
+	if (NetPlay::IsNetPlayRunning() || Movie::IsMovieActive() ||
+		++g_rewind_frames < std::max(config.iRewindInterval, 1))
+	{
+		return;
+	}
+
+	g_rewind_frames = 0;
+	CoreTiming::RunAtSliceEnd(TakeRewindSnapshot);
+}
+
+void Rewind()
+{
+	if (!Core::IsRunning())
+		return;
+
+	std::lock_guard<std::mutex> lk(g_cs_rewind_buffer);
+	if (!g_rewind_buffer || g_rewind_buffer->IsEmpty())
+	{
+		Core::DisplayMessage("Nothing to rewind", 2000);
+		return;
+	}
+
+	const auto start = std::chrono::steady_clock::now();
+	LoadFromBuffer(g_rewind_buffer->GetNewest());
+	g_rewind_stats.last_restore_ms =
+		std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	g_rewind_frames = 0;
+
+	// The emulation is already running again, make the previous snapshot the next one to load
+	g_rewind_buffer->Pop();
+	g_rewind_stats.snapshot_count = (u32)g_rewind_buffer->GetSnapshotCount();
+	g_rewind_stats.memory_usage = g_rewind_buffer->GetMemoryUsage();
+	g_rewind_stats.uncompressed_size = g_rewind_buffer->GetUncompressedSize();
+	Core::DisplayMessage(
+		StringFromFormat("Rewound (%u snapshots left, %.1f MB, %.1fx smaller)",
+			g_rewind_stats.snapshot_count, g_rewind_stats.memory_usage / (1024.0 * 1024.0),
+			(double)g_rewind_stats.uncompressed_size / std::max<u64>(g_rewind_stats.memory_usage, 1)),
+		2000);
+}
+
+RewindStats GetRewindStats()
+{
+	std::lock_guard<std::mutex> lk(g_cs_rewind_buffer);
+	return g_rewind_stats;
+}
+
 // return state number not in map
 static int GetEmptySlot(std::map<double, int> m)
 {
@@ -276,6 +412,91 @@ static std::map<double, int> GetSavedStates()
 	return m;
 }
 
+static size_t GetCompressBound(Compression compression, size_t size)
+{
+	if (compression == COMPRESSION_ZLIB)
+		return compressBound((uLong)size);
+	return size + (size / 16) + 64 + 3;
+}
+
+// Compresses a chunk into out, returns the compressed size or 0 on failure
+static size_t CompressChunk(Compression compression, const u8* data, size_t size, u8* out)
+{
+	if (compression == COMPRESSION_ZLIB)
+	{
+		uLongf out_len = (uLongf)GetCompressBound(compression, size);
+		// Level 1 is still smaller than LZO while keeping saves quick
+		if (compress2(out, &out_len, data, (uLong)size, 1) != Z_OK)
+			return 0;
+		return out_len;
+	}
+
+	thread_local std::unique_ptr<lzo_align_t[]> wrkmem(
+		new lzo_align_t[(LZO1X_1_MEM_COMPRESS + sizeof(lzo_align_t) - 1) / sizeof(lzo_align_t)]);
+	lzo_uint out_len = 0;
+	if (lzo1x_1_compress(data, (lzo_uint)size, out, &out_len, wrkmem.get()) != LZO_E_OK)
+		return 0;
+	return out_len;
+}
+
+static bool DecompressChunk(Compression compression, const u8* data, size_t size, u8* out,
+	size_t out_size)
+{
+	if (compression == COMPRESSION_ZLIB)
+	{
+		uLongf out_len = (uLongf)out_size;
+		return uncompress(out, &out_len, data, (uLong)size) == Z_OK && out_len == out_size;
+	}
+
+	lzo_uint out_len = (lzo_uint)out_size;
+	return lzo1x_decompress_safe(data, (lzo_uint)size, out, &out_len, nullptr) == LZO_E_OK &&
+		out_len == out_size;
+}
+
+static bool WriteChunkedState(File::IOFile& f, Compression compression, const u8* data, size_t size)
+{
+	const u32 chunk_count = (u32)((size + CHUNK_SIZE - 1) / CHUNK_SIZE);
+	const u32 table_header[3] = { CHUNK_TABLE_MAGIC, CHUNK_SIZE, chunk_count };
+	std::vector<u32> sizes(chunk_count);
+	const u64 table_offset = f.Tell();
+	if (!f.WriteArray(table_header, 3) || !f.WriteArray(sizes.data(), sizes.size()))
+		return false;
+
+	const size_t bound = GetCompressBound(compression, CHUNK_SIZE);
+	std::vector<std::vector<u8>> compressed(std::min(chunk_count, CHUNKS_PER_BATCH));
+	for (std::vector<u8>& chunk : compressed)
+		chunk.resize(bound);
+	std::atomic<bool> failed(false);
+	for (u32 first = 0; first < chunk_count; first += CHUNKS_PER_BATCH)
+	{
+		const u32 count = std::min(chunk_count - first, CHUNKS_PER_BATCH);
+		Common::ThreadPool::Loop([&](int lower, int upper) {
+			for (int i = lower; i < upper; i++)
+			{
+				const size_t offset = (size_t)(first + i) * CHUNK_SIZE;
+				const size_t length = std::min<size_t>(CHUNK_SIZE, size - offset);
+				sizes[first + i] = (u32)CompressChunk(compression, data + offset, length, compressed[i].data());
+				if (sizes[first + i] == 0)
+					failed.store(true);
+			}
+		}, 0, count);
+		if (failed.load())
+		{
+			PanicAlertT("Internal error - state compression failed");
+			return false;
+		}
+		for (u32 i = 0; i < count; i++)
+		{
+			if (!f.WriteBytes(compressed[i].data(), sizes[first + i]))
+				return false;
+		}
+	}
+
+	// Now that the sizes are known
+	return f.Seek(table_offset + sizeof(table_header), SEEK_SET) &&
+		f.WriteArray(sizes.data(), sizes.size()) && f.Seek(0, SEEK_END);
+}
+
 struct CompressAndDumpState_args
 {
 	std::vector<u8>* buffer_vector;
@@ -335,8 +556,10 @@ static void CompressAndDumpState(CompressAndDumpState_args save_args)
 	}
 
 	// Setting up the header
-	StateHeader header;
+	StateHeader header = {};
 	strncpy(header.gameID, SConfig::GetInstance().GetGameID().c_str(), 6);
+	header.compression = SConfig::GetInstance().iStateCompression == COMPRESSION_ZLIB ?
+		COMPRESSION_ZLIB : COMPRESSION_LZO;
 	header.size = g_use_compression ? (u32)buffer_size : 0;
 	header.time = Common::Timer::GetDoubleTime();
 
@@ -344,32 +567,12 @@ static void CompressAndDumpState(CompressAndDumpState_args save_args)
 
 	if (header.size != 0)  // non-zero header size means the state is compressed
 	{
-		lzo_uint i = 0;
-		while (true)
+		if (!WriteChunkedState(f, (Compression)header.compression, buffer_data, buffer_size))
 		{
-			lzo_uint32 cur_len = 0;
-			lzo_uint out_len = 0;
-
-			if ((i + IN_LEN) >= buffer_size)
-			{
-				cur_len = (lzo_uint32)(buffer_size - i);
-			}
-			else
-			{
-				cur_len = IN_LEN;
-			}
-
-			if (lzo1x_1_compress(buffer_data + i, cur_len, out, &out_len, wrkmem) != LZO_E_OK)
-				PanicAlertT("Internal LZO Error - compression failed");
-
-			// The size of the data to write is 'out_len'
-			f.WriteArray((lzo_uint32*)&out_len, 1);
-			f.WriteBytes(out, out_len);
-
-			if (cur_len != IN_LEN)
-				break;
-
-			i += cur_len;
+			Core::DisplayMessage("Could not save state", 2000);
+			f.Close();
+			File::Delete(filename);
+			return;
 		}
 	}
 	else  // uncompressed
@@ -454,6 +657,94 @@ std::string GetInfoStringOfSlot(int slot, bool translate)
 	return Common::Timer::GetDateTimeFormatted(header.time);
 }
 
+// Finds the chunks of the state in data and decompresses them in parallel into buffer
+bool DecompressState(const StateHeader& header, const std::vector<u8>& data,
+	std::vector<u8>& buffer)
+{
+	struct Chunk
+	{
+		size_t offset;
+		size_t size;
+	};
+	std::vector<Chunk> chunks;
+	Compression compression = COMPRESSION_LZO;
+	size_t chunk_size = IN_LEN;
+	u32 magic = 0;
+	if (data.size() >= sizeof(u32))
+		memcpy(&magic, data.data(), sizeof(u32));
+
+	if (magic == CHUNK_TABLE_MAGIC)
+	{
+		u32 table_header[3];
+		if (data.size() < sizeof(table_header))
+			return false;
+		memcpy(table_header, data.data(), sizeof(table_header));
+		compression = (Compression)header.compression;
+		chunk_size = table_header[1];
+		const u32 chunk_count = table_header[2];
+		if ((compression != COMPRESSION_LZO && compression != COMPRESSION_ZLIB) || chunk_size == 0 ||
+			(u64)chunk_count * sizeof(u32) > data.size() - sizeof(table_header))
+		{
+			return false;
+		}
+		size_t offset = sizeof(table_header) + chunk_count * sizeof(u32);
+		for (u32 i = 0; i < chunk_count; i++)
+		{
+			u32 size;
+			memcpy(&size, &data[sizeof(table_header) + i * sizeof(u32)], sizeof(u32));
+			chunks.push_back({ offset, size });
+			offset += size;
+		}
+	}
+	else
+	{
+		// Older states, the chunk sizes are spread through the data
+		size_t offset = 0;
+		while (offset + sizeof(u32) <= data.size())
+		{
+			u32 size;
+			memcpy(&size, &data[offset], sizeof(u32));
+			offset += sizeof(u32);
+			chunks.push_back({ offset, size });
+			offset += size;
+		}
+		// The old writer ended states of a multiple of IN_LEN bytes with an empty chunk
+		if (chunks.size() > 1 && (u64)(chunks.size() - 1) * chunk_size == buffer.size() &&
+			chunks.back().offset + chunks.back().size <= data.size())
+		{
+			u8 empty;
+			if (!DecompressChunk(compression, data.data() + chunks.back().offset, chunks.back().size,
+				&empty, 0))
+			{
+				return false;
+			}
+			chunks.pop_back();
+		}
+	}
+
+	// Every chunk but the last one holds chunk_size bytes
+	if (chunks.empty() || (u64)(chunks.size() - 1) * chunk_size >= buffer.size() ||
+		(u64)chunks.size() * chunk_size < buffer.size() ||
+		chunks.back().offset + chunks.back().size > data.size())
+	{
+		return false;
+	}
+	std::atomic<bool> failed(false);
+	Common::ThreadPool::Loop([&](int lower, int upper) {
+		for (int i = lower; i < upper; i++)
+		{
+			const size_t out_offset = (size_t)i * chunk_size;
+			const size_t out_size = std::min(chunk_size, buffer.size() - out_offset);
+			if (!DecompressChunk(compression, &data[chunks[i].offset], chunks[i].size,
+				&buffer[out_offset], out_size))
+			{
+				failed.store(true);
+			}
+		}
+	}, 0, (int)chunks.size());
+	return !failed.load();
+}
+
 static void LoadFileStateData(const std::string& filename, std::vector<u8>& ret_data)
 {
 	Flush();
@@ -480,29 +771,18 @@ static void LoadFileStateData(const std::string& filename, std::vector<u8>& ret_
 	{
 		Core::DisplayMessage("Decompressing State...", 500);
 
+		std::vector<u8> data((size_t)(f.GetSize() - sizeof(StateHeader)));
+		if (!f.ReadBytes(data.data(), data.size()))
+		{
+			PanicAlert("wtf? reading bytes: %zu", data.size());
+			return;
+		}
 		buffer.resize(header.size);
-
-		lzo_uint i = 0;
-		while (true)
+		if (!DecompressState(header, data, buffer))
 		{
-			lzo_uint32 cur_len = 0;  // number of bytes to read
-			lzo_uint new_len = 0;    // number of bytes to write
-
-			if (!f.ReadArray(&cur_len, 1))
-				break;
-
-			f.ReadBytes(out, cur_len);
-			const int res = lzo1x_decompress(out, cur_len, &buffer[i], &new_len, nullptr);
-			if (res != LZO_E_OK)
-			{
-				// This doesn't seem to happen anymore.
-				PanicAlertT("Internal LZO Error - decompression failed (%d) (%li, %li) \n"
-					"Try loading the state again",
-					res, i, new_len);
-				return;
-			}
-
-			i += new_len;
+			PanicAlertT("Internal error - state decompression failed\n"
+				"Try loading the state again");
+			return;
 		}
 	}
 	else  // uncompressed
@@ -650,6 +930,16 @@ void Shutdown()
 		std::lock_guard<std::mutex> lk(g_cs_undo_load_buffer);
 		std::vector<u8>().swap(g_undo_load_buffer);
 	}
+
+	{
+		std::lock_guard<std::mutex> lk(g_cs_rewind_buffer);
+		g_rewind_buffer.reset();
+		std::vector<u8>().swap(g_rewind_scratch);
+		g_rewind_frames = 0;
+		g_rewind_stats = {};
+		g_rewind_total_snapshot_ms = 0;
+		g_rewind_snapshots_taken = 0;
+	}
 }
 
 static std::string MakeStateFilename(int number)
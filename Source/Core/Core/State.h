@@ -16,9 +16,20 @@ namespace State
 // number of states
 static const u32 NUM_STATES = 10;
 
+// Codec of the state data, stored in the header of chunked states
+enum Compression : u8
+{
+	COMPRESSION_LZO = 1,
+	// Smaller states, slower to save
+	COMPRESSION_ZLIB = 2,
+};
+
 struct StateHeader
 {
 	char gameID[6];
+	// Used to be padding, only valid if the data starts with the chunk table
+	u8 compression;
+	u8 reserved;
 	u32 size;
 	double time;
 };
@@ -30,6 +41,10 @@ void Shutdown();
 void EnableCompression(bool compression);
 
 bool ReadHeader(const std::string& filename, StateHeader& header);
+// Decompresses the data following the header of a compressed state into buffer, which holds
+// header.size bytes. Reads both the chunked and the older LZO stream states.
+bool DecompressState(const StateHeader& header, const std::vector<u8>& data,
+	std::vector<u8>& buffer);
 
 // Returns a string containing information of the savestate in the given slot
 // which can be presented to the user for identification purposes
@@ -52,6 +67,24 @@ void SaveToBuffer(std::vector<u8>& buffer);
 void LoadFromBuffer(std::vector<u8>& buffer);
 void VerifyBuffer(std::vector<u8>& buffer);
 
+struct RewindStats
+{
+	u32 snapshot_count;
+	// Memory used by the history and what it would use without the deltas
+	u64 memory_usage;
+	u64 uncompressed_size;
+	double last_snapshot_ms;
+	double average_snapshot_ms;
+	double last_restore_ms;
+};
+
+// Called by the CPU thread once per frame, the rewind snapshots are taken at the end of the
+// CoreTiming slice
+void UpdateRewind();
+// Loads the newest rewind snapshot, the next call goes further back
+void Rewind();
+RewindStats GetRewindStats();
+
 void LoadLastSaved(int i = 1);
 void SaveFirstSaved();
 void UndoSaveState();
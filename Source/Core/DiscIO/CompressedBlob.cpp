@@ -8,11 +8,15 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
 #include <cinttypes>
+#include <condition_variable>
 #include <cstdio>
 #include <cstring>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 #include <zlib.h>
@@ -23,6 +27,7 @@
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Common/StringUtil.h"
+#include "Common/ThreadPool.h"
 #include "DiscIO/Blob.h"
 #include "DiscIO/CompressedBlob.h"
 #include "DiscIO/DiscScrubber.h"
@@ -31,8 +36,39 @@ namespace DiscIO
 {
 bool IsGCZBlob(File::IOFile& file);
 
+// Keeps the zlib state of a thread around so it is only reset between blocks
+class ZlibInflater
+{
+public:
+  ZlibInflater() { m_initialized = inflateInit(&m_z) == Z_OK; }
+  ~ZlibInflater()
+  {
+    if (m_initialized)
+      inflateEnd(&m_z);
+  }
+
+  // Inflates a whole block, returns the zlib status and the number of bytes written
+  int Inflate(const u8* in_ptr, u32 in_size, u8* out_ptr, u32 out_size, u32* written)
+  {
+    *written = 0;
+    if (!m_initialized || inflateReset(&m_z) != Z_OK)
+      return Z_STREAM_ERROR;
+    m_z.next_in = const_cast<u8*>(in_ptr);
+    m_z.avail_in = in_size;
+    m_z.next_out = out_ptr;
+    m_z.avail_out = out_size;
+    int status = inflate(&m_z, Z_FINISH);
+    *written = out_size - m_z.avail_out;
+    return status;
+  }
+
+private:
+  z_stream m_z = {};
+  bool m_initialized;
+};
+
 CompressedBlobReader::CompressedBlobReader(File::IOFile file, const std::string& filename)
-    : m_file(std::move(file)), m_file_name(filename)
+    : m_file(std::move(file)), m_file_name(filename), m_inflater(std::make_unique<ZlibInflater>())
 {
   m_file_size = m_file.GetSize();
   m_file.Seek(0, SEEK_SET);
@@ -55,6 +91,12 @@ CompressedBlobReader::CompressedBlobReader(File::IOFile file, const std::string&
   // I still add some safety margin.
   const u32 zlib_buffer_size = m_header.block_size + 64;
   m_zlib_buffer.resize(zlib_buffer_size);
+
+  // Reading ahead only pays off when there are workers to inflate the blocks
+  const u32 block_size = std::max<u32>(m_header.block_size, 1);
+  if (Common::ThreadPool::WorkerCount() > 0)
+    m_read_ahead_blocks = std::max<u32>(READ_AHEAD_BYTES / block_size, 4);
+  m_cache_blocks = std::max<u32>({CACHE_BYTES / block_size, m_read_ahead_blocks * 2, 16});
 }
 
 std::unique_ptr<CompressedBlobReader> CompressedBlobReader::Create(File::IOFile file,
@@ -84,22 +126,70 @@ u64 CompressedBlobReader::GetBlockCompressedSize(u64 block_num) const
   return 0;
 }
 
+u64 CompressedBlobReader::GetBlockOffset(u64 block_num) const
+{
+  return (m_block_pointers[block_num] & ~(1ULL << 63)) + m_data_offset;
+}
+
 bool CompressedBlobReader::GetBlock(u64 block_num, u8* out_ptr)
 {
-  bool uncompressed = false;
-  u32 comp_block_size = (u32)GetBlockCompressedSize(block_num);
-  u64 offset = m_block_pointers[block_num] + m_data_offset;
+  const u32 block_size = m_header.block_size;
+
+  // Sequential reads (streamed audio and movies mostly) keep a window of blocks
+  // ahead of the current one inflating on the worker threads. The window starts
+  // small so short reads at random places don't inflate blocks nobody asks for.
+  const bool sequential = block_num == m_next_sequential_block;
+  m_next_sequential_block = block_num + 1;
+  m_sequential_blocks = sequential ? m_sequential_blocks + 1 : 0;
+  const u64 window = std::min<u64>(m_read_ahead_blocks, m_sequential_blocks * 2);
+  if (!sequential)
+  {
+    m_read_ahead_end = 0;
+  }
+  else if (window > 0 && m_read_ahead_end < block_num + 1 + window / 2)
+  {
+    const u64 first = std::max(m_read_ahead_end, block_num + 1);
+    const u64 last = std::min<u64>(block_num + 1 + window, m_header.num_blocks);
+    if (first < last)
+      ReadAhead(first, last);
+    m_read_ahead_end = std::max(first, last);
+  }
 
-  if (offset & (1ULL << 63))
+  auto iter = m_cache.find(block_num);
+  if (iter != m_cache.end())
   {
-    if (comp_block_size != m_header.block_size)
-      PanicAlert("Uncompressed block with wrong size");
-    uncompressed = true;
-    offset &= ~(1ULL << 63);
+    std::shared_ptr<CachedBlock> block = iter->second.block;
+    if (FinishCachedBlock(*block, *m_inflater, block_size))
+    {
+      m_cache_lru.splice(m_cache_lru.begin(), m_cache_lru, iter->second.lru_iter);
+      std::copy(block->data.begin(), block->data.end(), out_ptr);
+      return true;
+    }
+    // Read it again below so the error gets reported
+    m_cache_lru.erase(iter->second.lru_iter);
+    m_cache.erase(iter);
   }
 
-  // clear unused part of zlib buffer. maybe this can be deleted when it works fully.
-  memset(&m_zlib_buffer[comp_block_size], 0, m_zlib_buffer.size() - comp_block_size);
+  std::shared_ptr<CachedBlock> block = std::make_shared<CachedBlock>();
+  block->data.resize(block_size);
+  if (!ReadCompressedBlock(block_num, block->data.data()))
+    return false;
+  block->state.store(CachedBlock::READY);
+  std::copy(block->data.begin(), block->data.end(), out_ptr);
+  InsertCachedBlock(block_num, std::move(block));
+  return true;
+}
+
+bool CompressedBlobReader::ReadCompressedBlock(u64 block_num, u8* out_ptr)
+{
+  u32 comp_block_size = (u32)GetBlockCompressedSize(block_num);
+  u64 offset = GetBlockOffset(block_num);
+
+  if (comp_block_size > m_zlib_buffer.size())
+  {
+    PanicAlert("We have a problem");
+    return false;
+  }
 
   m_file.Seek(offset, SEEK_SET);
   if (!m_file.ReadBytes(m_zlib_buffer.data(), comp_block_size))
@@ -117,42 +207,181 @@ bool CompressedBlobReader::GetBlock(u64 block_num, u8* out_ptr)
                 "Hash of block %" PRIu64 " is %08x instead of %08x.",
                 m_file_name.c_str(), block_num, block_hash, m_hashes[block_num]);
 
-  if (uncompressed)
+  return DecompressBlock(block_num, m_zlib_buffer.data(), comp_block_size, out_ptr);
+}
+
+bool CompressedBlobReader::DecompressBlock(u64 block_num, const u8* in_ptr, u32 in_size,
+                                           u8* out_ptr)
+{
+  if (m_block_pointers[block_num] & (1ULL << 63))
   {
-    std::copy(m_zlib_buffer.begin(), m_zlib_buffer.begin() + comp_block_size, out_ptr);
+    if (in_size != m_header.block_size)
+      PanicAlert("Uncompressed block with wrong size");
+    std::copy(in_ptr, in_ptr + std::min(in_size, m_header.block_size), out_ptr);
+    return true;
   }
-  else
+
+  u32 uncomp_size;
+  int status = m_inflater->Inflate(in_ptr, in_size, out_ptr, m_header.block_size, &uncomp_size);
+  if (status != Z_STREAM_END)
+  {
+    // this seem to fire wrongly from time to time
+    // to be sure, don't use compressed isos :P
+    PanicAlert("Failure reading block %" PRIu64 " - out of data and not at end.", block_num);
+  }
+  if (uncomp_size != m_header.block_size)
+  {
+    PanicAlert("Wrong block size");
+    return false;
+  }
+  return true;
+}
+
+bool CompressedBlobReader::FinishCachedBlock(CachedBlock& block, ZlibInflater& inflater,
+                                             u32 block_size)
+{
+  int expected = CachedBlock::PENDING;
+  if (block.state.compare_exchange_strong(expected, CachedBlock::CLAIMED))
+  {
+    bool success = HashAdler32(block.compressed.data(), block.compressed.size()) == block.hash;
+    if (success && block.uncompressed)
+    {
+      success = block.compressed.size() == block_size;
+      if (success)
+        block.data.swap(block.compressed);
+    }
+    else if (success)
+    {
+      block.data.resize(block_size);
+      u32 written;
+      int status = inflater.Inflate(block.compressed.data(), (u32)block.compressed.size(),
+                                    block.data.data(), block_size, &written);
+      success = status == Z_STREAM_END && written == block_size;
+    }
+    std::vector<u8>().swap(block.compressed);
+    block.state.store(success ? CachedBlock::READY : CachedBlock::FAILED);
+    return success;
+  }
+  // A worker is on it, it only takes the time of a single block
+  while (block.state.load() == CachedBlock::CLAIMED)
+    Common::YieldCPU();
+  return block.state.load() == CachedBlock::READY;
+}
+
+void CompressedBlobReader::InsertCachedBlock(u64 block_num, std::shared_ptr<CachedBlock> block)
+{
+  while (m_cache.size() >= m_cache_blocks && !m_cache_lru.empty())
+  {
+    m_cache.erase(m_cache_lru.back());
+    m_cache_lru.pop_back();
+  }
+  CacheEntry& entry = m_cache[block_num];
+  entry.block = std::move(block);
+  entry.lru_iter = m_cache_lru.insert(m_cache_lru.begin(), block_num);
+}
+
+void CompressedBlobReader::ReadAhead(u64 first_block, u64 last_block)
+{
+  const u32 block_size = m_header.block_size;
+  const size_t job_blocks = std::max<size_t>(JOB_BYTES / std::max<u32>(block_size, 1), 1);
+  std::vector<std::shared_ptr<CachedBlock>> job;
+  std::vector<u8> buffer;
+  auto submit_job = [&job, block_size] {
+    Common::AsyncWorker::ExecuteAsync([job, block_size] {
+      thread_local ZlibInflater inflater;
+      for (const auto& block : job)
+        FinishCachedBlock(*block, inflater, block_size);
+    });
+    job.clear();
+  };
+
+  u64 block_num = first_block;
+  while (block_num < last_block)
   {
-    z_stream z = {};
-    z.next_in = m_zlib_buffer.data();
-    z.avail_in = comp_block_size;
-    if (z.avail_in > m_header.block_size)
+    if (m_cache.count(block_num))
     {
-      PanicAlert("We have a problem");
+      block_num++;
+      continue;
     }
-    z.next_out = out_ptr;
-    z.avail_out = m_header.block_size;
-    inflateInit(&z);
-    int status = inflate(&z, Z_FULL_FLUSH);
-    u32 uncomp_size = m_header.block_size - z.avail_out;
-    if (status != Z_STREAM_END)
+    // Blocks are stored back to back, each run of missing blocks takes a single read
+    u64 run_end = block_num + 1;
+    while (run_end < last_block && !m_cache.count(run_end))
+      run_end++;
+    const u64 start = GetBlockOffset(block_num);
+    const u64 end = GetBlockOffset(run_end - 1) + (u32)GetBlockCompressedSize(run_end - 1);
+    buffer.resize((size_t)(end - start));
+    m_file.Seek(start, SEEK_SET);
+    if (end < start || !m_file.ReadBytes(buffer.data(), buffer.size()))
     {
-      // this seem to fire wrongly from time to time
-      // to be sure, don't use compressed isos :P
-      PanicAlert("Failure reading block %" PRIu64 " - out of data and not at end.", block_num);
+      // Left to the synchronous path, which reports the error
+      m_file.Clear();
+      return;
     }
-    inflateEnd(&z);
-    if (uncomp_size != m_header.block_size)
+
+    for (; block_num < run_end; block_num++)
     {
-      PanicAlert("Wrong block size");
-      return false;
+      const u64 offset = GetBlockOffset(block_num) - start;
+      const u32 size = (u32)GetBlockCompressedSize(block_num);
+      std::shared_ptr<CachedBlock> block = std::make_shared<CachedBlock>();
+      block->uncompressed = (m_block_pointers[block_num] & (1ULL << 63)) != 0;
+      block->hash = m_hashes[block_num];
+      block->compressed.assign(buffer.begin() + offset, buffer.begin() + offset + size);
+      InsertCachedBlock(block_num, block);
+      job.push_back(std::move(block));
+      if (job.size() == job_blocks)
+        submit_job();
     }
   }
+  if (!job.empty())
+    submit_job();
+}
+
+namespace
+{
+// A block on its way from the reader thread to the writer in CompressFileToBlob
+struct CompressionSlot
+{
+  enum State
+  {
+    FREE,
+    READ,
+    COMPRESSED,
+  };
+  State state = FREE;
+  u32 block = 0;
+  std::vector<u8> in_buf;
+  std::vector<u8> out_buf;
+  // Points into in_buf for stored blocks, out_buf otherwise
+  const u8* write_buf = nullptr;
+  u32 write_size = 0;
+  bool stored = false;
+  u32 hash = 0;
+};
+}
+
+static bool CompressBlock(z_stream& z, CompressionSlot& slot, u32 block_size)
+{
+  if (deflateReset(&z) != Z_OK)
+    return false;
+  z.next_in = slot.in_buf.data();
+  z.avail_in = block_size;
+  z.next_out = slot.out_buf.data();
+  z.avail_out = block_size;
+
+  int status = deflate(&z, Z_FINISH);
+  u32 comp_size = block_size - z.avail_out;
+
+  // Blocks that barely compress are stored as they are
+  slot.stored = (status != Z_STREAM_END) || (z.avail_out < 10);
+  slot.write_buf = slot.stored ? slot.in_buf.data() : slot.out_buf.data();
+  slot.write_size = slot.stored ? block_size : comp_size;
+  slot.hash = HashAdler32(slot.write_buf, slot.write_size);
   return true;
 }
 
 bool CompressFileToBlob(const std::string& infile_path, const std::string& outfile_path,
-                        u32 sub_type, int block_size, CompressCB callback, void* arg)
+                        u32 sub_type, int block_size, CompressCB callback, void* arg,
+                        u32 num_workers)
 {
   bool scrubbing = false;
 
@@ -192,11 +421,9 @@ bool CompressFileToBlob(const std::string& infile_path, const std::string& outfi
     scrubbing = true;
   }
 
-  z_stream z = {};
-  if (deflateInit(&z, 9) != Z_OK)
-    return false;
-
   callback(GetStringT("Files opened, ready to compress."), 0, arg);
+  // IsGCZBlob left the read position after the GCZ header
+  infile.Seek(0, SEEK_SET);
 
   CompressedBlobHeader header;
   header.magic_cookie = GCZ_MAGIC;
@@ -209,14 +436,95 @@ bool CompressFileToBlob(const std::string& infile_path, const std::string& outfi
 
   std::vector<u64> offsets(header.num_blocks);
   std::vector<u32> hashes(header.num_blocks);
-  std::vector<u8> out_buf(block_size);
-  std::vector<u8> in_buf(block_size);
 
   // seek past the header (we will write it at the end)
   outfile.Seek(sizeof(CompressedBlobHeader), SEEK_CUR);
   // seek past the offset and hash tables (we will write them at the end)
   outfile.Seek((sizeof(u64) + sizeof(u32)) * header.num_blocks, SEEK_CUR);
 
+  // Blocks go through a reader thread, the compression workers and finally this
+  // thread, which writes them in order and reports the progress. Every block is
+  // deflated on its own, so the output does not depend on which worker took it.
+  if (num_workers == 0)
+    num_workers = std::max(std::thread::hardware_concurrency(), 1u);
+  std::vector<CompressionSlot> slots(num_workers * 4);
+  for (CompressionSlot& slot : slots)
+  {
+    slot.in_buf.resize(block_size);
+    slot.out_buf.resize(block_size);
+  }
+  std::mutex mutex;
+  std::condition_variable cond;
+  bool abort = false;
+  bool deflate_failed = false;
+  std::atomic<u32> next_block{0};
+
+  std::thread reader([&] {
+    for (u32 i = 0; i < header.num_blocks; i++)
+    {
+      CompressionSlot& slot = slots[i % slots.size()];
+      {
+        std::unique_lock<std::mutex> lk(mutex);
+        cond.wait(lk, [&] { return abort || slot.state == CompressionSlot::FREE; });
+        if (abort)
+          return;
+      }
+
+      size_t read_bytes;
+      if (scrubbing)
+        read_bytes = disc_scrubber.GetNextBlock(infile, slot.in_buf.data());
+      else
+        infile.ReadArray(slot.in_buf.data(), header.block_size, &read_bytes);
+      if (read_bytes < header.block_size)
+        std::fill(slot.in_buf.begin() + read_bytes, slot.in_buf.begin() + header.block_size, 0);
+
+      {
+        std::lock_guard<std::mutex> lk(mutex);
+        slot.block = i;
+        slot.state = CompressionSlot::READ;
+      }
+      cond.notify_all();
+    }
+  });
+
+  std::vector<std::thread> workers;
+  for (u32 w = 0; w < num_workers; w++)
+  {
+    workers.emplace_back([&] {
+      z_stream z = {};
+      bool ok = deflateInit(&z, 9) == Z_OK;
+      while (ok)
+      {
+        const u32 i = next_block.fetch_add(1);
+        if (i >= header.num_blocks)
+          break;
+        CompressionSlot& slot = slots[i % slots.size()];
+        {
+          std::unique_lock<std::mutex> lk(mutex);
+          cond.wait(lk, [&] {
+            return abort || (slot.state == CompressionSlot::READ && slot.block == i);
+          });
+          if (abort)
+            break;
+        }
+        ok = CompressBlock(z, slot, block_size);
+        {
+          std::lock_guard<std::mutex> lk(mutex);
+          if (ok)
+            slot.state = CompressionSlot::COMPRESSED;
+        }
+        cond.notify_all();
+      }
+      deflateEnd(&z);
+      if (!ok)
+      {
+        std::lock_guard<std::mutex> lk(mutex);
+        deflate_failed = true;
+        cond.notify_all();
+      }
+    });
+  }
+
   // Now we are ready to write compressed data!
   u64 position = 0;
   int num_compressed = 0;
@@ -228,7 +536,7 @@ bool CompressFileToBlob(const std::string& infile_path, const std::string& outfi
   {
     if (i % progress_monitor == 0)
     {
-      const u64 inpos = infile.Tell();
+      const u64 inpos = (u64)i * block_size;
       int ratio = 0;
       if (inpos != 0)
         ratio = (int)(100 * position / inpos);
@@ -244,53 +552,32 @@ bool CompressFileToBlob(const std::string& infile_path, const std::string& outfi
       }
     }
 
-    offsets[i] = position;
-
-    size_t read_bytes;
-    if (scrubbing)
-      read_bytes = disc_scrubber.GetNextBlock(infile, in_buf.data());
-    else
-      infile.ReadArray(in_buf.data(), header.block_size, &read_bytes);
-    if (read_bytes < header.block_size)
-      std::fill(in_buf.begin() + read_bytes, in_buf.begin() + header.block_size, 0);
-
-    int retval = deflateReset(&z);
-    z.next_in = in_buf.data();
-    z.avail_in = header.block_size;
-    z.next_out = out_buf.data();
-    z.avail_out = block_size;
-
-    if (retval != Z_OK)
+    CompressionSlot& slot = slots[i % slots.size()];
     {
-      ERROR_LOG(DISCIO, "Deflate failed");
-      success = false;
-      break;
+      std::unique_lock<std::mutex> lk(mutex);
+      cond.wait(lk, [&] {
+        return deflate_failed || (slot.state == CompressionSlot::COMPRESSED && slot.block == i);
+      });
+      if (deflate_failed)
+      {
+        ERROR_LOG(DISCIO, "Deflate failed");
+        success = false;
+        break;
+      }
     }
 
-    int status = deflate(&z, Z_FINISH);
-    int comp_size = block_size - z.avail_out;
-
-    u8* write_buf;
-    int write_size;
-    if ((status != Z_STREAM_END) || (z.avail_out < 10))
+    offsets[i] = position;
+    if (slot.stored)
     {
-      // PanicAlert("%i %i Store %i", i*block_size, position, comp_size);
-      // let's store uncompressed
-      write_buf = in_buf.data();
       offsets[i] |= 0x8000000000000000ULL;
-      write_size = block_size;
       num_stored++;
     }
     else
     {
-      // let's store compressed
-      // PanicAlert("Comp %i to %i", block_size, comp_size);
-      write_buf = out_buf.data();
-      write_size = comp_size;
       num_compressed++;
     }
 
-    if (!outfile.WriteBytes(write_buf, write_size))
+    if (!outfile.WriteBytes(slot.write_buf, slot.write_size))
     {
       PanicAlertT("Failed to write the output file \"%s\".\n"
                   "Check that you have enough space available on the target drive.",
@@ -299,10 +586,25 @@ bool CompressFileToBlob(const std::string& infile_path, const std::string& outfi
       break;
     }
 
-    position += write_size;
+    position += slot.write_size;
+
+    hashes[i] = slot.hash;
 
-    hashes[i] = HashAdler32(write_buf, write_size);
+    {
+      std::lock_guard<std::mutex> lk(mutex);
+      slot.state = CompressionSlot::FREE;
+    }
+    cond.notify_all();
+  }
+
+  {
+    std::lock_guard<std::mutex> lk(mutex);
+    abort = true;
   }
+  cond.notify_all();
+  reader.join();
+  for (std::thread& worker : workers)
+    worker.join();
 
   header.compressed_data_size = position;
 
@@ -321,9 +623,6 @@ bool CompressFileToBlob(const std::string& infile_path, const std::string& outfi
     outfile.WriteArray(hashes.data(), header.num_blocks);
   }
 
-  // Cleanup
-  deflateEnd(&z);
-
   if (success)
   {
     callback(GetStringT("Done compressing disc image."), 1.0f, arg);
@@ -13,8 +13,11 @@
 
 #pragma once
 
+#include <atomic>
+#include <list>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "Common/CommonTypes.h"
@@ -41,6 +44,8 @@ struct CompressedBlobHeader  // 32 bytes
   u32 num_blocks;
 };
 
+class ZlibInflater;
+
 class CompressedBlobReader : public SectorReader
 {
 public:
@@ -55,8 +60,46 @@ public:
   bool GetBlock(u64 block_num, u8* out_ptr) override;
 
 private:
+  // A decompressed block, either in the cache or still being inflated by a worker.
+  // Workers only hold on to the block itself, never to the reader.
+  struct CachedBlock
+  {
+    enum State
+    {
+      PENDING,
+      CLAIMED,
+      READY,
+      FAILED,
+    };
+    std::atomic<int> state{PENDING};
+    bool uncompressed = false;
+    u32 hash = 0;
+    std::vector<u8> compressed;
+    std::vector<u8> data;
+  };
+  struct CacheEntry
+  {
+    std::shared_ptr<CachedBlock> block;
+    std::list<u64>::iterator lru_iter;
+  };
+
   CompressedBlobReader(File::IOFile file, const std::string& filename);
 
+  u64 GetBlockOffset(u64 block_num) const;
+  bool ReadCompressedBlock(u64 block_num, u8* out_ptr);
+  bool DecompressBlock(u64 block_num, const u8* in_ptr, u32 in_size, u8* out_ptr);
+  // Inflates a block that was read ahead if no worker picked it up yet,
+  // otherwise waits for the worker. Returns false if the block failed.
+  static bool FinishCachedBlock(CachedBlock& block, ZlibInflater& inflater, u32 block_size);
+  void InsertCachedBlock(u64 block_num, std::shared_ptr<CachedBlock> block);
+  void ReadAhead(u64 first_block, u64 last_block);
+
+  // Budget of the decompressed block cache and size of the read-ahead window
+  static constexpr u32 CACHE_BYTES = 16 * 1024 * 1024;
+  static constexpr u32 READ_AHEAD_BYTES = 2 * 1024 * 1024;
+  // Blocks handed to a worker per job
+  static constexpr u32 JOB_BYTES = 256 * 1024;
+
   CompressedBlobHeader m_header;
   std::vector<u64> m_block_pointers;
   std::vector<u32> m_hashes;
@@ -65,6 +108,17 @@ private:
   u64 m_file_size;
   std::vector<u8> m_zlib_buffer;
   std::string m_file_name;
+  std::unique_ptr<ZlibInflater> m_inflater;
+
+  std::unordered_map<u64, CacheEntry> m_cache;
+  // Most recently used blocks at the front
+  std::list<u64> m_cache_lru;
+  u32 m_cache_blocks = 0;
+  u32 m_read_ahead_blocks = 0;
+  u64 m_next_sequential_block = 0;
+  // Length of the current run of sequential blocks, the window grows with it
+  u64 m_sequential_blocks = 0;
+  u64 m_read_ahead_end = 0;
 };
 
 }  // namespace
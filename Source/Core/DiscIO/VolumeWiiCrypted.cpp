@@ -14,6 +14,7 @@
 
 #include "Common/CommonFuncs.h"
 #include "Common/CommonTypes.h"
+#include "Common/Crypto/AES.h"
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "DiscIO/Blob.h"
@@ -30,19 +31,28 @@ namespace DiscIO
 CVolumeWiiCrypted::CVolumeWiiCrypted(std::unique_ptr<IBlobReader> reader, u64 _VolumeOffset,
 	const unsigned char* _pVolumeKey)
 	: m_pReader(std::move(reader)), m_AES_ctx(std::make_unique<mbedtls_aes_context>()),
-	m_VolumeOffset(_VolumeOffset), m_dataOffset(0x20000), m_LastDecryptedBlockOffset(-1)
+	m_use_aesni(Common::AES::HasHardwareSupport()), m_VolumeOffset(_VolumeOffset),
+	m_dataOffset(0x20000), m_cache(s_cache_clusters), m_cache_tick(0),
+	m_read_buffer(s_batch_clusters * s_block_total_size)
 {
-	mbedtls_aes_setkey_dec(m_AES_ctx.get(), _pVolumeKey, 128);
+	SetKey(_pVolumeKey);
+}
+
+void CVolumeWiiCrypted::SetKey(const u8* volume_key)
+{
+	mbedtls_aes_setkey_dec(m_AES_ctx.get(), volume_key, 128);
+	if (m_use_aesni)
+		Common::AES::ExpandDecryptionKey(volume_key, m_round_keys.data());
 }
 
 bool CVolumeWiiCrypted::ChangePartition(u64 offset)
 {
 	m_VolumeOffset = offset;
-	m_LastDecryptedBlockOffset = -1;
+	ClearCache();
 
 	u8 volume_key[16];
 	DiscIO::VolumeKeyForPartition(*m_pReader, offset, volume_key);
-	mbedtls_aes_setkey_dec(m_AES_ctx.get(), volume_key, 128);
+	SetKey(volume_key);
 	return true;
 }
 
@@ -50,6 +60,81 @@ CVolumeWiiCrypted::~CVolumeWiiCrypted()
 {
 }
 
+void CVolumeWiiCrypted::ClearCache() const
+{
+	for (CachedCluster& cluster : m_cache)
+		cluster.block = UINT64_MAX;
+	m_cache_index.clear();
+}
+
+void CVolumeWiiCrypted::DecryptCluster(const u8* raw, u8* out) const
+{
+	// The only thing we currently use from the 0x000 - 0x3FF part
+	// of the block is the IV (at 0x3D0), but it also contains SHA-1
+	// hashes that IOS uses to check that discs aren't tampered with.
+	// http://wiibrew.org/wiki/Wii_Disc#Encrypted
+	const u8* iv = &raw[0x3D0];
+	if (m_use_aesni)
+	{
+		Common::AES::DecryptCBC(m_round_keys.data(), iv, &raw[s_block_header_size], out,
+			s_block_data_size);
+	}
+	else
+	{
+		// mbedtls updates the IV as it goes
+		u8 iv_copy[16];
+		memcpy(iv_copy, iv, sizeof(iv_copy));
+		mbedtls_aes_crypt_cbc(m_AES_ctx.get(), MBEDTLS_AES_DECRYPT, s_block_data_size,
+			iv_copy, &raw[s_block_header_size], out);
+	}
+}
+
+const CVolumeWiiCrypted::CachedCluster* CVolumeWiiCrypted::GetCluster(u64 block, u64 last_block) const
+{
+	auto iter = m_cache_index.find(block);
+	if (iter != m_cache_index.end())
+	{
+		iter->second->last_use = ++m_cache_tick;
+		return iter->second;
+	}
+
+	// Clusters are stored back to back, so a run of missing ones takes a single read
+	u64 count = 1;
+	while (count < s_batch_clusters && block + count <= last_block &&
+		m_cache_index.find(block + count) == m_cache_index.end())
+	{
+		count++;
+	}
+	if (!m_pReader->Read(m_VolumeOffset + m_dataOffset + block * s_block_total_size,
+		count * s_block_total_size, m_read_buffer.data()))
+	{
+		return nullptr;
+	}
+
+	CachedCluster* first = nullptr;
+	for (u64 i = 0; i < count; i++)
+	{
+		// The clusters of this run get the newest ticks, so they never evict each other
+		CachedCluster* victim = &m_cache[0];
+		for (CachedCluster& cluster : m_cache)
+		{
+			if (cluster.last_use < victim->last_use)
+				victim = &cluster;
+		}
+		if (victim->block != UINT64_MAX)
+			m_cache_index.erase(victim->block);
+		DecryptCluster(&m_read_buffer[i * s_block_total_size], victim->data.data());
+		victim->block = block + i;
+		victim->last_use = ++m_cache_tick;
+		m_cache_index[victim->block] = victim;
+		if (i == 0)
+			first = victim;
+	}
+	// The requested cluster is the one used first
+	first->last_use = ++m_cache_tick;
+	return first;
+}
+
 bool CVolumeWiiCrypted::Read(u64 _ReadOffset, u64 _Length, u8* _pBuffer, bool decrypt) const
 {
 	if (m_pReader == nullptr)
@@ -60,39 +145,23 @@ bool CVolumeWiiCrypted::Read(u64 _ReadOffset, u64 _Length, u8* _pBuffer, bool de
 
 	FileMon::FindFilename(_ReadOffset);
 
-	std::vector<u8> read_buffer(s_block_total_size);
+	if (_Length == 0)
+		return true;
+	const u64 last_block = (_ReadOffset + _Length - 1) / s_block_data_size;
 	while (_Length > 0)
 	{
 		// Calculate block offset
 		u64 Block = _ReadOffset / s_block_data_size;
 		u64 Offset = _ReadOffset % s_block_data_size;
 
-		if (m_LastDecryptedBlockOffset != Block)
-		{
-			// Read the current block
-			if (!m_pReader->Read(m_VolumeOffset + m_dataOffset + Block * s_block_total_size,
-				s_block_total_size, read_buffer.data()))
-				return false;
-
-			// Decrypt the block's data.
-			// 0x3D0 - 0x3DF in m_pBuffer will be overwritten,
-			// but that won't affect anything, because we won't
-			// use the content of m_pBuffer anymore after this
-			mbedtls_aes_crypt_cbc(m_AES_ctx.get(), MBEDTLS_AES_DECRYPT, s_block_data_size,
-				&read_buffer[0x3D0], &read_buffer[s_block_header_size],
-				m_LastDecryptedBlock);
-			m_LastDecryptedBlockOffset = Block;
-
-			// The only thing we currently use from the 0x000 - 0x3FF part
-			// of the block is the IV (at 0x3D0), but it also contains SHA-1
-			// hashes that IOS uses to check that discs aren't tampered with.
-			// http://wiibrew.org/wiki/Wii_Disc#Encrypted
-		}
+		const CachedCluster* cluster = GetCluster(Block, last_block);
+		if (!cluster)
+			return false;
 
 		// Copy the decrypted data
 		u64 MaxSizeToCopy = s_block_data_size - Offset;
 		u64 CopySize = (_Length > MaxSizeToCopy) ? MaxSizeToCopy : _Length;
-		memcpy(_pBuffer, &m_LastDecryptedBlock[Offset], (size_t)CopySize);
+		memcpy(_pBuffer, &cluster->data[Offset], (size_t)CopySize);
 
 		// Update offsets
 		_Length -= CopySize;
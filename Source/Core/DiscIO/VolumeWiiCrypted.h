@@ -4,10 +4,12 @@
 
 #pragma once
 
+#include <array>
 #include <map>
 #include <mbedtls/aes.h>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "Common/CommonTypes.h"
@@ -55,15 +57,37 @@ private:
 	static const unsigned int s_block_header_size = 0x0400;
 	static const unsigned int s_block_data_size = 0x7C00;
 	static const unsigned int s_block_total_size = s_block_header_size + s_block_data_size;
+	// Decrypted clusters kept around (2 MB), enough for a few files streaming at once
+	static const unsigned int s_cache_clusters = 64;
+	// Longest run of clusters read and decrypted in one go
+	static const unsigned int s_batch_clusters = 16;
+
+	struct CachedCluster
+	{
+		u64 block = UINT64_MAX;
+		u64 last_use = 0;
+		std::array<u8, s_block_data_size> data;
+	};
+
+	void SetKey(const u8* volume_key);
+	void ClearCache() const;
+	// Returns the decrypted cluster, reading and decrypting it together with the
+	// following ones up to last_block if it is not cached
+	const CachedCluster* GetCluster(u64 block, u64 last_block) const;
+	void DecryptCluster(const u8* raw, u8* out) const;
 
 	std::unique_ptr<IBlobReader> m_pReader;
 	std::unique_ptr<mbedtls_aes_context> m_AES_ctx;
+	std::array<u8, 11 * 16> m_round_keys;
+	bool m_use_aesni;
 
 	u64 m_VolumeOffset;
 	u64 m_dataOffset;
 
-	mutable u64 m_LastDecryptedBlockOffset;
-	mutable unsigned char m_LastDecryptedBlock[s_block_data_size];
+	mutable std::vector<CachedCluster> m_cache;
+	mutable std::unordered_map<u64, CachedCluster*> m_cache_index;
+	mutable u64 m_cache_tick;
+	mutable std::vector<u8> m_read_buffer;
 };
 
 }  // namespace
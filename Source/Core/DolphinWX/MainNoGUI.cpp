@@ -2,25 +2,31 @@
 // Licensed under GPLv2+
 // Refer to the license.txt file included.
 
+#include <array>
 #include <cstddef>
 #include <cstdio>
+#include <cstdlib>
 #include <cstring>
 #include <getopt.h>
 #include <signal.h>
 #include <string>
 #include <thread>
 #include <unistd.h>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/Event.h"
+#include "Common/FileUtil.h"
 #include "Common/Flag.h"
 #include "Common/Logging/LogManager.h"
 #include "Common/MsgHandler.h"
+#include "Common/StringUtil.h"
 
 #include "Core/Analytics.h"
 #include "Core/BootManager.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
+#include "Core/FifoPlayer/FifoPlayer.h"
 #include "Core/HW/Wiimote.h"
 #include "Core/Host.h"
 #include "Core/IPC_HLE/WII_IPC_HLE.h"
@@ -31,7 +37,9 @@
 
 #include "UICommon/UICommon.h"
 
+#include "VideoCommon/HiresTextures.h"
 #include "VideoCommon/RenderBase.h"
+#include "VideoCommon/StageTiming.h"
 #include "VideoCommon/VideoBackendBase.h"
 
 static bool rendererHasFocus = true;
@@ -365,6 +373,9 @@ class PlatformX11 : public Platform
 
 static Platform* GetPlatform()
 {
+	// The Null backend doesn't need a window
+	if (SConfig::GetInstance().m_strVideoBackend == "Null")
+		return new Platform();
 #if defined(USE_EGL) && defined(USE_HEADLESS)
 	return new Platform();
 #elif HAVE_X11
@@ -373,20 +384,80 @@ static Platform* GetPlatform()
 	return nullptr;
 }
 
+static void WriteStageTimings(const std::string& filename)
+{
+	const std::vector<StageTiming::Frame> frames = StageTiming::TakeFrames();
+	const bool json = StringEndsWith(filename, ".json");
+	if (!File::WriteStringToFile(
+		json ? StageTiming::FramesToJSON(frames) : StageTiming::FramesToCSV(frames), filename))
+	{
+		fprintf(stderr, "Could not write %s\n", filename.c_str());
+	}
+	if (frames.empty())
+		return;
+
+	// The first frame includes the startup, it is left out of the averages
+	const size_t first = frames.size() > 1 ? 1 : 0;
+	const double count = (double)(frames.size() - first);
+	u64 total = 0;
+	std::array<u64, StageTiming::STAGE_COUNT> stages{};
+	for (size_t i = first; i < frames.size(); ++i)
+	{
+		total += frames[i].total_ns;
+		for (u32 stage = 0; stage < StageTiming::STAGE_COUNT; ++stage)
+			stages[stage] += frames[i].stage_ns[stage];
+	}
+	printf("%zu frames, %.3f ms per frame\n", frames.size(), total / count / 1000000.0);
+	for (u32 stage = 0; stage < StageTiming::STAGE_COUNT; ++stage)
+	{
+		printf("  %-18s %8.3f ms\n", StageTiming::GetStageName(static_cast<StageTiming::Stage>(stage)),
+			stages[stage] / count / 1000000.0);
+	}
+}
+
 int main(int argc, char* argv[])
 {
 	int ch, help = 0;
+	std::string timings_file;
+	std::string texture_pack_game_id;
+	bool build_material_maps = false;
 	struct option longopts[] = { { "exec", no_argument, nullptr, 'e' },
 	{ "help", no_argument, nullptr, 'h' },
 	{ "version", no_argument, nullptr, 'v' },
+	{ "video_backend", required_argument, nullptr, 'b' },
+	{ "fifo_loops", required_argument, nullptr, 'l' },
+	{ "timings", required_argument, nullptr, 't' },
+	{ "texture_pack", required_argument, nullptr, 'p' },
+	{ "build_material_maps", no_argument, nullptr, 'm' },
 	{ nullptr, 0, nullptr, 0 } };
 
-	while ((ch = getopt_long(argc, argv, "eh?v", longopts, 0)) != -1)
+	UICommon::SetUserDirectory("");  // Auto-detect user folder
+	UICommon::Init();
+	// The options only apply to this run, the configured values are written back on exit
+	const std::string video_backend = SConfig::GetInstance().m_strVideoBackend;
+	const float emulation_speed = SConfig::GetInstance().m_EmulationSpeed;
+
+	while ((ch = getopt_long(argc, argv, "eh?vb:l:t:p:m", longopts, 0)) != -1)
 	{
 		switch (ch)
 		{
 		case 'e':
 			break;
+		case 'b':
+			SConfig::GetInstance().m_strVideoBackend = optarg;
+			break;
+		case 'l':
+			FifoPlayer::GetInstance().SetPlaybackCount((u32)strtoul(optarg, nullptr, 10));
+			break;
+		case 't':
+			timings_file = optarg;
+			break;
+		case 'p':
+			texture_pack_game_id = optarg;
+			break;
+		case 'm':
+			build_material_maps = true;
+			break;
 		case 'h':
 		case '?':
 			help = 1;
@@ -397,14 +468,43 @@ int main(int argc, char* argv[])
 		}
 	}
 
+	// Packing custom textures doesn't need the game, the directory replaces the file argument
+	if (help == 0 && !texture_pack_game_id.empty())
+	{
+		std::string directory = optind < argc ? argv[optind] :
+			HiresTexture::GetTextureDirectory(texture_pack_game_id);
+		while (directory.size() > 1 && directory.back() == '/')
+			directory.pop_back();
+		// Material maps are packed whenever they exist, the texture cache only uses them if enabled
+		const bool success = HiresTexture::BuildPack(texture_pack_game_id, directory, true,
+			build_material_maps, [](const std::string& name, float progress)
+		{
+			fprintf(stderr, "\r%3d%% %-60s", static_cast<int>(progress * 100), name.c_str());
+			return true;
+		});
+		fprintf(stderr, "\n%s %s.htp\n", success ? "Wrote" : "Failed to write", directory.c_str());
+		UICommon::Shutdown();
+		return success ? 0 : 1;
+	}
+
 	if (help == 1 || argc == optind)
 	{
 		fprintf(stderr, "%s\n\n", scm_rev_str.c_str());
 		fprintf(stderr, "A multi-platform GameCube/Wii emulator\n\n");
-		fprintf(stderr, "Usage: %s [-e <file>] [-h] [-v]\n", argv[0]);
-		fprintf(stderr, "  -e, --exec     Load the specified file\n");
-		fprintf(stderr, "  -h, --help     Show this help message\n");
-		fprintf(stderr, "  -v, --version  Print version and exit\n");
+		fprintf(stderr, "Usage: %s [-e <file>] [-h] [-v] [-b <backend>] [-l <count>] [-t <file>]\n", argv[0]);
+		fprintf(stderr, "       %s -p <game id> [-m] [<texture directory>]\n", argv[0]);
+		fprintf(stderr, "  -e, --exec           Load the specified file\n");
+		fprintf(stderr, "  -h, --help           Show this help message\n");
+		fprintf(stderr, "  -v, --version        Print version and exit\n");
+		fprintf(stderr, "  -b, --video_backend  Use the specified video backend for this run\n");
+		fprintf(stderr, "  -l, --fifo_loops     Play a FIFO log this many times, then exit\n");
+		fprintf(stderr, "  -t, --timings        Run unthrottled and write per frame video stage\n");
+		fprintf(stderr, "                       timings to the file, JSON if it ends in .json\n");
+		fprintf(stderr, "  -p, --texture_pack   Pack the custom textures of the game ID from the\n");
+		fprintf(stderr, "                       directory, Load/Textures/<game id> by default, into\n");
+		fprintf(stderr, "                       <texture directory>.htp, then exit\n");
+		fprintf(stderr, "  -m, --build_material_maps  With -p, build the material maps from their sources\n");
+		UICommon::Shutdown();
 		return 1;
 	}
 
@@ -412,11 +512,15 @@ int main(int argc, char* argv[])
 	if (!platform)
 	{
 		fprintf(stderr, "No platform found\n");
+		UICommon::Shutdown();
 		return 1;
 	}
 
-	UICommon::SetUserDirectory("");  // Auto-detect user folder
-	UICommon::Init();
+	if (!timings_file.empty())
+	{
+		SConfig::GetInstance().m_EmulationSpeed = 0.0f;
+		StageTiming::SetEnabled(true);
+	}
 
 	Core::SetOnStoppedCallback([]() { s_running.Clear(); });
 	platform->Init();
@@ -434,6 +538,8 @@ int main(int argc, char* argv[])
 	if (!BootManager::BootCore(argv[optind]))
 	{
 		fprintf(stderr, "Could not boot %s\n", argv[optind]);
+		SConfig::GetInstance().m_strVideoBackend = video_backend;
+		SConfig::GetInstance().m_EmulationSpeed = emulation_speed;
 		return 1;
 	}
 
@@ -449,6 +555,13 @@ int main(int argc, char* argv[])
 
 	Core::Shutdown();
 	platform->Shutdown();
+	if (!timings_file.empty())
+	{
+		StageTiming::SetEnabled(false);
+		WriteStageTimings(timings_file);
+	}
+	SConfig::GetInstance().m_strVideoBackend = video_backend;
+	SConfig::GetInstance().m_EmulationSpeed = emulation_speed;
 	UICommon::Shutdown();
 
 	delete platform;
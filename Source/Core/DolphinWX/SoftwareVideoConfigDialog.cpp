@@ -83,6 +83,8 @@ SoftwareVideoConfigDialog::SoftwareVideoConfigDialog(wxWindow* parent, const std
 			// xfb
 			szr_rendering->Add(
 				new SettingCheckBox(page_general, _("Bypass XFB"), "", vconfig.bUseXFB, true));
+			szr_rendering->Add(new SettingCheckBox(page_general, _("Multi-threaded Rasterization"), "",
+				vconfig.bParallelRasterization));
 		}
 
 		// - info
@@ -13,6 +13,7 @@
 #include <wx/dialog.h>
 #include <wx/notebook.h>
 #include <wx/panel.h>
+#include <wx/progdlg.h>
 #include <wx/radiobut.h>
 #include <wx/sizer.h>
 #include <wx/slider.h>
@@ -31,6 +32,7 @@
 #include "DolphinWX/Main.h"
 #include "DolphinWX/VideoConfigDiag.h"
 #include "DolphinWX/WxUtils.h"
+#include "VideoCommon/HiresTextures.h"
 #include "VideoCommon/PostProcessing.h"
 #include "VideoCommon/RenderBase.h"
 #include "VideoCommon/VideoBackendBase.h"
@@ -126,6 +128,9 @@ static wxString bump_detail_frequency_desc = _("Controls detail bumpmap frequenc
 static wxString bump_detail_blend_desc = _("Controls the detail bumpmap strength. Detail bump will add noise to existing textures.");
 static wxString bump_threshold_desc = _("Controls simulated bumpmap detail detection threshold. Big values can detect more details as bumps but can cause glitches");
 static wxString hacked_buffer_upload_desc = _("Uses unsafe operations to speed up vertex streaming in OpenGL. There are no known problems on supported GPUs, but it will cause severe stability and graphical issues otherwise.\n\nIf unsure, leave this unchecked.");
+static wxString omp_decoder_desc = _("Decodes large textures and their mipmaps on several CPU threads.\nReduces the stutter when a game loads new textures on CPUs with more than two cores.\n\nIf unsure, leave this checked.");
+static wxString parallel_vertex_loading_desc = _("Converts the vertices of draws with thousands of vertices on several CPU threads.\nSpeeds up games that draw large meshes in one go on CPUs with more than two cores.\n\nIf unsure, leave this checked.");
+static wxString gpu_parse_thread_desc = _("Reads and parses the commands the game sends to the GPU on a thread of its own, so the GPU thread only runs them.\nSpeeds up games limited by the GPU thread on CPUs with more than two cores. Like deterministic dual core, the game is told that the GPU finished its commands once they are parsed, which a few games don't like.\nOnly used in dual core mode, takes effect when a game is started.\n\nIf unsure, leave this unchecked.");
 static wxString fast_depth_calc_desc = _("Use a less accurate algorithm to calculate depth values.\nCauses issues in a few games but might give a decent speedup.\n\nIf unsure, leave this checked.");
 static wxString force_filtering_desc = _("Force texture filtering even if the emulated game explicitly disabled it.\nImproves texture quality slightly but causes glitches in some games.\n\nIf unsure, leave this unchecked.");
 static wxString disable_filtering_desc = _("Disable texture filtering even if the emulated game explicitly enable it.\n\nIf unsure, leave this unchecked.");
@@ -138,6 +143,7 @@ static wxString efb_emulate_format_changes_desc = _("Ignore any changes to the E
 static wxString viewport_correction_desc = _("Some games uses viewport values that are not compatible with D3D backends, to solve issues on those games check this.\n\nIf unsure, leave this unchecked.");
 static wxString skip_efb_copy_to_ram_desc = _("Stores EFB Copies exclusively on the GPU, bypassing system memory. Causes graphical defects in a small number of games.\n\nEnabled = EFB Copies to Texture\nDisabled = EFB Copies to RAM (and Texture)\n\nIf unsure, leave this checked.");
 static wxString stc_desc = _("The safer you adjust this, the less likely the emulator will be missing any texture updates from RAM.\n\nIf unsure, use the rightmost value.");
+static wxString texture_write_watch_desc = _("Write-protects the memory of textures and only checks a texture for changes after the game wrote to it. Saves most of the texture hashing in games with many static textures.\nNeeds fastmem. May miss texture updates done by hardware the emulator doesn't track.\n\nIf unsure, leave this unchecked.");
 static wxString bbox_desc = _("Selects wish implementation is used to emulate Bounding Box. By Default GPU will be used if supported.");
 static wxString wireframe_desc = _("Render the scene as a wireframe.\n\nIf unsure, leave this unchecked.");
 static wxString disable_fog_desc = _("Makes distant objects more visible by removing fog, thus increasing the overall detail.\nDisabling fog will break some games which rely on proper fog emulation.\n\nIf unsure, leave this unchecked.");
@@ -172,16 +178,17 @@ static wxString xfb_desc = _("Disable any XFB emulation.\nSpeeds up emulation a
 static wxString xfb_virtual_desc = _("Emulate XFBs using GPU texture objects.\nFixes many games which don't work without XFB emulation while not being as slow as real XFB emulation. However, it may still fail for a lot of other games (especially homebrew applications).\n\nIf unsure, leave this checked.");
 static wxString xfb_real_desc = _("Emulate XFBs accurately.\nSlows down emulation a lot and prohibits high-resolution rendering but is necessary to emulate a number of games properly.\n\nIf unsure, check virtual XFB emulation instead.");
 static wxString dump_textures_desc = _("Dump decoded game textures to User/Dump/Textures/<game_id>/\n\nIf unsure, leave this unchecked.");
-static wxString dump_VertexTranslators_desc = _("Dump Vertex translator code to User/Dump/\n\nIf unsure, leave this unchecked.");
+static wxString display_list_cache_desc = _("Cache display lists and the vertices they contain so they do not have to be decoded again on every call.\nCan improve performance in games that rely heavily on display lists.\n\nIf unsure, leave this unchecked.");
 static wxString fullAsyncShaderCompilation_desc = _("Make shader compilation proccess fully asynchronous. This can cause glitches but will give a smooth game experience.");
 static wxString compute_texture_decoding_desc = _("Decode Textures using compute shaders. Can Increase Performance in some scenarios.");
 static wxString Compute_texture_encoding_desc = _("Encode Textures using compute shaders. Can Increase Performance in some scenarios.");
 static wxString waitforshadercompilation_desc = _("Wait for shader compilation in the cpu to avoid fifo problems. This option prevents loops in F-Zero, Metroid Prime fifo resets and others.");
-static wxString predictiveFifo_desc = _("Generate a secondary fifo to predict resource usage and improve loading time.");
+static wxString predictiveFifo_desc = _("Looks ahead in the command stream and hashes and decodes the textures of upcoming draws on worker threads, so new textures load with less stutter.\nNeeds the GPU Parse Thread or deterministic dual core, and Watch Writes.\n\nIf unsure, leave this unchecked.");
 static wxString load_hires_textures_desc = _("Load custom textures from User/Load/Textures/<game_id>/\n\nIf unsure, leave this unchecked.");
 static wxString load_hires_material_maps_desc = _("Load custom material maps from User/Load/Textures/<game_id>/\nUsed to Enable Advanced lighting, Requires Pixel Lighting and Hires Textures Enabled\nIf unsure, leave this unchecked.");
 static wxString cache_hires_textures_desc = _("Cache custom textures to system RAM on startup.\nThis can require exponentially more RAM but fixes possible stuttering.\n\nIf unsure, leave this unchecked.");
 static wxString cache_hires_textures_gpu_desc = _("Cache custom textures to GPU RAM after loading.\nThis can require exponentially more RAM but fixes stuttering the second time the texture is required.\n\nIf unsure, leave this unchecked.");
+static wxString build_texture_pack_desc = _("Pack the custom textures of the running game into a single file stored next to its texture folder.\nThe pack is loaded instead of the folder, which removes the texture loading stutter without prefetching.\nBuild it again after changing the textures or the material map options.");
 static wxString dump_efb_desc = _("Dump the contents of EFB copies to User/Dump/Textures/\n\nIf unsure, leave this unchecked.");
 static wxString internal_resolution_frame_dumping_desc = _(
 	"Create frame dumps and screenshots at the internal resolution of the renderer, rather than "
@@ -217,6 +224,7 @@ static wxString Tessellation_round_desc = _("Select the intensity of the roundin
 static wxString Tessellation_displacement_desc = _("Select the intensity of the displacement effect when using custom materials.");
 static wxString scaling_factor_desc = _("Multiplier applied to the texture size.");
 static wxString texture_deposterize_desc = _("Decrease some gradient's artifacts caused by scaling.");
+static wxString texture_scaling_async_desc = _("Scale textures on worker threads instead of stalling the emulation.\nNew textures are shown at their native resolution for a few frames until the scaled version is ready.\n\nIf unsure, leave this unchecked.");
 static wxString stereoshader_desc = _("Selects which shader will be used to transform the two images when stereoscopy is enabled.");
 static wxString forcedLogivOp_desc = _("Force Logic blending support.\nBy default dx11/12 supports logic op blending only on UINT formats, but in some drivers UNORM is also supported but is not detectable.\nThis option will allow you to test if your driver really supports logic blending, but it will crash the emulator if enabled in a platform that does not support it.\n\nIf unsure, leave this unchecked.");
 static wxString backend_multithreading_desc =
@@ -549,6 +557,7 @@ VideoConfigDiag::VideoConfigDiag(wxWindow* parent, const std::string &title)
 
 			wxStaticBoxSizer* const group_scaling = new wxStaticBoxSizer(wxVERTICAL, page_enh, _("Texture Scaling"));
 			group_scaling->Add(szr_texturescaling, 1, wxEXPAND | wxLEFT | wxRIGHT | wxBOTTOM, 5);
+			group_scaling->Add(CreateCheckBox(page_enh, _("Scale in Background"), (texture_scaling_async_desc), vconfig.bTexScalingAsync), 0, wxLEFT | wxBOTTOM, 5);
 			szr_enh_main->Add(group_scaling, 0, wxEXPAND | wxALL, 5);
 		}
 		{
@@ -871,6 +880,7 @@ VideoConfigDiag::VideoConfigDiag(wxWindow* parent, const std::string &title)
 			szr_safetex->Add(new wxStaticText(page_hacks, wxID_ANY, _("Safe")), 0, wxLEFT | wxTOP | wxBOTTOM, 5);
 			szr_safetex->Add(stc_slider, 2, wxRIGHT, 0);
 			szr_safetex->Add(new wxStaticText(page_hacks, wxID_ANY, _("Fast")), 0, wxRIGHT | wxTOP | wxBOTTOM, 5);
+			szr_safetex->Add(CreateCheckBox(page_hacks, _("Watch Writes"), (texture_write_watch_desc), vconfig.bTextureWriteWatch), 0, wxLEFT | wxTOP | wxBOTTOM, 5);
 			szr_hacks->Add(szr_safetex, 0, wxEXPAND | wxALL, 5);
 		}
 		// - XFB
@@ -916,14 +926,18 @@ VideoConfigDiag::VideoConfigDiag(wxWindow* parent, const std::string &title)
 			// Disable while i fix opencl
 			//szr_other->Add(CreateCheckBox(page_hacks, _("OpenCL Texture Decoder"), (opencl_desc), vconfig.bEnableOpenCL));
 			szr_other->Add(CreateCheckBox(page_hacks, _("Fast Depth Calculation"), (fast_depth_calc_desc), vconfig.bFastDepthCalc));
+			szr_other->Add(CreateCheckBox(page_hacks, _("Multi-threaded Texture Decoding"), (omp_decoder_desc), vconfig.bOMPDecoder));
+			szr_other->Add(CreateCheckBox(page_hacks, _("Multi-threaded Vertex Loading"), (parallel_vertex_loading_desc), vconfig.bParallelVertexLoading));
+			szr_other->Add(CreateCheckBox(page_hacks, _("GPU Parse Thread"), (gpu_parse_thread_desc), vconfig.bGPUParseThread));
 			vertex_rounding_checkbox =
 				CreateCheckBox(page_hacks, _("Vertex Rounding"), wxGetTranslation(vertex_rounding_desc),
 					vconfig.bVertexRounding);
 			szr_other->Add(vertex_rounding_checkbox);
 			szr_other->Add(Forced_LogicOp = CreateCheckBox(page_hacks, _("Force Logic Blending"), (forcedLogivOp_desc), vconfig.bForceLogicOpBlend));
-			//szr_other->Add(Predictive_FIFO = CreateCheckBox(page_hacks, _("Predictive FIFO"), (predictiveFifo_desc), vconfig.bPredictiveFifo));
+			szr_other->Add(Predictive_FIFO = CreateCheckBox(page_hacks, _("Predictive FIFO"), (predictiveFifo_desc), vconfig.bPredictiveFifo));
 			//szr_other->Add(Wait_For_Shaders = CreateCheckBox(page_hacks, _("Wait for Shader Compilation"), (waitforshadercompilation_desc), vconfig.bWaitForShaderCompilation));
 			szr_other->Add(Async_Shader_compilation = CreateCheckBox(page_hacks, _("Full Async Shader Compilation"), (fullAsyncShaderCompilation_desc), vconfig.bFullAsyncShaderCompilation));
+			szr_other->Add(CreateCheckBox(page_hacks, _("Cache Display Lists"), (display_list_cache_desc), vconfig.bDisplayListCache));
 			szr_other->Add(GPU_Texture_decoding = CreateCheckBox(page_hacks, _("GPU Texture Decoding"), (compute_texture_decoding_desc), vconfig.bEnableGPUTextureDecoding));
 			szr_other->Add(Compute_Shader_encoding = CreateCheckBox(page_hacks, _("Compute Texture Encoding"), (Compute_texture_encoding_desc), vconfig.bEnableComputeTextureEncoding));
 
@@ -968,7 +982,6 @@ VideoConfigDiag::VideoConfigDiag(wxWindow* parent, const std::string &title)
 			wxGridSizer* const szr_utility = new wxGridSizer(2, 5, 5);
 
 			szr_utility->Add(CreateCheckBox(page_advanced, _("Dump Textures"), (dump_textures_desc), vconfig.bDumpTextures));
-			szr_utility->Add(CreateCheckBox(page_advanced, _("Dump Vertex Loaders"), (dump_VertexTranslators_desc), vconfig.bDumpVertexLoaders));
 			szr_utility->Add(CreateCheckBox(page_advanced, _("Load Custom Textures"), (load_hires_textures_desc), vconfig.bHiresTextures));
 			cache_hires_textures = CreateCheckBox(page_advanced, _("Prefetch Custom Textures"), cache_hires_textures_desc, vconfig.bCacheHiresTextures);
 			hires_texturemaps = CreateCheckBox(page_advanced, _("Load Custom Material Maps"), load_hires_material_maps_desc, vconfig.bHiresMaterialMaps);
@@ -983,6 +996,10 @@ VideoConfigDiag::VideoConfigDiag(wxWindow* parent, const std::string &title)
 			szr_utility->Add(CreateCheckBox(page_advanced, _("Dump EFB Target"), (dump_efb_desc), vconfig.bDumpEFBTarget));
 			szr_utility->Add(CreateCheckBox(page_advanced, _("Free Look"), (free_look_desc), vconfig.bFreeLook));
 			szr_utility->Add(shaderprecompile = CreateCheckBox(page_advanced, _("Compile Shaders on Startup"), (shader_precompile_desc), vconfig.bCompileShaderOnStartup));
+			wxButton* const button_build_texture_pack = new wxButton(page_advanced, wxID_ANY, _("Build Texture Pack..."));
+			button_build_texture_pack->Bind(wxEVT_BUTTON, &VideoConfigDiag::Event_BuildTexturePack, this);
+			RegisterControl(button_build_texture_pack, wxGetTranslation(build_texture_pack_desc));
+			szr_utility->Add(button_build_texture_pack);
 
 #if !defined WIN32 && defined HAVE_LIBAV
 			szr_utility->Add(CreateCheckBox(page_advanced, _("Frame Dumps Use FFV1"), (use_ffv1_desc), vconfig.bUseFFV1));
@@ -1360,6 +1377,28 @@ void VideoConfigDiag::Event_ConfigureScalingShader(wxCommandEvent &ev)
 	dialog.ShowModal();
 }
 
+void VideoConfigDiag::Event_BuildTexturePack(wxCommandEvent &ev)
+{
+	const std::string game_id = SConfig::GetInstance().GetGameID();
+	if (game_id.empty() || !Core::IsRunning())
+	{
+		wxMessageBox(_("Start the game whose custom textures should be packed first."),
+			_("Build Texture Pack"), wxOK | wxICON_INFORMATION, this);
+		return;
+	}
+
+	wxProgressDialog dialog(_("Building texture pack..."), _("Working..."), 1000, this,
+		wxPD_APP_MODAL | wxPD_CAN_ABORT | wxPD_ELAPSED_TIME | wxPD_ESTIMATED_TIME | wxPD_REMAINING_TIME | wxPD_SMOOTH);
+	bool success = HiresTexture::BuildPack(game_id, HiresTexture::GetTextureDirectory(game_id),
+		vconfig.HiresMaterialMapsEnabled(), vconfig.bHiresMaterialMapsBuild,
+		[&dialog](const std::string& text, float percent)
+	{
+		return dialog.Update(static_cast<int>(percent * 1000), StrToWxStr(text));
+	});
+	if (!success)
+		WxUtils::ShowErrorDialog(_("Failed to build the texture pack. Check the log for details."));
+}
+
 void VideoConfigDiag::Event_StereoDepth(wxCommandEvent &ev)
 {
 	vconfig.iStereoDepth = ev.GetInt();
@@ -95,6 +95,7 @@ protected:
 	void Event_PPShaderAdd(wxCommandEvent& ev);
 	void Event_ScalingShader(wxCommandEvent& ev);
 	void Event_ConfigureScalingShader(wxCommandEvent &ev);
+	void Event_BuildTexturePack(wxCommandEvent &ev);
 	void Event_StereoShader(wxCommandEvent& ev);
 
 	void Event_StereoDepth(wxCommandEvent &ev);
@@ -31,6 +31,7 @@
 
 #include "VideoCommon/AVIDump.h"
 #include "VideoCommon/Debugger.h"
+#include "VideoCommon/DLCache.h"
 #include "VideoCommon/Fifo.h"
 #include "VideoCommon/FPSCounter.h"
 #include "VideoCommon/BPFunctions.h"
@@ -54,6 +55,7 @@ void Renderer::SetupDeviceObjects()
 {
 	D3D::font.Init();
 	VertexLoaderManager::Init();
+	DLCache::Init();
 	g_framebuffer_manager = std::make_unique<FramebufferManager>(m_target_width, m_target_height);
 
 	VertexShaderManager::Dirty();
@@ -80,6 +82,7 @@ void Renderer::TeardownDeviceObjects()
 	static_cast<PerfQuery*>(g_perf_query.get())->DestroyDeviceObjects();
 	D3D::font.Shutdown();
 	g_texture_cache->Invalidate();
+	DLCache::Shutdown();
 	VertexLoaderManager::Shutdown();
 	VertexShaderCache::Shutdown();
 	PixelShaderCache::Shutdown();
@@ -0,0 +1,39 @@
+// Copyright 2013 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <memory>
+
+#include "Common/CommonTypes.h"
+
+#include "VideoCommon/FramebufferManagerBase.h"
+#include "VideoCommon/RenderBase.h"
+
+namespace Null
+{
+class XFBSource : public XFBSourceBase
+{
+	void DecodeToTexture(u32 xfbAddr, u32 fbWidth, u32 fbHeight) override
+	{}
+	void CopyEFB(float Gamma) override
+	{}
+};
+
+// Keeps the virtual XFB list of the base class, real XFB copies write nothing
+class FramebufferManager : public FramebufferManagerBase
+{
+	std::unique_ptr<XFBSourceBase> CreateXFBSource(unsigned int target_width, unsigned int target_height, unsigned int layers) override
+	{
+		return std::make_unique<XFBSource>();
+	}
+	void GetTargetSize(unsigned int* width, unsigned int* height) override
+	{
+		*width = g_renderer->GetTargetWidth();
+		*height = g_renderer->GetTargetHeight();
+	}
+	void CopyToRealXFB(u32 xfbAddr, u32 fbStride, u32 fbHeight, const EFBRectangle& sourceRc, float Gamma = 1.0f) override
+	{}
+};
+}
@@ -0,0 +1,87 @@
+// Copyright 2013 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include "Core/Core.h"
+
+#include "VideoBackends/Null/Render.h"
+
+#include "VideoCommon/FramebufferManagerBase.h"
+#include "VideoCommon/OnScreenDisplay.h"
+#include "VideoCommon/PixelShaderManager.h"
+#include "VideoCommon/TextureCacheBase.h"
+#include "VideoCommon/VideoConfig.h"
+
+namespace Null
+{
+Renderer::Renderer()
+{
+	g_Config.bRunning = true;
+	UpdateActiveConfig();
+
+	// There is no window, assume one as large as the largest XFB
+	m_backbuffer_width = MAX_XFB_WIDTH;
+	m_backbuffer_height = MAX_XFB_HEIGHT;
+	FramebufferManagerBase::SetLastXfbWidth(MAX_XFB_WIDTH);
+	FramebufferManagerBase::SetLastXfbHeight(MAX_XFB_HEIGHT);
+}
+
+void Renderer::Init()
+{
+	UpdateDrawRectangle();
+	CalculateTargetSize();
+	PixelShaderManager::SetEfbScaleChanged();
+}
+
+void Renderer::Shutdown()
+{
+	g_Config.bRunning = false;
+	UpdateActiveConfig();
+}
+
+u32 Renderer::AccessEFB(EFBAccessType type, u32 x, u32 y, u32 poke_data)
+{
+	// Nothing was rendered, peeks see a cleared EFB
+	return 0;
+}
+
+u16 Renderer::BBoxRead(int index)
+{
+	return m_bbox[index];
+}
+
+void Renderer::BBoxWrite(int index, u16 value)
+{
+	m_bbox[index] = value;
+}
+
+TargetRectangle Renderer::ConvertEFBRectangle(const EFBRectangle& rc)
+{
+	TargetRectangle result;
+	result.left = EFBToScaledX(rc.left);
+	result.top = EFBToScaledY(rc.top);
+	result.right = EFBToScaledX(rc.right);
+	result.bottom = EFBToScaledY(rc.bottom);
+	return result;
+}
+
+// Called on the GPU thread
+void Renderer::SwapImpl(u32 xfbAddr, u32 fbWidth, u32 fbStride, u32 fbHeight, const EFBRectangle& rc, u64 ticks, float Gamma)
+{
+	if ((!m_xfb_written && !g_ActiveConfig.RealXFBEnabled()) || !fbWidth || !fbHeight)
+	{
+		Core::Callback_VideoCopiedToXFB(false);
+		return;
+	}
+
+	// Nothing is presented, but the caches age and the config changes apply like on a real swap
+	OSD::DoCallbacks(OSD::CallbackType::OnFrame);
+
+	g_texture_cache->Cleanup(frameCount);
+
+	g_Config.iSaveTargetId = 0;
+
+	UpdateActiveConfig();
+	g_texture_cache->OnConfigChanged(g_ActiveConfig);
+}
+}
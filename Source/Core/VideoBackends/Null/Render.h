@@ -0,0 +1,50 @@
+// Copyright 2013 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <array>
+#include <string>
+
+#include "Common/CommonTypes.h"
+
+#include "VideoCommon/RenderBase.h"
+
+namespace Null
+{
+// Renderer without a window or a GPU. Draws, clears and EFB copies leave no trace,
+// EFB peeks read back zero and bounding box reads see the last value written.
+class Renderer : public ::Renderer
+{
+public:
+	Renderer();
+	void Init() override;
+	void Shutdown() override;
+
+	void InsertBlackFrame() override
+	{}
+
+	void RenderText(const std::string& pstr, int left, int top, u32 color) override
+	{}
+	u32 AccessEFB(EFBAccessType type, u32 x, u32 y, u32 poke_data) override;
+	void PokeEFB(EFBAccessType type, const EfbPokeData* points, size_t num_points) override
+	{}
+
+	u16 BBoxRead(int index) override;
+	void BBoxWrite(int index, u16 value) override;
+
+	TargetRectangle ConvertEFBRectangle(const EFBRectangle& rc) override;
+
+	void SwapImpl(u32 xfbAddr, u32 fbWidth, u32 fbStride, u32 fbHeight, const EFBRectangle& rc, u64 ticks, float Gamma) override;
+
+	void ClearScreen(const EFBRectangle& rc, bool colorEnable, bool alphaEnable, bool zEnable, u32 color, u32 z) override
+	{}
+
+	void ReinterpretPixelData(unsigned int convtype) override
+	{}
+
+private:
+	std::array<u16, 4> m_bbox{};
+};
+}
@@ -0,0 +1,104 @@
+// Copyright 2013 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include "VideoBackends/Null/VertexManager.h"
+
+#include "VideoCommon/BPMemory.h"
+#include "VideoCommon/GeometryShaderManager.h"
+#include "VideoCommon/IndexGenerator.h"
+#include "VideoCommon/PixelShaderManager.h"
+#include "VideoCommon/Statistics.h"
+#include "VideoCommon/VertexLoaderManager.h"
+#include "VideoCommon/VertexShaderManager.h"
+#include "VideoCommon/VideoConfig.h"
+
+namespace Null
+{
+VertexManager::VertexManager() : m_cpu_v_buffer(MAXVBUFFERSIZE), m_cpu_i_buffer(MAXIBUFFERSIZE)
+{
+}
+
+VertexManager::~VertexManager()
+{
+}
+
+std::unique_ptr<NativeVertexFormat> VertexManager::CreateNativeVertexFormat(const PortableVertexDeclaration& vtx_decl)
+{
+	return std::make_unique<VertexFormat>(vtx_decl);
+}
+
+void VertexManager::ResetBuffer(u32 stride)
+{
+	m_pCurBufferPointer = m_pBaseBufferPointer = m_cpu_v_buffer.data();
+	m_pEndBufferPointer = m_pBaseBufferPointer + m_cpu_v_buffer.size();
+	IndexGenerator::Start(m_cpu_i_buffer.data());
+}
+
+u16* VertexManager::GetIndexBuffer()
+{
+	return m_cpu_i_buffer.data();
+}
+
+void VertexManager::SetShader(PIXEL_SHADER_RENDER_MODE render_mode, u32 components, PrimitiveType primitive, const XFMemory &xfr, const BPMemory &bpm)
+{
+	PixelShaderUid puid;
+	GetPixelShaderUID(puid, render_mode, components, xfr, bpm);
+	puid.CalculateUIDHash();
+	if (m_pixel_shaders.insert(puid).second)
+	{
+		INCSTAT(stats.numPixelShadersCreated);
+		SETSTAT(stats.numPixelShadersAlive, static_cast<int>(m_pixel_shaders.size()));
+	}
+
+	VertexShaderUid vuid;
+	GetVertexShaderUID(vuid, components, xfr, bpm);
+	vuid.CalculateUIDHash();
+	if (m_vertex_shaders.insert(vuid).second)
+	{
+		INCSTAT(stats.numVertexShadersCreated);
+		SETSTAT(stats.numVertexShadersAlive, static_cast<int>(m_vertex_shaders.size()));
+	}
+
+	GeometryShaderUid guid;
+	GetGeometryShaderUid(guid, primitive, xfr, components);
+	guid.CalculateUIDHash();
+	if (m_geometry_shaders.insert(guid).second)
+	{
+		INCSTAT(stats.numGeometryShadersCreated);
+		SETSTAT(stats.numGeometryShadersAlive, static_cast<int>(m_geometry_shaders.size()));
+	}
+}
+
+void VertexManager::PrepareShaders(PrimitiveType primitive, u32 components, const XFMemory &xfr, const BPMemory &bpm, bool ongputhread)
+{
+	// The same uids the OpenGL backend asks for, it supports dual source blending
+	const bool useDstAlpha = bpm.dstalpha.enable && bpm.blendmode.alphaupdate &&
+		bpm.zcontrol.pixel_format == PEControl::RGBA6_Z24;
+	if (useDstAlpha && g_ActiveConfig.backend_info.bSupportsDualSourceBlend)
+	{
+		SetShader(PSRM_DUAL_SOURCE_BLEND, components, primitive, xfr, bpm);
+	}
+	else
+	{
+		if (useDstAlpha)
+			SetShader(PSRM_ALPHA_PASS, components, primitive, xfr, bpm);
+		SetShader(PSRM_DEFAULT, components, primitive, xfr, bpm);
+	}
+}
+
+void VertexManager::vFlush(bool useDstAlpha)
+{
+	// The constants are consumed as if they were uploaded
+	PixelShaderManager::Clear();
+	VertexShaderManager::Clear();
+	GeometryShaderManager::Clear();
+
+	const u32 stride = VertexLoaderManager::GetCurrentVertexFormat()->GetVertexStride();
+	ADDSTAT(stats.thisFrame.bytesVertexStreamed, IndexGenerator::GetNumVerts() * stride);
+	ADDSTAT(stats.thisFrame.bytesIndexStreamed, IndexGenerator::GetIndexLen() * sizeof(u16));
+	INCSTAT(stats.thisFrame.numDrawCalls);
+
+	g_Config.iSaveTargetId++;
+}
+}
@@ -0,0 +1,58 @@
+// Copyright 2013 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <memory>
+#include <unordered_set>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/MemoryUtil.h"
+
+#include "VideoCommon/GeometryShaderGen.h"
+#include "VideoCommon/NativeVertexFormat.h"
+#include "VideoCommon/PixelShaderGen.h"
+#include "VideoCommon/VertexManagerBase.h"
+#include "VideoCommon/VertexShaderGen.h"
+
+namespace Null
+{
+class VertexFormat : public NativeVertexFormat
+{
+public:
+	VertexFormat(const PortableVertexDeclaration& _vtx_decl)
+	{
+		vtx_decl = _vtx_decl;
+	}
+	void SetupVertexPointers() override
+	{}
+};
+
+// Converts the vertices and generates the indices and shader uids of every draw
+// like the other backends do, then drops the draw instead of submitting it.
+class VertexManager : public VertexManagerBase
+{
+public:
+	VertexManager();
+	~VertexManager();
+	std::unique_ptr<NativeVertexFormat> CreateNativeVertexFormat(const PortableVertexDeclaration& vtx_decl) override;
+	void PrepareShaders(PrimitiveType primitive, u32 components, const XFMemory &xfr, const BPMemory &bpm, bool ongputhread) override;
+
+protected:
+	void ResetBuffer(u32 stride) override;
+	u16* GetIndexBuffer() override;
+private:
+	void vFlush(bool useDstAlpha) override;
+	void SetShader(PIXEL_SHADER_RENDER_MODE render_mode, u32 components, PrimitiveType primitive, const XFMemory &xfr, const BPMemory &bpm);
+
+	std::vector<u8, Common::aligned_allocator<u8, 16>> m_cpu_v_buffer;
+	std::vector<u16, Common::aligned_allocator<u16, 16>> m_cpu_i_buffer;
+
+	// The uids seen so far stand in for the shader caches of the other backends
+	std::unordered_set<PixelShaderUid, PixelShaderUid::ShaderUidHasher> m_pixel_shaders;
+	std::unordered_set<VertexShaderUid, VertexShaderUid::ShaderUidHasher> m_vertex_shaders;
+	std::unordered_set<GeometryShaderUid, GeometryShaderUid::ShaderUidHasher> m_geometry_shaders;
+};
+}
@@ -0,0 +1,27 @@
+// Copyright 2013 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <string>
+#include "VideoCommon/VideoBackendBase.h"
+
+namespace Null
+{
+class VideoBackend : public VideoBackendBase
+{
+	bool Initialize(void* window_handle) override;
+	void Shutdown() override;
+
+	std::string GetName() const override;
+	std::string GetDisplayName() const override;
+
+	void Video_Prepare() override;
+	void Video_Cleanup() override;
+
+	void InitBackendInfo() override;
+
+	unsigned int PeekMessages() override;
+};
+}
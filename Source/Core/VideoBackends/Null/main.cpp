@@ -0,0 +1,117 @@
+// Copyright 2013 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+// Null Backend Documentation
+/*
+
+Runs everything the other backends share, the FIFO, the vertex loaders, the index
+generator, the shader uids, the texture cache with its hashing and decoding and the
+constant managers, but submits nothing to a GPU. It needs no window, so it measures
+the emulation cost of the video thread on machines without a GPU and can run
+headless tests. Nothing is displayed, EFB and XFB copies to RAM write nothing and
+EFB peeks read back zero.
+
+*/
+
+#include <memory>
+#include <string>
+
+#include "VideoBackends/Null/FramebufferManager.h"
+#include "VideoBackends/Null/Render.h"
+#include "VideoBackends/Null/TextureCache.h"
+#include "VideoBackends/Null/VertexManager.h"
+#include "VideoBackends/Null/VideoBackend.h"
+
+#include "VideoCommon/PerfQueryBase.h"
+#include "VideoCommon/VideoConfig.h"
+
+namespace Null
+{
+unsigned int VideoBackend::PeekMessages()
+{
+	return 0;
+}
+
+std::string VideoBackend::GetName() const
+{
+	return "Null";
+}
+
+std::string VideoBackend::GetDisplayName() const
+{
+	return "Null";
+}
+
+void VideoBackend::InitBackendInfo()
+{
+	// No API, the shader generators only tell D3D9 apart
+	g_Config.backend_info.APIType = API_NONE;
+	g_Config.backend_info.MaxTextureSize = 16384;
+	g_Config.backend_info.bSupportsScaling = false;
+	g_Config.backend_info.bSupportsExclusiveFullscreen = false;
+	g_Config.backend_info.bSupportsDualSourceBlend = true;
+	g_Config.backend_info.bSupportsEarlyZ = true;
+	g_Config.backend_info.bSupportsOversizedViewports = true;
+	g_Config.backend_info.bSupportsGeometryShaders = true;
+	g_Config.backend_info.bSupports3DVision = false;
+	g_Config.backend_info.bSupportsPostProcessing = false;
+	g_Config.backend_info.bSupportsSSAA = true;
+	g_Config.backend_info.bSupportsPixelLighting = true;
+	g_Config.backend_info.bSupportsNormalMaps = true;
+	g_Config.backend_info.bSupportsTessellation = false;
+	g_Config.backend_info.bSupportsComputeShaders = false;
+	// The textures are decoded on the CPU, that is part of what this backend measures
+	g_Config.backend_info.bSupportsGPUTextureDecoding = false;
+	g_Config.backend_info.bSupportsComputeTextureEncoding = false;
+	g_Config.backend_info.bSupportsDepthClamp = true;
+	g_Config.backend_info.bSupportsMultithreading = false;
+	g_Config.backend_info.bSupportsValidationLayer = false;
+	g_Config.backend_info.bSupportsReversedDepthRange = true;
+	g_Config.backend_info.bSupportsInternalResolutionFrameDumps = false;
+	g_Config.backend_info.bSupportsAsyncShaderCompilation = false;
+	g_Config.backend_info.Adapters.clear();
+
+	// aamodes - 1 is to stay consistent with D3D (means no AA)
+	g_Config.backend_info.AAModes = { 1 };
+}
+
+bool VideoBackend::Initialize(void* window_handle)
+{
+	// There is nothing to draw to, no window handle needed
+	InitializeShared();
+	InitBackendInfo();
+
+	return true;
+}
+
+// This is called after Initialize() from the Core
+// Run from the graphics thread
+void VideoBackend::Video_Prepare()
+{
+	g_renderer = std::make_unique<Renderer>();
+	g_vertex_manager = std::make_unique<VertexManager>();
+	g_perf_query = std::make_unique<PerfQueryBase>();
+	g_texture_cache = std::make_unique<TextureCache>();
+	g_framebuffer_manager = std::make_unique<FramebufferManager>();
+	g_renderer->Init();
+}
+
+void VideoBackend::Shutdown()
+{
+	ShutdownShared();
+}
+
+void VideoBackend::Video_Cleanup()
+{
+	// The following calls are NOT Thread Safe
+	// And need to be called from the video thread
+	CleanupShared();
+	g_renderer->Shutdown();
+	g_framebuffer_manager.reset();
+	g_texture_cache.reset();
+	g_perf_query.reset();
+	g_vertex_manager.reset();
+	g_renderer.reset();
+}
+}
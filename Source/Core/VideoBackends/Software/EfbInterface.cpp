@@ -19,6 +19,20 @@ namespace EfbInterface
 {
 u32 perf_values[PQ_NUM_MEMBERS];
 
+// A pixel takes 3 bytes, they are read and written one by one so that writing a pixel
+// never touches the pixel after it, which may be drawn by another thread
+static inline u32 ReadPixel(u32 offset)
+{
+	return efb[offset] | (efb[offset + 1] << 8) | (efb[offset + 2] << 16);
+}
+
+static inline void WritePixel(u32 offset, u32 val)
+{
+	efb[offset] = (u8)val;
+	efb[offset + 1] = (u8)(val >> 8);
+	efb[offset + 2] = (u8)(val >> 16);
+}
+
 static inline u32 GetColorOffset(u16 x, u16 y)
 {
 	return (x + y * EFB_WIDTH) * 3;
@@ -41,10 +55,9 @@ static void SetPixelAlphaOnly(u32 offset, u8 a)
 	case PEControl::RGBA6_Z24:
 	{
 		u32 a32 = a;
-		u32 *dst = (u32*)&efb[offset];
-		u32 val = *dst & 0xffffffc0;
+		u32 val = ReadPixel(offset) & 0x00ffffc0;
 		val |= (a32 >> 2) & 0x0000003f;
-		*dst = val;
+		WritePixel(offset, val);
 	}
 	break;
 	default:
@@ -60,31 +73,24 @@ static void SetPixelColorOnly(u32 offset, u8 *rgb)
 	case PEControl::Z24:
 	{
 		u32 src = *(u32*)rgb;
-		u32 *dst = (u32*)&efb[offset];
-		u32 val = *dst & 0xff000000;
-		val |= src >> 8;
-		*dst = val;
+		WritePixel(offset, src >> 8);
 	}
 	break;
 	case PEControl::RGBA6_Z24:
 	{
 		u32 src = *(u32*)rgb;
-		u32 *dst = (u32*)&efb[offset];
-		u32 val = *dst & 0xff00003f;
+		u32 val = ReadPixel(offset) & 0x0000003f;
 		val |= (src >> 4) & 0x00000fc0; // blue
 		val |= (src >> 6) & 0x0003f000; // green
 		val |= (src >> 8) & 0x00fc0000; // red
-		*dst = val;
+		WritePixel(offset, val);
 	}
 	break;
 	case PEControl::RGB565_Z16:
 	{
 		INFO_LOG(VIDEO, "RGB565_Z16 is not supported correctly yet");
 		u32 src = *(u32*)rgb;
-		u32 *dst = (u32*)&efb[offset];
-		u32 val = *dst & 0xff000000;
-		val |= src >> 8;
-		*dst = val;
+		WritePixel(offset, src >> 8);
 	}
 	break;
 	default:
@@ -100,32 +106,24 @@ static void SetPixelAlphaColor(u32 offset, u8 *color)
 	case PEControl::Z24:
 	{
 		u32 src = *(u32*)color;
-		u32 *dst = (u32*)&efb[offset];
-		u32 val = *dst & 0xff000000;
-		val |= src >> 8;
-		*dst = val;
+		WritePixel(offset, src >> 8);
 	}
 	break;
 	case PEControl::RGBA6_Z24:
 	{
 		u32 src = *(u32*)color;
-		u32 *dst = (u32*)&efb[offset];
-		u32 val = *dst & 0xff000000;
-		val |= (src >> 2) & 0x0000003f; // alpha
+		u32 val = (src >> 2) & 0x0000003f; // alpha
 		val |= (src >> 4) & 0x00000fc0; // blue
 		val |= (src >> 6) & 0x0003f000; // green
 		val |= (src >> 8) & 0x00fc0000; // red
-		*dst = val;
+		WritePixel(offset, val);
 	}
 	break;
 	case PEControl::RGB565_Z16:
 	{
 		INFO_LOG(VIDEO, "RGB565_Z16 is not supported correctly yet");
 		u32 src = *(u32*)color;
-		u32 *dst = (u32*)&efb[offset];
-		u32 val = *dst & 0xff000000;
-		val |= src >> 8;
-		*dst = val;
+		WritePixel(offset, src >> 8);
 	}
 	break;
 	default:
@@ -140,7 +138,7 @@ static void GetPixelColor(u32 offset, u8 *color)
 	case PEControl::RGB8_Z24:
 	case PEControl::Z24:
 	{
-		u32 src = *(u32*)&efb[offset];
+		u32 src = ReadPixel(offset);
 		u32 *dst = (u32*)color;
 		u32 val = 0xff | ((src & 0x00ffffff) << 8);
 		*dst = val;
@@ -148,7 +146,7 @@ static void GetPixelColor(u32 offset, u8 *color)
 	break;
 	case PEControl::RGBA6_Z24:
 	{
-		u32 src = *(u32*)&efb[offset];
+		u32 src = ReadPixel(offset);
 		color[ALP_C] = Convert6To8(src & 0x3f);
 		color[BLU_C] = Convert6To8((src >> 6) & 0x3f);
 		color[GRN_C] = Convert6To8((src >> 12) & 0x3f);
@@ -158,7 +156,7 @@ static void GetPixelColor(u32 offset, u8 *color)
 	case PEControl::RGB565_Z16:
 	{
 		INFO_LOG(VIDEO, "RGB565_Z16 is not supported correctly yet");
-		u32 src = *(u32*)&efb[offset];
+		u32 src = ReadPixel(offset);
 		u32 *dst = (u32*)color;
 		u32 val = 0xff | ((src & 0x00ffffff) << 8);
 		*dst = val;
@@ -177,19 +175,13 @@ static void SetPixelDepth(u32 offset, u32 depth)
 	case PEControl::RGBA6_Z24:
 	case PEControl::Z24:
 	{
-		u32 *dst = (u32*)&efb[offset];
-		u32 val = *dst & 0xff000000;
-		val |= depth & 0x00ffffff;
-		*dst = val;
+		WritePixel(offset, depth & 0x00ffffff);
 	}
 	break;
 	case PEControl::RGB565_Z16:
 	{
 		INFO_LOG(VIDEO, "RGB565_Z16 is not supported correctly yet");
-		u32 *dst = (u32*)&efb[offset];
-		u32 val = *dst & 0xff000000;
-		val |= depth & 0x00ffffff;
-		*dst = val;
+		WritePixel(offset, depth & 0x00ffffff);
 	}
 	break;
 	default:
@@ -207,13 +199,13 @@ static u32 GetPixelDepth(u32 offset)
 	case PEControl::RGBA6_Z24:
 	case PEControl::Z24:
 	{
-		depth = (*(u32*)&efb[offset]) & 0x00ffffff;
+		depth = (ReadPixel(offset)) & 0x00ffffff;
 	}
 	break;
 	case PEControl::RGB565_Z16:
 	{
 		INFO_LOG(VIDEO, "RGB565_Z16 is not supported correctly yet");
-		depth = (*(u32*)&efb[offset]) & 0x00ffffff;
+		depth = (ReadPixel(offset)) & 0x00ffffff;
 	}
 	break;
 	default:
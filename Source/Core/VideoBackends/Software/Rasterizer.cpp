@@ -3,9 +3,13 @@
 // Refer to the license.txt file included.
 
 #include <algorithm>
+#include <atomic>
 #include <cstring>
+#include <memory>
+#include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/ThreadPool.h"
 #include "VideoBackends/Software/EfbInterface.h"
 #include "VideoBackends/Software/NativeVertexFormat.h"
 #include "VideoBackends/Software/Rasterizer.h"
@@ -20,27 +24,104 @@ namespace Rasterizer
 {
 static constexpr int BLOCK_SIZE = 2;
 
-static Slope ZSlope;
-static Slope WSlope;
-static Slope ColorSlopes[2][4];
-static Slope TexSlopes[8][3];
+// The triangles of a draw are sorted into tiles of the EFB, which are drawn in parallel.
+// A tile draws its triangles in order, so every pixel sees the same writes in the same
+// order as if the triangles were drawn one after the other. The pixels don't inherit
+// the TEV state of the pixel drawn before them, which depends on the thread, so draws
+// reading that state are drawn one after the other on contexts[0]. Once the tiles are
+// drawn, contexts[0] is left as if it had drawn them.
+static constexpr int TILE_SIZE = 64;
+static constexpr int TILES_X = (EFB_WIDTH + TILE_SIZE - 1) / TILE_SIZE;
+static constexpr int TILES_Y = (EFB_HEIGHT + TILE_SIZE - 1) / TILE_SIZE;
+// Draws covering fewer pixels than this are drawn on the GPU thread only
+static constexpr u32 PARALLEL_MIN_PIXELS = 64 * 64 * 4;
+
+// What drawing the pixels of a triangle needs, set up when the triangle comes in
+struct Triangle
+{
+	Slope ZSlope;
+	Slope WSlope;
+	Slope ColorSlopes[2][4];
+	Slope TexSlopes[8][3];
+
+	s32 vertex0X;
+	s32 vertex0Y;
+	float vertexOffsetX;
+	float vertexOffsetY;
+
+	// Half-edge constants and deltas, in 28.4 fixed point
+	s32 C1, C2, C3;
+	s32 DX12, DX23, DX31;
+	s32 DY12, DY23, DY31;
+
+	// Bounding rectangle, clipped to the scissor
+	s32 minx, maxx, miny, maxy;
+};
+
+// A block or pixel of a draw, order is its position in the serial drawing order plus one
+struct DrawPosition
+{
+	u64 order;
+	u32 triangle;
+	s32 x, y;
+};
+
+// The state of a thread drawing pixels
+struct PixelContext
+{
+	Tev tev;
+	RasterBlock rasterBlock;
 
-static s32 vertex0X;
-static s32 vertex0Y;
-static float vertexOffsetX;
-static float vertexOffsetY;
+	// The triangle drawn and, in tiles, the last block built and pixel combined in serial order
+	u32 triangle;
+	DrawPosition lastBlock;
+	DrawPosition lastPixel;
+};
+
+// Kept from one triangle to the next for zfreeze
+static Slope ZSlope;
 
 static s32 scissorLeft = 0;
 static s32 scissorTop = 0;
 static s32 scissorRight = 0;
 static s32 scissorBottom = 0;
 
-static Tev tev;
-static RasterBlock rasterBlock;
+static s16 tevRegs[2][4][4];
+// contexts[0] draws one triangle after the other, the others draw tiles
+static std::vector<std::unique_ptr<PixelContext>> contexts;
+static std::atomic<u32> nextContext;
+
+// The triangles of the current draw and, for each tile, the ones touching it
+static std::vector<Triangle> triangles;
+static std::vector<u32> bins[TILES_X * TILES_Y];
+static std::vector<u32> usedTiles;
+static u32 binnedPixels;
+
+static void AddContext()
+{
+	auto context = std::make_unique<PixelContext>();
+	context->tev.Init();
+	for (int konst = 0; konst < 2; konst++)
+	{
+		for (int reg = 0; reg < 4; reg++)
+		{
+			for (int comp = 0; comp < 4; comp++)
+				context->tev.SetRegColor(reg, comp, konst != 0, tevRegs[konst][reg][comp]);
+		}
+	}
+	contexts.push_back(std::move(context));
+}
 
 void Init()
 {
-	tev.Init();
+	memset(tevRegs, 0, sizeof(tevRegs));
+	contexts.clear();
+	AddContext();
+	triangles.clear();
+	for (u32 tile : usedTiles)
+		bins[tile].clear();
+	usedTiles.clear();
+	binnedPixels = 0;
 
 	// Set initial z reference plane in the unlikely case that zfreeze is enabled when drawing the first primitive.
 	// TODO: This is just a guess!
@@ -94,43 +175,53 @@ void SetScissor()
 
 void SetTevReg(int reg, int comp, bool konst, s16 color)
 {
-	tev.SetRegColor(reg, comp, konst, color);
+	tevRegs[konst][reg][comp] = color;
+	for (auto& context : contexts)
+		context->tev.SetRegColor(reg, comp, konst, color);
 }
 
-static void Draw(s32 x, s32 y, s32 xi, s32 yi)
+// Position in the order DrawBlocks goes through the blocks of a triangle, and their pixels
+static u64 GetDrawOrder(u32 triangle, s32 x, s32 y, bool pixel)
 {
-	INCSTAT(stats.thisFrame.rasterizedPixels);
-
-	float dx = vertexOffsetX + (float)(x - vertex0X);
-	float dy = vertexOffsetY + (float)(y - vertex0Y);
+	u32 index = (y / BLOCK_SIZE) * (EFB_WIDTH / BLOCK_SIZE) + x / BLOCK_SIZE;
+	if (pixel)
+		index = index * BLOCK_SIZE * BLOCK_SIZE + (y % BLOCK_SIZE) * BLOCK_SIZE + x % BLOCK_SIZE;
+	return ((u64)triangle << 32 | index) + 1;
+}
 
-	s32 z = (s32)MathUtil::Clamp<float>(ZSlope.GetValue(dx, dy), 0.0f, 16777215.0f);
+static void SetLastPosition(DrawPosition* position, u32 triangle, s32 x, s32 y, bool pixel)
+{
+	const u64 order = GetDrawOrder(triangle, x, y, pixel);
+	if (order > position->order)
+		*position = {order, triangle, x, y};
+}
 
-	if (!BoundingBox::active && bpmem.UseEarlyDepthTest() && g_ActiveConfig.bZComploc)
-	{
-		// TODO: Test if perf regs are incremented even if test is disabled
-		EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_INPUT_ZCOMPLOC);
-		if (bpmem.zmode.testenable)
-		{
-			// early z
-			if (!EfbInterface::ZCompare(x, y, z))
-				return;
-		}
-		EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_OUTPUT_ZCOMPLOC);
-	}
+static void SetPixelInputs(PixelContext& context, const Triangle& tri, s32 x, s32 y, s32 xi, s32 yi, s32 z)
+{
+	Tev& tev = context.tev;
+	const RasterBlock& rasterBlock = context.rasterBlock;
+	const RasterBlockPixel& pixel = rasterBlock.Pixel[xi][yi];
 
-	RasterBlockPixel& pixel = rasterBlock.Pixel[xi][yi];
+	float dx = tri.vertexOffsetX + (float)(x - tri.vertex0X);
+	float dy = tri.vertexOffsetY + (float)(y - tri.vertex0Y);
 
 	tev.Position[0] = x;
 	tev.Position[1] = y;
 	tev.Position[2] = z;
 
+	// The channels and coordinates the draw doesn't have read as zero, whichever Tev draws the pixel
+	if (tev.IndependentPixels)
+	{
+		memset(tev.Color, 0, sizeof(tev.Color));
+		memset(tev.Uv, 0, sizeof(tev.Uv));
+	}
+
 	//  colors
 	for (unsigned int i = 0; i < bpmem.genMode.numcolchans.Value(); i++)
 	{
 		for (int comp = 0; comp < 4; comp++)
 		{
-			u16 color = (u16)ColorSlopes[i][comp].GetValue(dx, dy);
+			u16 color = (u16)tri.ColorSlopes[i][comp].GetValue(dx, dy);
 
 			// clamp color value to 0
 			u16 mask = ~(color >> 8);
@@ -158,20 +249,48 @@ static void Draw(s32 x, s32 y, s32 xi, s32 yi)
 		tev.TextureLod[i] = rasterBlock.TextureLod[i];
 		tev.TextureLinear[i] = rasterBlock.TextureLinear[i];
 	}
+}
+
+static void Draw(PixelContext& context, const Triangle& tri, s32 x, s32 y, s32 xi, s32 yi)
+{
+	Tev& tev = context.tev;
+	tev.RasterizedPixels++;
 
+	float dx = tri.vertexOffsetX + (float)(x - tri.vertex0X);
+	float dy = tri.vertexOffsetY + (float)(y - tri.vertex0Y);
+
+	s32 z = (s32)MathUtil::Clamp<float>(tri.ZSlope.GetValue(dx, dy), 0.0f, 16777215.0f);
+
+	if (!BoundingBox::active && bpmem.UseEarlyDepthTest() && g_ActiveConfig.bZComploc)
+	{
+		// TODO: Test if perf regs are incremented even if test is disabled
+		tev.PerfQuadCounts[PQ_ZCOMP_INPUT_ZCOMPLOC]++;
+		if (bpmem.zmode.testenable)
+		{
+			// early z
+			if (!EfbInterface::ZCompare(x, y, z))
+				return;
+		}
+		tev.PerfQuadCounts[PQ_ZCOMP_OUTPUT_ZCOMPLOC]++;
+	}
+
+	if (tev.IndependentPixels)
+		SetLastPosition(&context.lastPixel, context.triangle, x, y, true);
+
+	SetPixelInputs(context, tri, x, y, xi, yi, z);
 	tev.Draw();
 }
 
-static void InitTriangle(float X1, float Y1, s32 xi, s32 yi)
+static void InitTriangle(Triangle* tri, float X1, float Y1, s32 xi, s32 yi)
 {
-	vertex0X = xi;
-	vertex0Y = yi;
+	tri->vertex0X = xi;
+	tri->vertex0Y = yi;
 
 	// adjust a little less than 0.5
 	const float adjust = 0.495f;
 
-	vertexOffsetX = ((float)xi - X1) + adjust;
-	vertexOffsetY = ((float)yi - Y1) + adjust;
+	tri->vertexOffsetX = ((float)xi - X1) + adjust;
+	tri->vertexOffsetY = ((float)yi - Y1) + adjust;
 }
 
 static void InitSlope(Slope *slope, float f1, float f2, float f3, float DX31, float DX12, float DY12, float DY31)
@@ -186,7 +305,7 @@ static void InitSlope(Slope *slope, float f1, float f2, float f3, float DX31, fl
 	slope->f0 = f1;
 }
 
-static inline void CalculateLOD(s32* lodp, bool* linear, u32 texmap, u32 texcoord)
+static inline void CalculateLOD(const RasterBlock& rasterBlock, s32* lodp, bool* linear, u32 texmap, u32 texcoord)
 {
 	const FourTexUnits& texUnit = bpmem.tex[(texmap >> 2) & 1];
 	const u8 subTexmap = texmap & 3;
@@ -199,17 +318,17 @@ static inline void CalculateLOD(s32* lodp, bool* linear, u32 texmap, u32 texcoor
 	float sDelta, tDelta;
 	if (tm0.diag_lod)
 	{
-		float *uv0 = rasterBlock.Pixel[0][0].Uv[texcoord];
-		float *uv1 = rasterBlock.Pixel[1][1].Uv[texcoord];
+		const float *uv0 = rasterBlock.Pixel[0][0].Uv[texcoord];
+		const float *uv1 = rasterBlock.Pixel[1][1].Uv[texcoord];
 
 		sDelta = fabsf(uv0[0] - uv1[0]);
 		tDelta = fabsf(uv0[1] - uv1[1]);
 	}
 	else
 	{
-		float *uv0 = rasterBlock.Pixel[0][0].Uv[texcoord];
-		float *uv1 = rasterBlock.Pixel[1][0].Uv[texcoord];
-		float *uv2 = rasterBlock.Pixel[0][1].Uv[texcoord];
+		const float *uv0 = rasterBlock.Pixel[0][0].Uv[texcoord];
+		const float *uv1 = rasterBlock.Pixel[1][0].Uv[texcoord];
+		const float *uv2 = rasterBlock.Pixel[0][1].Uv[texcoord];
 
 		sDelta = std::max(fabsf(uv0[0] - uv1[0]), fabsf(uv0[0] - uv2[0]));
 		tDelta = std::max(fabsf(uv0[1] - uv1[1]), fabsf(uv0[1] - uv2[1]));
@@ -234,18 +353,19 @@ static inline void CalculateLOD(s32* lodp, bool* linear, u32 texmap, u32 texcoor
 	*lodp = lod;
 }
 
-static void BuildBlock(s32 blockX, s32 blockY)
+static void BuildBlock(PixelContext& context, const Triangle& tri, s32 blockX, s32 blockY)
 {
+	RasterBlock& rasterBlock = context.rasterBlock;
 	for (s32 yi = 0; yi < BLOCK_SIZE; yi++)
 	{
 		for (s32 xi = 0; xi < BLOCK_SIZE; xi++)
 		{
 			RasterBlockPixel& pixel = rasterBlock.Pixel[xi][yi];
 
-			float dx = vertexOffsetX + (float)(xi + blockX - vertex0X);
-			float dy = vertexOffsetY + (float)(yi + blockY - vertex0Y);
+			float dx = tri.vertexOffsetX + (float)(xi + blockX - tri.vertex0X);
+			float dy = tri.vertexOffsetY + (float)(yi + blockY - tri.vertex0Y);
 
-			float invW = 1.0f / WSlope.GetValue(dx, dy);
+			float invW = 1.0f / tri.WSlope.GetValue(dx, dy);
 			pixel.InvW = invW;
 
 			// tex coords
@@ -254,13 +374,13 @@ static void BuildBlock(s32 blockX, s32 blockY)
 				float projection = invW;
 				if (xfmem.texMtxInfo[i].projection)
 				{
-					float q = TexSlopes[i][2].GetValue(dx, dy) * invW;
+					float q = tri.TexSlopes[i][2].GetValue(dx, dy) * invW;
 					if (q != 0.0f)
 						projection = invW / q;
 				}
 
-				pixel.Uv[i][0] = TexSlopes[i][0].GetValue(dx, dy) * projection;
-				pixel.Uv[i][1] = TexSlopes[i][1].GetValue(dx, dy) * projection;
+				pixel.Uv[i][0] = tri.TexSlopes[i][0].GetValue(dx, dy) * projection;
+				pixel.Uv[i][1] = tri.TexSlopes[i][1].GetValue(dx, dy) * projection;
 			}
 		}
 	}
@@ -273,7 +393,7 @@ static void BuildBlock(s32 blockX, s32 blockY)
 		u32 texcoord = indref & 3;
 		indref >>= 3;
 
-		CalculateLOD(&rasterBlock.IndirectLod[i], &rasterBlock.IndirectLinear[i], texmap, texcoord);
+		CalculateLOD(rasterBlock, &rasterBlock.IndirectLod[i], &rasterBlock.IndirectLinear[i], texmap, texcoord);
 	}
 
 	for (unsigned int i = 0; i <= bpmem.genMode.numtevstages; i++)
@@ -285,12 +405,12 @@ static void BuildBlock(s32 blockX, s32 blockY)
 			u32 texmap = order.getTexMap(stageOdd);
 			u32 texcoord = order.getTexCoord(stageOdd);
 
-			CalculateLOD(&rasterBlock.TextureLod[i], &rasterBlock.TextureLinear[i], texmap, texcoord);
+			CalculateLOD(rasterBlock, &rasterBlock.TextureLod[i], &rasterBlock.TextureLinear[i], texmap, texcoord);
 		}
 	}
 }
 
-static inline void PrepareBlock(s32 blockX, s32 blockY)
+static inline void PrepareBlock(PixelContext& context, const Triangle& tri, s32 blockX, s32 blockY)
 {
 	static s32 x = -1;
 	static s32 y = -1;
@@ -302,34 +422,16 @@ static inline void PrepareBlock(s32 blockX, s32 blockY)
 	{
 		x = blockX;
 		y = blockY;
-		BuildBlock(x, y);
+		BuildBlock(context, tri, x, y);
 	}
 }
 
-void DrawTriangleFrontFace(OutputVertexData *v0, OutputVertexData *v1, OutputVertexData *v2)
+// Draws the blocks of tri that start in [left, right) x [top, bottom), which are multiples of the block size
+static void DrawBlocks(PixelContext& context, const Triangle& tri, s32 left, s32 top, s32 right, s32 bottom)
 {
-	INCSTAT(stats.thisFrame.numTrianglesDrawn);
-
-	// adapted from http://devmaster.net/posts/6145/advanced-rasterization
-
-	// 28.4 fixed-pou32 coordinates. rounded to nearest and adjusted to match hardware output
-	// could also take floor and adjust -8
-	const s32 Y1 = iround(16.0f * v0->screenPosition[1]) - 9;
-	const s32 Y2 = iround(16.0f * v1->screenPosition[1]) - 9;
-	const s32 Y3 = iround(16.0f * v2->screenPosition[1]) - 9;
-
-	const s32 X1 = iround(16.0f * v0->screenPosition[0]) - 9;
-	const s32 X2 = iround(16.0f * v1->screenPosition[0]) - 9;
-	const s32 X3 = iround(16.0f * v2->screenPosition[0]) - 9;
-
-	// Deltas
-	const s32 DX12 = X1 - X2;
-	const s32 DX23 = X2 - X3;
-	const s32 DX31 = X3 - X1;
-
-	const s32 DY12 = Y1 - Y2;
-	const s32 DY23 = Y2 - Y3;
-	const s32 DY31 = Y3 - Y1;
+	const s32 C1 = tri.C1, C2 = tri.C2, C3 = tri.C3;
+	const s32 DX12 = tri.DX12, DX23 = tri.DX23, DX31 = tri.DX31;
+	const s32 DY12 = tri.DY12, DY23 = tri.DY23, DY31 = tri.DY31;
 
 	// Fixed-pos32 deltas
 	const s32 FDX12 = DX12 * 16;
@@ -340,208 +442,208 @@ void DrawTriangleFrontFace(OutputVertexData *v0, OutputVertexData *v1, OutputVer
 	const s32 FDY23 = DY23 * 16;
 	const s32 FDY31 = DY31 * 16;
 
-	// Bounding rectangle
-	s32 minx = (std::min(std::min(X1, X2), X3) + 0xF) >> 4;
-	s32 maxx = (std::max(std::max(X1, X2), X3) + 0xF) >> 4;
-	s32 miny = (std::min(std::min(Y1, Y2), Y3) + 0xF) >> 4;
-	s32 maxy = (std::max(std::max(Y1, Y2), Y3) + 0xF) >> 4;
-
-	// scissor
-	minx = std::max(minx, scissorLeft);
-	maxx = std::min(maxx, scissorRight);
-	miny = std::max(miny, scissorTop);
-	maxy = std::min(maxy, scissorBottom);
-
-	if (minx >= maxx || miny >= maxy)
-		return;
-
-	// Setup slopes
-	float fltx1 = v0->screenPosition.x;
-	float flty1 = v0->screenPosition.y;
-	float fltdx31 = v2->screenPosition.x - fltx1;
-	float fltdx12 = fltx1 - v1->screenPosition.x;
-	float fltdy12 = flty1 - v1->screenPosition.y;
-	float fltdy31 = v2->screenPosition.y - flty1;
-
-	InitTriangle(fltx1, flty1, (X1 + 0xF) >> 4, (Y1 + 0xF) >> 4);
-
-	float w[3] = {1.0f / v0->projectedPosition.w, 1.0f / v1->projectedPosition.w, 1.0f / v2->projectedPosition.w};
-	InitSlope(&WSlope, w[0], w[1], w[2], fltdx31, fltdx12, fltdy12, fltdy31);
-
-	// TODO: The zfreeze emulation is not quite correct, yet!
-	// Many things might prevent us from reaching this line (culling, clipping, scissoring).
-	// However, the zslope is always guaranteed to be calculated unless all vertices are trivially rejected during clipping!
-	// We're currently sloppy at this since we abort early if any of the culling/clipping/scissoring tests fail.
-	if (!bpmem.genMode.zfreeze || !g_ActiveConfig.bZFreeze)
-		InitSlope(&ZSlope, v0->screenPosition[2], v1->screenPosition[2], v2->screenPosition[2], fltdx31, fltdx12, fltdy12, fltdy31);
-
-	for (unsigned int i = 0; i < bpmem.genMode.numcolchans; i++)
-	{
-		for (int comp = 0; comp < 4; comp++)
-			InitSlope(&ColorSlopes[i][comp], v0->color[i][comp], v1->color[i][comp], v2->color[i][comp], fltdx31, fltdx12, fltdy12, fltdy31);
-	}
+	// Start in corner of 8x8 block
+	const s32 minx = std::max(tri.minx & ~(BLOCK_SIZE - 1), left);
+	const s32 miny = std::max(tri.miny & ~(BLOCK_SIZE - 1), top);
+	const s32 maxx = std::min(tri.maxx, right);
+	const s32 maxy = std::min(tri.maxy, bottom);
 
-	for (unsigned int i = 0; i < bpmem.genMode.numtexgens; i++)
+	// Loop through blocks
+	for (s32 y = miny; y < maxy; y += BLOCK_SIZE)
 	{
-		for (int comp = 0; comp < 3; comp++)
-			InitSlope(&TexSlopes[i][comp], v0->texCoords[i][comp] * w[0], v1->texCoords[i][comp] * w[1], v2->texCoords[i][comp] * w[2], fltdx31, fltdx12, fltdy12, fltdy31);
-	}
-
-	// Half-edge constants
-	s32 C1 = DY12 * X1 - DX12 * Y1;
-	s32 C2 = DY23 * X2 - DX23 * Y2;
-	s32 C3 = DY31 * X3 - DX31 * Y3;
-
-	// Correct for fill convention
-	if (DY12 < 0 || (DY12 == 0 && DX12 > 0)) C1++;
-	if (DY23 < 0 || (DY23 == 0 && DX23 > 0)) C2++;
-	if (DY31 < 0 || (DY31 == 0 && DX31 > 0)) C3++;
-
-	if (!BoundingBox::active)
-	{
-		// Start in corner of 8x8 block
-		minx &= ~(BLOCK_SIZE - 1);
-		miny &= ~(BLOCK_SIZE - 1);
-		// Loop through blocks
-		for (s32 y = miny; y < maxy; y += BLOCK_SIZE)
+		for (s32 x = minx; x < maxx; x += BLOCK_SIZE)
 		{
-			for (s32 x = minx; x < maxx; x += BLOCK_SIZE)
+			// Corners of block
+			s32 x0 = x << 4;
+			s32 x1 = (x + BLOCK_SIZE - 1) << 4;
+			s32 y0 = y << 4;
+			s32 y1 = (y + BLOCK_SIZE - 1) << 4;
+
+			// Evaluate half-space functions
+			bool a00 = C1 + DX12 * y0 - DY12 * x0 > 0;
+			bool a10 = C1 + DX12 * y0 - DY12 * x1 > 0;
+			bool a01 = C1 + DX12 * y1 - DY12 * x0 > 0;
+			bool a11 = C1 + DX12 * y1 - DY12 * x1 > 0;
+			int a = (a00 << 0) | (a10 << 1) | (a01 << 2) | (a11 << 3);
+
+			bool b00 = C2 + DX23 * y0 - DY23 * x0 > 0;
+			bool b10 = C2 + DX23 * y0 - DY23 * x1 > 0;
+			bool b01 = C2 + DX23 * y1 - DY23 * x0 > 0;
+			bool b11 = C2 + DX23 * y1 - DY23 * x1 > 0;
+			int b = (b00 << 0) | (b10 << 1) | (b01 << 2) | (b11 << 3);
+
+			bool c00 = C3 + DX31 * y0 - DY31 * x0 > 0;
+			bool c10 = C3 + DX31 * y0 - DY31 * x1 > 0;
+			bool c01 = C3 + DX31 * y1 - DY31 * x0 > 0;
+			bool c11 = C3 + DX31 * y1 - DY31 * x1 > 0;
+			int c = (c00 << 0) | (c10 << 1) | (c01 << 2) | (c11 << 3);
+
+			// Skip block when outside an edge
+			if (a == 0x0 || b == 0x0 || c == 0x0)
+				continue;
+
+			BuildBlock(context, tri, x, y);
+			if (context.tev.IndependentPixels)
+				SetLastPosition(&context.lastBlock, context.triangle, x, y, false);
+
+			// Accept whole block when totally covered
+			if (a == 0xF && b == 0xF && c == 0xF)
 			{
-				// Corners of block
-				s32 x0 = x << 4;
-				s32 x1 = (x + BLOCK_SIZE - 1) << 4;
-				s32 y0 = y << 4;
-				s32 y1 = (y + BLOCK_SIZE - 1) << 4;
-
-				// Evaluate half-space functions
-				bool a00 = C1 + DX12 * y0 - DY12 * x0 > 0;
-				bool a10 = C1 + DX12 * y0 - DY12 * x1 > 0;
-				bool a01 = C1 + DX12 * y1 - DY12 * x0 > 0;
-				bool a11 = C1 + DX12 * y1 - DY12 * x1 > 0;
-				int a = (a00 << 0) | (a10 << 1) | (a01 << 2) | (a11 << 3);
-
-				bool b00 = C2 + DX23 * y0 - DY23 * x0 > 0;
-				bool b10 = C2 + DX23 * y0 - DY23 * x1 > 0;
-				bool b01 = C2 + DX23 * y1 - DY23 * x0 > 0;
-				bool b11 = C2 + DX23 * y1 - DY23 * x1 > 0;
-				int b = (b00 << 0) | (b10 << 1) | (b01 << 2) | (b11 << 3);
-
-				bool c00 = C3 + DX31 * y0 - DY31 * x0 > 0;
-				bool c10 = C3 + DX31 * y0 - DY31 * x1 > 0;
-				bool c01 = C3 + DX31 * y1 - DY31 * x0 > 0;
-				bool c11 = C3 + DX31 * y1 - DY31 * x1 > 0;
-				int c = (c00 << 0) | (c10 << 1) | (c01 << 2) | (c11 << 3);
-
-				// Skip block when outside an edge
-				if (a == 0x0 || b == 0x0 || c == 0x0)
-					continue;
-
-				BuildBlock(x, y);
-
-				// Accept whole block when totally covered
-				if (a == 0xF && b == 0xF && c == 0xF)
+				for (s32 iy = 0; iy < BLOCK_SIZE; iy++)
 				{
-					for (s32 iy = 0; iy < BLOCK_SIZE; iy++)
+					for (s32 ix = 0; ix < BLOCK_SIZE; ix++)
 					{
-						for (s32 ix = 0; ix < BLOCK_SIZE; ix++)
-						{
-							Draw(x + ix, y + iy, ix, iy);
-						}
+						Draw(context, tri, x + ix, y + iy, ix, iy);
 					}
 				}
-				else // Partially covered block
+			}
+			else // Partially covered block
+			{
+				s32 CY1 = C1 + DX12 * y0 - DY12 * x0;
+				s32 CY2 = C2 + DX23 * y0 - DY23 * x0;
+				s32 CY3 = C3 + DX31 * y0 - DY31 * x0;
+
+				for (s32 iy = 0; iy < BLOCK_SIZE; iy++)
 				{
-					s32 CY1 = C1 + DX12 * y0 - DY12 * x0;
-					s32 CY2 = C2 + DX23 * y0 - DY23 * x0;
-					s32 CY3 = C3 + DX31 * y0 - DY31 * x0;
+					s32 CX1 = CY1;
+					s32 CX2 = CY2;
+					s32 CX3 = CY3;
 
-					for (s32 iy = 0; iy < BLOCK_SIZE; iy++)
+					for (s32 ix = 0; ix < BLOCK_SIZE; ix++)
 					{
-						s32 CX1 = CY1;
-						s32 CX2 = CY2;
-						s32 CX3 = CY3;
-
-						for (s32 ix = 0; ix < BLOCK_SIZE; ix++)
+						if (CX1 > 0 && CX2 > 0 && CX3 > 0)
 						{
-							if (CX1 > 0 && CX2 > 0 && CX3 > 0)
-							{
-								Draw(x + ix, y + iy, ix, iy);
-							}
-
-							CX1 -= FDY12;
-							CX2 -= FDY23;
-							CX3 -= FDY31;
+							Draw(context, tri, x + ix, y + iy, ix, iy);
 						}
 
-						CY1 += FDX12;
-						CY2 += FDX23;
-						CY3 += FDX31;
+						CX1 -= FDY12;
+						CX2 -= FDY23;
+						CX3 -= FDY31;
 					}
+
+					CY1 += FDX12;
+					CY2 += FDX23;
+					CY3 += FDX31;
 				}
 			}
 		}
 	}
-	else
+}
+
+// Reads and updates the bounding box as it goes, so it is never binned
+static void DrawBoundingBox(PixelContext& context, const Triangle& tri)
+{
+	const s32 C1 = tri.C1, C2 = tri.C2, C3 = tri.C3;
+	const s32 DX12 = tri.DX12, DX23 = tri.DX23, DX31 = tri.DX31;
+	const s32 DY12 = tri.DY12, DY23 = tri.DY23, DY31 = tri.DY31;
+
+	const s32 FDX12 = DX12 * 16;
+	const s32 FDX23 = DX23 * 16;
+	const s32 FDX31 = DX31 * 16;
+
+	const s32 FDY12 = DY12 * 16;
+	const s32 FDY23 = DY23 * 16;
+	const s32 FDY31 = DY31 * 16;
+
+	s32 minx = tri.minx;
+	s32 maxx = tri.maxx;
+	s32 miny = tri.miny;
+	s32 maxy = tri.maxy;
+
+	// Calculating bbox
+	// First check for alpha channel - don't do anything it if always fails,
+	// Change bbox to primitive size if it always passes
+	AlphaTest::TEST_RESULT alphaRes = bpmem.alpha_test.TestResult();
+
+	if (alphaRes != AlphaTest::UNDETERMINED)
+	{
+		if (alphaRes == AlphaTest::PASS)
+		{
+			BoundingBox::coords[BoundingBox::TOP] = std::min(BoundingBox::coords[BoundingBox::TOP], (u16)miny);
+			BoundingBox::coords[BoundingBox::LEFT] = std::min(BoundingBox::coords[BoundingBox::LEFT], (u16)minx);
+			BoundingBox::coords[BoundingBox::BOTTOM] = std::max(BoundingBox::coords[BoundingBox::BOTTOM], (u16)maxy);
+			BoundingBox::coords[BoundingBox::RIGHT] = std::max(BoundingBox::coords[BoundingBox::RIGHT], (u16)maxx);
+		}
+		return;
+	}
+
+	// If we are calculating bbox with alpha, we only need to find the
+	// topmost, leftmost, bottom most and rightmost pixels to be drawn.
+	// So instead of drawing every single one of the triangle's pixels,
+	// four loops are run: one for the top pixel, one for the left, one for
+	// the bottom and one for the right. As soon as a pixel that is to be
+	// drawn is found, the loop breaks. This enables a ~150% speedbost in
+	// bbox calculation, albeit at the cost of some ugly repetitive code.
+	const s32 FLEFT = minx << 4;
+	const s32 FRIGHT = maxx << 4;
+	s32 FTOP = miny << 4;
+	s32 FBOTTOM = maxy << 4;
+
+	// Start checking for bbox top
+	s32 CY1 = C1 + DX12 * FTOP - DY12 * FLEFT;
+	s32 CY2 = C2 + DX23 * FTOP - DY23 * FLEFT;
+	s32 CY3 = C3 + DX31 * FTOP - DY31 * FLEFT;
+
+	// Loop
+	for (s32 y = miny; y <= maxy; ++y)
 	{
-		// Calculating bbox
-		// First check for alpha channel - don't do anything it if always fails,
-		// Change bbox to primitive size if it always passes
-		AlphaTest::TEST_RESULT alphaRes = bpmem.alpha_test.TestResult();
+		if (y >= BoundingBox::coords[BoundingBox::TOP])
+			break;
+
+		s32 CX1 = CY1;
+		s32 CX2 = CY2;
+		s32 CX3 = CY3;
 
-		if (alphaRes != AlphaTest::UNDETERMINED)
+		for (s32 x = minx; x <= maxx; ++x)
 		{
-			if (alphaRes == AlphaTest::PASS)
+			if (CX1 > 0 && CX2 > 0 && CX3 > 0)
 			{
-				BoundingBox::coords[BoundingBox::TOP] = std::min(BoundingBox::coords[BoundingBox::TOP], (u16)miny);
-				BoundingBox::coords[BoundingBox::LEFT] = std::min(BoundingBox::coords[BoundingBox::LEFT], (u16)minx);
-				BoundingBox::coords[BoundingBox::BOTTOM] = std::max(BoundingBox::coords[BoundingBox::BOTTOM], (u16)maxy);
-				BoundingBox::coords[BoundingBox::RIGHT] = std::max(BoundingBox::coords[BoundingBox::RIGHT], (u16)maxx);
+				// Build the new raster block every other pixel
+				PrepareBlock(context, tri, x, y);
+				Draw(context, tri, x, y, x & (BLOCK_SIZE - 1), y & (BLOCK_SIZE - 1));
+
+				if (y >= BoundingBox::coords[BoundingBox::TOP])
+					break;
 			}
-			return;
+
+			CX1 -= FDY12;
+			CX2 -= FDY23;
+			CX3 -= FDY31;
 		}
 
-		// If we are calculating bbox with alpha, we only need to find the
-		// topmost, leftmost, bottom most and rightmost pixels to be drawn.
-		// So instead of drawing every single one of the triangle's pixels,
-		// four loops are run: one for the top pixel, one for the left, one for
-		// the bottom and one for the right. As soon as a pixel that is to be
-		// drawn is found, the loop breaks. This enables a ~150% speedbost in
-		// bbox calculation, albeit at the cost of some ugly repetitive code.
-		const s32 FLEFT = minx << 4;
-		const s32 FRIGHT = maxx << 4;
-		s32 FTOP = miny << 4;
-		s32 FBOTTOM = maxy << 4;
-
-		// Start checking for bbox top
-		s32 CY1 = C1 + DX12 * FTOP - DY12 * FLEFT;
-		s32 CY2 = C2 + DX23 * FTOP - DY23 * FLEFT;
-		s32 CY3 = C3 + DX31 * FTOP - DY31 * FLEFT;
-
-		// Loop
-		for (s32 y = miny; y <= maxy; ++y)
-		{
-			if (y >= BoundingBox::coords[BoundingBox::TOP])
-				break;
+		CY1 += FDX12;
+		CY2 += FDX23;
+		CY3 += FDX31;
+	}
 
-			s32 CX1 = CY1;
-			s32 CX2 = CY2;
-			s32 CX3 = CY3;
+	// Update top limit
+	miny = std::max((s32)BoundingBox::coords[BoundingBox::TOP], miny);
+	FTOP = miny << 4;
 
-			for (s32 x = minx; x <= maxx; ++x)
-			{
-				if (CX1 > 0 && CX2 > 0 && CX3 > 0)
-				{
-					// Build the new raster block every other pixel
-					PrepareBlock(x, y);
-					Draw(x, y, x & (BLOCK_SIZE - 1), y & (BLOCK_SIZE - 1));
+	// Checking for bbox left
+	s32 CX1 = C1 + DX12 * FTOP - DY12 * FLEFT;
+	s32 CX2 = C2 + DX23 * FTOP - DY23 * FLEFT;
+	s32 CX3 = C3 + DX31 * FTOP - DY31 * FLEFT;
 
-					if (y >= BoundingBox::coords[BoundingBox::TOP])
-						break;
-				}
+	// Loop
+	for (s32 x = minx; x <= maxx; ++x)
+	{
+		if (x >= BoundingBox::coords[BoundingBox::LEFT])
+			break;
+
+		CY1 = CX1;
+		CY2 = CX2;
+		CY3 = CX3;
+
+		for (s32 y = miny; y <= maxy; ++y)
+		{
+			if (CY1 > 0 && CY2 > 0 && CY3 > 0)
+			{
+				PrepareBlock(context, tri, x, y);
+				Draw(context, tri, x, y, x & (BLOCK_SIZE - 1), y & (BLOCK_SIZE - 1));
 
-				CX1 -= FDY12;
-				CX2 -= FDY23;
-				CX3 -= FDY31;
+				if (x >= BoundingBox::coords[BoundingBox::LEFT])
+					break;
 			}
 
 			CY1 += FDX12;
@@ -549,79 +651,80 @@ void DrawTriangleFrontFace(OutputVertexData *v0, OutputVertexData *v1, OutputVer
 			CY3 += FDX31;
 		}
 
-		// Update top limit
-		miny = std::max((s32)BoundingBox::coords[BoundingBox::TOP], miny);
-		FTOP = miny << 4;
+		CX1 -= FDY12;
+		CX2 -= FDY23;
+		CX3 -= FDY31;
+	}
 
-		// Checking for bbox left
-		s32 CX1 = C1 + DX12 * FTOP - DY12 * FLEFT;
-		s32 CX2 = C2 + DX23 * FTOP - DY23 * FLEFT;
-		s32 CX3 = C3 + DX31 * FTOP - DY31 * FLEFT;
+	// Update left limit
+	minx = std::max((s32)BoundingBox::coords[BoundingBox::LEFT], minx);
 
-		// Loop
-		for (s32 x = minx; x <= maxx; ++x)
-		{
-			if (x >= BoundingBox::coords[BoundingBox::LEFT])
-				break;
+	// Checking for bbox bottom
+	CY1 = C1 + DX12 * FBOTTOM - DY12 * FRIGHT;
+	CY2 = C2 + DX23 * FBOTTOM - DY23 * FRIGHT;
+	CY3 = C3 + DX31 * FBOTTOM - DY31 * FRIGHT;
 
-			CY1 = CX1;
-			CY2 = CX2;
-			CY3 = CX3;
+	// Loop
+	for (s32 y = maxy; y >= miny; --y)
+	{
+		CX1 = CY1;
+		CX2 = CY2;
+		CX3 = CY3;
 
-			for (s32 y = miny; y <= maxy; ++y)
-			{
-				if (CY1 > 0 && CY2 > 0 && CY3 > 0)
-				{
-					PrepareBlock(x, y);
-					Draw(x, y, x & (BLOCK_SIZE - 1), y & (BLOCK_SIZE - 1));
+		if (y <= BoundingBox::coords[BoundingBox::BOTTOM])
+			break;
 
-					if (x >= BoundingBox::coords[BoundingBox::LEFT])
-						break;
-				}
+		for (s32 x = maxx; x >= minx; --x)
+		{
+			if (CX1 > 0 && CX2 > 0 && CX3 > 0)
+			{
+				// Build the new raster block every other pixel
+				PrepareBlock(context, tri, x, y);
+				Draw(context, tri, x, y, x & (BLOCK_SIZE - 1), y & (BLOCK_SIZE - 1));
 
-				CY1 += FDX12;
-				CY2 += FDX23;
-				CY3 += FDX31;
+				if (y <= BoundingBox::coords[BoundingBox::BOTTOM])
+					break;
 			}
 
-			CX1 -= FDY12;
-			CX2 -= FDY23;
-			CX3 -= FDY31;
+			CX1 += FDY12;
+			CX2 += FDY23;
+			CX3 += FDY31;
 		}
 
-		// Update left limit
-		minx = std::max((s32)BoundingBox::coords[BoundingBox::LEFT], minx);
+		CY1 -= FDX12;
+		CY2 -= FDX23;
+		CY3 -= FDX31;
+	}
 
-		// Checking for bbox bottom
-		CY1 = C1 + DX12 * FBOTTOM - DY12 * FRIGHT;
-		CY2 = C2 + DX23 * FBOTTOM - DY23 * FRIGHT;
-		CY3 = C3 + DX31 * FBOTTOM - DY31 * FRIGHT;
+	// Update bottom limit
+	maxy = std::min((s32)BoundingBox::coords[BoundingBox::BOTTOM], maxy);
+	FBOTTOM = maxy << 4;
 
-		// Loop
-		for (s32 y = maxy; y >= miny; --y)
-		{
-			CX1 = CY1;
-			CX2 = CY2;
-			CX3 = CY3;
+	// Checking for bbox right
+	CX1 = C1 + DX12 * FBOTTOM - DY12 * FRIGHT;
+	CX2 = C2 + DX23 * FBOTTOM - DY23 * FRIGHT;
+	CX3 = C3 + DX31 * FBOTTOM - DY31 * FRIGHT;
 
-			if (y <= BoundingBox::coords[BoundingBox::BOTTOM])
-				break;
+	// Loop
+	for (s32 x = maxx; x >= minx; --x)
+	{
+		if (x <= BoundingBox::coords[BoundingBox::RIGHT])
+			break;
 
-			for (s32 x = maxx; x >= minx; --x)
-			{
-				if (CX1 > 0 && CX2 > 0 && CX3 > 0)
-				{
-					// Build the new raster block every other pixel
-					PrepareBlock(x, y);
-					Draw(x, y, x & (BLOCK_SIZE - 1), y & (BLOCK_SIZE - 1));
+		CY1 = CX1;
+		CY2 = CX2;
+		CY3 = CX3;
 
-					if (y <= BoundingBox::coords[BoundingBox::BOTTOM])
-						break;
-				}
+		for (s32 y = maxy; y >= miny; --y)
+		{
+			if (CY1 > 0 && CY2 > 0 && CY3 > 0)
+			{
+				// Build the new raster block every other pixel
+				PrepareBlock(context, tri, x, y);
+				Draw(context, tri, x, y, x & (BLOCK_SIZE - 1), y & (BLOCK_SIZE - 1));
 
-				CX1 += FDY12;
-				CX2 += FDY23;
-				CX3 += FDY31;
+				if (x <= BoundingBox::coords[BoundingBox::RIGHT])
+					break;
 			}
 
 			CY1 -= FDX12;
@@ -629,47 +732,206 @@ void DrawTriangleFrontFace(OutputVertexData *v0, OutputVertexData *v1, OutputVer
 			CY3 -= FDX31;
 		}
 
-		// Update bottom limit
-		maxy = std::min((s32)BoundingBox::coords[BoundingBox::BOTTOM], maxy);
-		FBOTTOM = maxy << 4;
+		CX1 += FDY12;
+		CX2 += FDY23;
+		CX3 += FDY31;
+	}
+}
 
-		// Checking for bbox right
-		CX1 = C1 + DX12 * FBOTTOM - DY12 * FRIGHT;
-		CX2 = C2 + DX23 * FBOTTOM - DY23 * FRIGHT;
-		CX3 = C3 + DX31 * FBOTTOM - DY31 * FRIGHT;
+static void DrawTile(PixelContext& context, u32 tile)
+{
+	const s32 left = (tile % TILES_X) * TILE_SIZE;
+	const s32 top = (tile / TILES_X) * TILE_SIZE;
+	for (u32 index : bins[tile])
+	{
+		context.triangle = index;
+		DrawBlocks(context, triangles[index], left, top, left + TILE_SIZE, top + TILE_SIZE);
+	}
+}
 
-		// Loop
-		for (s32 x = maxx; x >= minx; --x)
-		{
-			if (x <= BoundingBox::coords[BoundingBox::RIGHT])
-				break;
+static void DrawTiles()
+{
+	if (usedTiles.empty())
+		return;
 
-			CY1 = CX1;
-			CY2 = CX2;
-			CY3 = CX3;
+	const bool parallel = binnedPixels >= PARALLEL_MIN_PIXELS;
+	// The loop runs at most two bands per thread, each band takes a context of its own
+	const size_t contextCount = 1 + (parallel ? (Common::ThreadPool::WorkerCount() + 1) * 2 : 1);
+	while (contexts.size() < contextCount)
+	{
+		AddContext();
+		contexts.back()->tev.IndependentPixels = true;
+	}
+	for (size_t i = 1; i < contexts.size(); i++)
+		contexts[i]->lastBlock.order = contexts[i]->lastPixel.order = 0;
+
+	nextContext.store(1);
+	Common::ThreadPool::Loop([](int lower, int upper) {
+		PixelContext& context = *contexts[nextContext++];
+		for (int i = lower; i < upper; i++)
+			DrawTile(context, usedTiles[i]);
+	}, 0, (int)usedTiles.size(), 1, parallel ? 0 : 1);
+
+	// Combine the last pixel drawn and build the last block the way contexts[0] would have
+	DrawPosition lastBlock = {};
+	DrawPosition lastPixel = {};
+	for (size_t i = 1; i < contexts.size(); i++)
+	{
+		if (contexts[i]->lastBlock.order > lastBlock.order)
+			lastBlock = contexts[i]->lastBlock;
+		if (contexts[i]->lastPixel.order > lastPixel.order)
+			lastPixel = contexts[i]->lastPixel;
+	}
+	PixelContext& context = *contexts[0];
+	if (lastPixel.order)
+	{
+		const Triangle& tri = triangles[lastPixel.triangle];
+		const s32 x = lastPixel.x;
+		const s32 y = lastPixel.y;
+		BuildBlock(context, tri, x & ~(BLOCK_SIZE - 1), y & ~(BLOCK_SIZE - 1));
+		float dx = tri.vertexOffsetX + (float)(x - tri.vertex0X);
+		float dy = tri.vertexOffsetY + (float)(y - tri.vertex0Y);
+		s32 z = (s32)MathUtil::Clamp<float>(tri.ZSlope.GetValue(dx, dy), 0.0f, 16777215.0f);
+		SetPixelInputs(context, tri, x, y, x & (BLOCK_SIZE - 1), y & (BLOCK_SIZE - 1), z);
+		context.tev.Combine();
+	}
+	if (lastBlock.order)
+		BuildBlock(context, triangles[lastBlock.triangle], lastBlock.x, lastBlock.y);
+
+	for (u32 tile : usedTiles)
+		bins[tile].clear();
+	usedTiles.clear();
+	triangles.clear();
+	binnedPixels = 0;
+}
 
-			for (s32 y = maxy; y >= miny; --y)
-			{
-				if (CY1 > 0 && CY2 > 0 && CY3 > 0)
-				{
-					// Build the new raster block every other pixel
-					PrepareBlock(x, y);
-					Draw(x, y, x & (BLOCK_SIZE - 1), y & (BLOCK_SIZE - 1));
+void DrawTriangleFrontFace(OutputVertexData *v0, OutputVertexData *v1, OutputVertexData *v2)
+{
+	INCSTAT(stats.thisFrame.numTrianglesDrawn);
 
-					if (x <= BoundingBox::coords[BoundingBox::RIGHT])
-						break;
-				}
+	// adapted from http://devmaster.net/posts/6145/advanced-rasterization
 
-				CY1 -= FDX12;
-				CY2 -= FDX23;
-				CY3 -= FDX31;
-			}
+	// 28.4 fixed-pou32 coordinates. rounded to nearest and adjusted to match hardware output
+	// could also take floor and adjust -8
+	const s32 Y1 = iround(16.0f * v0->screenPosition[1]) - 9;
+	const s32 Y2 = iround(16.0f * v1->screenPosition[1]) - 9;
+	const s32 Y3 = iround(16.0f * v2->screenPosition[1]) - 9;
 
-			CX1 += FDY12;
-			CX2 += FDY23;
-			CX3 += FDY31;
+	const s32 X1 = iround(16.0f * v0->screenPosition[0]) - 9;
+	const s32 X2 = iround(16.0f * v1->screenPosition[0]) - 9;
+	const s32 X3 = iround(16.0f * v2->screenPosition[0]) - 9;
+
+	Triangle tri;
+
+	// Deltas
+	tri.DX12 = X1 - X2;
+	tri.DX23 = X2 - X3;
+	tri.DX31 = X3 - X1;
+
+	tri.DY12 = Y1 - Y2;
+	tri.DY23 = Y2 - Y3;
+	tri.DY31 = Y3 - Y1;
+
+	// Bounding rectangle
+	s32 minx = (std::min(std::min(X1, X2), X3) + 0xF) >> 4;
+	s32 maxx = (std::max(std::max(X1, X2), X3) + 0xF) >> 4;
+	s32 miny = (std::min(std::min(Y1, Y2), Y3) + 0xF) >> 4;
+	s32 maxy = (std::max(std::max(Y1, Y2), Y3) + 0xF) >> 4;
+
+	// scissor
+	minx = std::max(minx, scissorLeft);
+	maxx = std::min(maxx, scissorRight);
+	miny = std::max(miny, scissorTop);
+	maxy = std::min(maxy, scissorBottom);
+
+	if (minx >= maxx || miny >= maxy)
+		return;
+
+	tri.minx = minx;
+	tri.maxx = maxx;
+	tri.miny = miny;
+	tri.maxy = maxy;
+
+	// Setup slopes
+	float fltx1 = v0->screenPosition.x;
+	float flty1 = v0->screenPosition.y;
+	float fltdx31 = v2->screenPosition.x - fltx1;
+	float fltdx12 = fltx1 - v1->screenPosition.x;
+	float fltdy12 = flty1 - v1->screenPosition.y;
+	float fltdy31 = v2->screenPosition.y - flty1;
+
+	InitTriangle(&tri, fltx1, flty1, (X1 + 0xF) >> 4, (Y1 + 0xF) >> 4);
+
+	float w[3] = {1.0f / v0->projectedPosition.w, 1.0f / v1->projectedPosition.w, 1.0f / v2->projectedPosition.w};
+	InitSlope(&tri.WSlope, w[0], w[1], w[2], fltdx31, fltdx12, fltdy12, fltdy31);
+
+	// TODO: The zfreeze emulation is not quite correct, yet!
+	// Many things might prevent us from reaching this line (culling, clipping, scissoring).
+	// However, the zslope is always guaranteed to be calculated unless all vertices are trivially rejected during clipping!
+	// We're currently sloppy at this since we abort early if any of the culling/clipping/scissoring tests fail.
+	if (!bpmem.genMode.zfreeze || !g_ActiveConfig.bZFreeze)
+		InitSlope(&ZSlope, v0->screenPosition[2], v1->screenPosition[2], v2->screenPosition[2], fltdx31, fltdx12, fltdy12, fltdy31);
+	tri.ZSlope = ZSlope;
+
+	for (unsigned int i = 0; i < bpmem.genMode.numcolchans; i++)
+	{
+		for (int comp = 0; comp < 4; comp++)
+			InitSlope(&tri.ColorSlopes[i][comp], v0->color[i][comp], v1->color[i][comp], v2->color[i][comp], fltdx31, fltdx12, fltdy12, fltdy31);
+	}
+
+	for (unsigned int i = 0; i < bpmem.genMode.numtexgens; i++)
+	{
+		for (int comp = 0; comp < 3; comp++)
+			InitSlope(&tri.TexSlopes[i][comp], v0->texCoords[i][comp] * w[0], v1->texCoords[i][comp] * w[1], v2->texCoords[i][comp] * w[2], fltdx31, fltdx12, fltdy12, fltdy31);
+	}
+
+	// Half-edge constants
+	tri.C1 = tri.DY12 * X1 - tri.DX12 * Y1;
+	tri.C2 = tri.DY23 * X2 - tri.DX23 * Y2;
+	tri.C3 = tri.DY31 * X3 - tri.DX31 * Y3;
+
+	// Correct for fill convention
+	if (tri.DY12 < 0 || (tri.DY12 == 0 && tri.DX12 > 0)) tri.C1++;
+	if (tri.DY23 < 0 || (tri.DY23 == 0 && tri.DX23 > 0)) tri.C2++;
+	if (tri.DY31 < 0 || (tri.DY31 == 0 && tri.DX31 > 0)) tri.C3++;
+
+	// The TEV dumps go through buffers shared by all pixels
+	if (BoundingBox::active || !g_ActiveConfig.bParallelRasterization ||
+		g_ActiveConfig.bDumpTevStages || g_ActiveConfig.bDumpTevTextureFetches ||
+		contexts[0]->tev.ReadsPreviousPixel())
+	{
+		// After the triangles before it
+		DrawTiles();
+		PixelContext& context = *contexts[0];
+		if (BoundingBox::active)
+			DrawBoundingBox(context, tri);
+		else
+			DrawBlocks(context, tri, 0, 0, EFB_WIDTH, EFB_HEIGHT);
+		return;
+	}
+
+	// Blocks belong to the tile they start in, tiles are a whole number of blocks
+	const u32 index = (u32)triangles.size();
+	triangles.push_back(tri);
+	binnedPixels += (maxx - minx) * (maxy - miny);
+	for (s32 y = (miny & ~(BLOCK_SIZE - 1)) / TILE_SIZE; y <= (maxy - 1) / TILE_SIZE; y++)
+	{
+		for (s32 x = (minx & ~(BLOCK_SIZE - 1)) / TILE_SIZE; x <= (maxx - 1) / TILE_SIZE; x++)
+		{
+			std::vector<u32>& bin = bins[y * TILES_X + x];
+			if (bin.empty())
+				usedTiles.push_back(y * TILES_X + x);
+			bin.push_back(index);
 		}
 	}
 }
 
+void Flush()
+{
+	DrawTiles();
+
+	for (auto& context : contexts)
+		context->tev.FlushCounters();
+}
+
 }
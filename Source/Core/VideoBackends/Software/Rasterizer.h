@@ -12,7 +12,12 @@ namespace Rasterizer
 {
 void Init();
 
+// With parallel rasterization on, triangles are sorted into tiles of the EFB and drawn by Flush.
+// Otherwise, while the bounding box is active, or when the TEV stages read what the previous
+// pixel left, they are drawn right away, after the ones sorted into tiles.
 void DrawTriangleFrontFace(OutputVertexData *v0, OutputVertexData *v1, OutputVertexData *v2);
+// Draws the tiles on the thread pool, the state the triangles were drawn with must not change before
+void Flush();
 
 void SetScissor();
 
@@ -24,7 +29,7 @@ struct Slope
 	float dfdy;
 	float f0;
 
-	float GetValue(float dx, float dy)
+	float GetValue(float dx, float dy) const
 	{
 		return f0 + (dfdx * dx) + (dfdy * dy);
 	}
@@ -134,6 +134,7 @@ void SWVertexLoader::vFlush(bool useDstAlpha)
 		INCSTAT(stats.thisFrame.numVerticesLoaded)
 	}
 
+	Rasterizer::Flush();
 	DebugUtil::OnObjectEnd();
 }
 
@@ -24,6 +24,7 @@
 
 #include "VideoCommon/BPStructs.h"
 #include "VideoCommon/CommandProcessor.h"
+#include "VideoCommon/DLCache.h"
 #include "VideoCommon/Fifo.h"
 #include "VideoCommon/FramebufferManagerBase.h"
 #include "VideoCommon/IndexGenerator.h"
@@ -235,6 +236,7 @@ void VideoSoftware::Video_Cleanup()
 		// The following calls are NOT Thread Safe
 		// And need to be called from the video thread
 		g_renderer->Shutdown();
+		DLCache::Shutdown();
 		VertexLoaderManager::Shutdown();
 		g_framebuffer_manager.reset();
 		g_texture_cache.reset();
@@ -263,6 +265,7 @@ void VideoSoftware::Video_Prepare()
 	g_texture_cache = std::make_unique<TextureCache>();
 	g_renderer->Init();
 	VertexLoaderManager::Init();
+	DLCache::Init();
 	g_framebuffer_manager = std::make_unique<FramebufferManager>();
 
 	// Notify the core that the video backend is ready
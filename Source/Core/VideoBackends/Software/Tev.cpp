@@ -2,7 +2,9 @@
 // Licensed under GPLv2+
 // Refer to the license.txt file included.
 
+#include <algorithm>
 #include <cmath>
+#include <cstring>
 
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
@@ -25,6 +27,11 @@
 
 void Tev::Init()
 {
+	std::memset(Reg, 0, sizeof(Reg));
+	std::memset(RegValues, 0, sizeof(RegValues));
+	std::memset(KonstantColors, 0, sizeof(KonstantColors));
+	IndependentPixels = false;
+
 	FixedConstants[0] = 0;
 	FixedConstants[1] = 32;
 	FixedConstants[2] = 64;
@@ -124,6 +131,15 @@ void Tev::Init()
 	m_ScaleRShiftLUT[1] = 0;
 	m_ScaleRShiftLUT[2] = 0;
 	m_ScaleRShiftLUT[3] = 1;
+
+	std::memset(PerfQuadCounts, 0, sizeof(PerfQuadCounts));
+	RasterizedPixels = 0;
+	PixelsIn = 0;
+	PixelsOut = 0;
+	BBox[BoundingBox::LEFT] = 0xFFFF;
+	BBox[BoundingBox::RIGHT] = 0;
+	BBox[BoundingBox::TOP] = 0xFFFF;
+	BBox[BoundingBox::BOTTOM] = 0;
 }
 
 static inline s16 Clamp255(s16 in)
@@ -506,12 +522,14 @@ void Tev::Indirect(unsigned int stageNum, s32 s, s32 t)
 	}
 }
 
-void Tev::Draw()
+void Tev::Combine()
 {
-	_assert_(Position[0] >= 0 && Position[0] < EFB_WIDTH);
-	_assert_(Position[1] >= 0 && Position[1] < EFB_HEIGHT);
-
-	INCSTAT(stats.thisFrame.tevPixelsIn);
+	if (IndependentPixels)
+	{
+		std::memcpy(Reg, RegValues, sizeof(Reg));
+		std::memset(TexColor, 0, sizeof(TexColor));
+		std::memset(IndirectTex, 0, sizeof(IndirectTex));
+	}
 
 	for (unsigned int stageNum = 0; stageNum < bpmem.genMode.numindstages.Value(); stageNum++)
 	{
@@ -641,6 +659,137 @@ void Tev::Draw()
 		}
 #endif
 	}
+}
+
+bool Tev::ReadsPreviousPixel() const
+{
+	const u32 numTexGens = bpmem.genMode.numtexgens;
+	const u32 numColChans = bpmem.genMode.numcolchans;
+	const u32 numIndStages = bpmem.genMode.numindstages;
+	const u32 numTevStages = bpmem.genMode.numtevstages + 1;
+
+	// What the stages write at some point, reading it earlier reads the previous pixel's value
+	bool regWrites[4][2] = {};
+	bool texWrites = false;
+	for (u32 stageNum = 0; stageNum < numTevStages; stageNum++)
+	{
+		regWrites[bpmem.combiners[stageNum].colorC.dest][0] = true;
+		regWrites[bpmem.combiners[stageNum].alphaC.dest][1] = true;
+		texWrites |= bpmem.tevorders[stageNum >> 1].getEnable(stageNum & 1) != 0;
+	}
+
+	// Values nothing writes keep what this Tev holds, independent pixels read RegValues or zero
+	bool regSet[4][2] = {};
+	bool texSet = false;
+	auto readsReg = [&](int reg, bool alpha) {
+		if (regSet[reg][alpha])
+			return false;
+		if (regWrites[reg][alpha])
+			return true;
+		if (alpha)
+			return Reg[reg][ALP_C] != RegValues[reg][ALP_C];
+		return std::memcmp(&Reg[reg][BLU_C], &RegValues[reg][BLU_C], 3 * sizeof(s16)) != 0;
+	};
+	auto readsTex = [&](bool alpha) {
+		if (texSet)
+			return false;
+		if (texWrites)
+			return true;
+		if (alpha)
+			return TexColor[ALP_C] != 0;
+		return TexColor[BLU_C] != 0 || TexColor[GRN_C] != 0 || TexColor[RED_C] != 0;
+	};
+	auto readsUv = [&](u32 texcoord) {
+		return texcoord >= numTexGens && (Uv[texcoord].s != 0 || Uv[texcoord].t != 0);
+	};
+	auto readsIndirectTex = [&](u32 bt) {
+		return bt >= numIndStages && (IndirectTex[bt][0] != 0 || IndirectTex[bt][1] != 0 ||
+			IndirectTex[bt][2] != 0 || IndirectTex[bt][3] != 0);
+	};
+
+	// Samples take their level of detail from the raster block, which only has the coordinates
+	// the draw has
+	for (u32 stageNum = 0; stageNum < numIndStages; stageNum++)
+	{
+		if (bpmem.tevindref.getTexCoord(stageNum) >= numTexGens)
+			return true;
+	}
+
+	// TexCoord starts out with what the previous pixel left in it
+	bool staleTexCoord = true;
+	for (u32 stageNum = 0; stageNum < numTevStages; stageNum++)
+	{
+		const int stageOdd = stageNum & 1;
+		const TwoTevStageOrders& order = bpmem.tevorders[stageNum >> 1];
+		const TevStageIndirect& indirect = bpmem.tevind[stageNum];
+		const TevStageCombiner::ColorCombiner& cc = bpmem.combiners[stageNum].colorC;
+		const TevStageCombiner::AlphaCombiner& ac = bpmem.combiners[stageNum].alphaC;
+		const u32 texcoordSel = order.getTexCoord(stageOdd);
+
+		// See Indirect
+		const bool staleIndirectTex = readsIndirectTex(indirect.bt);
+		const bool staleAlphaBump = indirect.bs != ITBA_OFF && staleIndirectTex;
+		if (!(indirect.mid & 3) || (indirect.mid & 12) != 12)
+		{
+			staleTexCoord = (indirect.fb_addprev && staleTexCoord) || readsUv(texcoordSel) ||
+				((indirect.mid & 3) && staleIndirectTex);
+		}
+
+		if (order.getEnable(stageOdd))
+		{
+			if (texcoordSel >= numTexGens || staleTexCoord)
+				return true;
+			texSet = true;
+		}
+
+		// See SetRasColor
+		const u32 colorChan = order.getColorChan(stageOdd);
+		bool staleRasColor = false;
+		if (colorChan < 2)
+		{
+			staleRasColor = colorChan >= numColChans && (Color[colorChan][0] != 0 ||
+				Color[colorChan][1] != 0 || Color[colorChan][2] != 0 || Color[colorChan][3] != 0);
+		}
+		else if (colorChan == 5 || colorChan == 6)
+		{
+			staleRasColor = staleAlphaBump;
+		}
+
+		// Both combiners read all their inputs
+		for (u32 input : {(u32)cc.a, (u32)cc.b, (u32)cc.c, (u32)cc.d})
+		{
+			if ((input < 8 && readsReg(input >> 1, input & 1)) ||
+				((input == 8 || input == 9) && readsTex(input == 9)) ||
+				((input == 10 || input == 11) && staleRasColor))
+			{
+				return true;
+			}
+		}
+		for (u32 input : {(u32)ac.a, (u32)ac.b, (u32)ac.c, (u32)ac.d})
+		{
+			if ((input < 4 && readsReg(input, true)) || (input == 4 && readsTex(true)) ||
+				(input == 5 && staleRasColor))
+			{
+				return true;
+			}
+		}
+
+		regSet[cc.dest][0] = true;
+		regSet[ac.dest][1] = true;
+	}
+
+	// The z texture
+	return bpmem.ztex2.op != ZTEXTURE_DISABLE && (readsTex(false) || readsTex(true));
+}
+
+void Tev::Draw()
+{
+	_assert_(Position[0] >= 0 && Position[0] < EFB_WIDTH);
+	_assert_(Position[1] >= 0 && Position[1] < EFB_HEIGHT);
+
+	PixelsIn++;
+
+	Combine();
 
 	// convert to 8 bits per component
 	// the results of the last tev stage are put onto the screen,
@@ -763,19 +912,20 @@ void Tev::Draw()
 		if (late_ztest && bpmem.zmode.testenable)
 		{
 			// TODO: Check against hw if these values get incremented even if depth testing is disabled
-			EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_INPUT);
+			PerfQuadCounts[PQ_ZCOMP_INPUT]++;
 
 			if (!EfbInterface::ZCompare(Position[0], Position[1], Position[2]))
 				return;
 
-			EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_OUTPUT);
+			PerfQuadCounts[PQ_ZCOMP_OUTPUT]++;
 		}
 	}
-	// branchless bounding box update
-	BoundingBox::coords[BoundingBox::LEFT] = std::min((u16)Position[0], BoundingBox::coords[BoundingBox::LEFT]);
-	BoundingBox::coords[BoundingBox::RIGHT] = std::max((u16)Position[0], BoundingBox::coords[BoundingBox::RIGHT]);
-	BoundingBox::coords[BoundingBox::TOP] = std::min((u16)Position[1], BoundingBox::coords[BoundingBox::TOP]);
-	BoundingBox::coords[BoundingBox::BOTTOM] = std::max((u16)Position[1], BoundingBox::coords[BoundingBox::BOTTOM]);
+	// branchless bounding box update, the bounding box rasterizer reads it as it goes
+	u16* bbox = BoundingBox::active ? BoundingBox::coords : BBox;
+	bbox[BoundingBox::LEFT] = std::min((u16)Position[0], bbox[BoundingBox::LEFT]);
+	bbox[BoundingBox::RIGHT] = std::max((u16)Position[0], bbox[BoundingBox::RIGHT]);
+	bbox[BoundingBox::TOP] = std::min((u16)Position[1], bbox[BoundingBox::TOP]);
+	bbox[BoundingBox::BOTTOM] = std::max((u16)Position[1], bbox[BoundingBox::BOTTOM]);
 
 	// if we are only calculating the bounding box,
 	// there's no need to actually draw anything
@@ -802,8 +952,8 @@ void Tev::Draw()
 	}
 #endif
 
-	INCSTAT(stats.thisFrame.tevPixelsOut);
-	EfbInterface::IncPerfCounterQuadCount(PQ_BLEND_INPUT);
+	PixelsOut++;
+	PerfQuadCounts[PQ_BLEND_INPUT]++;
 
 	EfbInterface::BlendTev(Position[0], Position[1], output);
 }
@@ -817,6 +967,33 @@ void Tev::SetRegColor(int reg, int comp, bool konst, s16 color)
 	else
 	{
 		Reg[reg][comp] = color;
+		RegValues[reg][comp] = color;
 	}
 }
 
+void Tev::FlushCounters()
+{
+	for (int type = 0; type < PQ_NUM_MEMBERS; type++)
+	{
+		if (PerfQuadCounts[type])
+			EfbInterface::IncPerfCounterQuadCount(static_cast<PerfQueryType>(type), PerfQuadCounts[type]);
+		PerfQuadCounts[type] = 0;
+	}
+
+	ADDSTAT(stats.thisFrame.rasterizedPixels, RasterizedPixels);
+	ADDSTAT(stats.thisFrame.tevPixelsIn, PixelsIn);
+	ADDSTAT(stats.thisFrame.tevPixelsOut, PixelsOut);
+	RasterizedPixels = 0;
+	PixelsIn = 0;
+	PixelsOut = 0;
+
+	BoundingBox::coords[BoundingBox::LEFT] = std::min(BBox[BoundingBox::LEFT], BoundingBox::coords[BoundingBox::LEFT]);
+	BoundingBox::coords[BoundingBox::RIGHT] = std::max(BBox[BoundingBox::RIGHT], BoundingBox::coords[BoundingBox::RIGHT]);
+	BoundingBox::coords[BoundingBox::TOP] = std::min(BBox[BoundingBox::TOP], BoundingBox::coords[BoundingBox::TOP]);
+	BoundingBox::coords[BoundingBox::BOTTOM] = std::max(BBox[BoundingBox::BOTTOM], BoundingBox::coords[BoundingBox::BOTTOM]);
+	BBox[BoundingBox::LEFT] = 0xFFFF;
+	BBox[BoundingBox::RIGHT] = 0;
+	BBox[BoundingBox::TOP] = 0xFFFF;
+	BBox[BoundingBox::BOTTOM] = 0;
+}
+
@@ -4,7 +4,9 @@
 
 #pragma once
 
+#include "Common/CommonTypes.h"
 #include "VideoCommon/BPMemory.h"
+#include "VideoCommon/PerfQueryBase.h"
 
 class Tev
 {
@@ -24,6 +26,8 @@ class Tev
 
 	// color order: ABGR
 	s16 Reg[4][4];
+	// The values last set, pixels drawn with IndependentPixels start from them
+	s16 RegValues[4][4];
 	s16 KonstantColors[4][4];
 	s16 TexColor[4];
 	s16 RasColor[4];
@@ -75,6 +79,18 @@ public:
 	s32 TextureLod[16];
 	bool TextureLinear[16];
 
+	// Start each pixel from the register values set instead of what the previous pixel
+	// left, and without the texture colors it sampled, so pixels can be drawn in any order
+	bool IndependentPixels;
+
+	// Counted per Tev so that several of them can draw at once, FlushCounters adds
+	// them to the perf counters, the statistics and the bounding box
+	u32 PerfQuadCounts[PQ_NUM_MEMBERS];
+	u32 RasterizedPixels;
+	u32 PixelsIn;
+	u32 PixelsOut;
+	u16 BBox[4];
+
 	enum
 	{
 		ALP_C,
@@ -86,6 +102,15 @@ public:
 	void Init();
 
 	void Draw();
+	// The TEV stages of Draw, without the output. Leaves the state a drawn pixel leaves.
+	void Combine();
+
+	// Whether pixels drawn with the current BP state read a value the previous pixel left
+	// behind that differs from what they read with IndependentPixels. Such draws only come
+	// out right on a Tev drawing every pixel in order.
+	bool ReadsPreviousPixel() const;
 
 	void SetRegColor(int reg, int comp, bool konst, s16 color);
+
+	void FlushCounters();
 };
@@ -9,6 +9,7 @@
 #include "VideoCommon/BPMemory.h"
 #include "VideoCommon/BPStructs.h"
 #include "VideoCommon/PixelEngine.h"
+#include "VideoCommon/TexturePrefetch.h"
 // BP state
 // STATE_TO_SAVE
 BPMemory bpmem;
@@ -36,6 +37,7 @@ void LoadBPRegPreprocess(u32 value0)
 	int regNum = value0 >> 24;
 	// masking could hypothetically be a problem
 	u32 newval = value0 & 0xffffff;
+	TexturePrefetch::LoadBPReg(value0);
 	switch (regNum)
 	{
 	case BPMEM_SETDRAWDONE:
@@ -0,0 +1,33 @@
+// Copyright 2013 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include "Common/CommonTypes.h"
+
+// Display list cache.
+// Display lists are validated against a hash of their contents; register
+// writes are replayed through the opcode decoder and vertex data is kept
+// in its converted (native) form so it can be copied straight into the
+// vertex manager buffer on the next call.
+namespace DLCache
+{
+
+void Init();
+void Shutdown();
+void Clear();
+
+// Called once per frame, drops lists that have not been used recently
+// and keeps the cache inside its memory budget.
+void ProgressiveCleanup();
+
+}  // namespace DLCache
+
+// NOTE - outside the namespace on purpose.
+// Returns true if the list was executed by the cache, cycles receives the
+// number of emulated cycles it took.
+bool HandleDisplayList(u32 address, u32 size, u32* cycles);
+
+// Starts a new frame for the usage tracking of cached lists.
+void IncrementCheckContextId();
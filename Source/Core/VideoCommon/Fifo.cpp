@@ -2,8 +2,10 @@
 // Licensed under GPLv2+
 // Refer to the license.txt file included.
 
+#include <algorithm>
 #include <atomic>
 #include <cstring>
+#include <thread>
 
 #include "Common/Assert.h"
 #include "Common/Atomic.h"
@@ -13,6 +15,7 @@
 #include "Common/FPURoundMode.h"
 #include "Common/MemoryUtil.h"
 #include "Common/MsgHandler.h"
+#include "Common/Thread.h"
 
 #include "Core/ConfigManager.h"
 #include "Core/CoreTiming.h"
@@ -36,6 +39,8 @@ namespace Fifo
 {
 static constexpr u32 FIFO_SIZE = 2 * 1024 * 1024;
 static constexpr int GPU_TIME_SLOT_SIZE = 1000;
+// Larger reads put off the interrupt, breakpoint and AsyncRequests checks between them
+static constexpr u32 MAX_FIFO_READ_SIZE = 64 * 1024;
 
 static Common::BlockingLoop s_gpu_mainloop;
 
@@ -50,6 +55,16 @@ static u8* s_fifo_aux_read_ptr;
 // and can change at runtime.
 static bool s_use_deterministic_gpu_thread;
 
+// With the parse thread, dual core mode splits the work of the GPU thread in two. The
+// parse thread reads the FIFO, keeps the CP registers, tokens and interrupts up to date
+// and preprocesses the commands, like the CPU thread does for the deterministic GPU
+// thread. The GPU thread only runs the commands the parse thread is done with. The video
+// buffer is the queue between them, when it is full the parse thread waits for the GPU.
+static bool s_parse_thread_enabled;
+static bool s_use_gpu_parse_thread;
+static Common::BlockingLoop s_parse_loop;
+static std::thread s_parse_thread;
+
 static CoreTiming::EventType* s_event_sync_gpu;
 
 // STATE_TO_SAVE
@@ -81,7 +96,7 @@ void DoState(PointerWrap& p)
 	p.DoPointer(write_ptr, s_video_buffer);
 	s_video_buffer_write_ptr = write_ptr;
 	p.DoPointer(s_video_buffer_read_ptr, s_video_buffer);
-	if (p.mode == PointerWrap::MODE_READ && s_use_deterministic_gpu_thread)
+	if (p.mode == PointerWrap::MODE_READ && UsePreprocessedFifo())
 	{
 		// We're good and paused, right?
 		s_video_buffer_seen_ptr = s_video_buffer_pp_read_ptr = s_video_buffer_read_ptr;
@@ -102,6 +117,8 @@ void PauseAndLock(bool doLock, bool unpauseOnUnlock)
 		if (!param.bCPUThread || s_use_deterministic_gpu_thread)
 			return;
 
+		if (s_use_gpu_parse_thread)
+			s_parse_loop.WaitYield(std::chrono::milliseconds(100), Host_YieldToUI);
 		s_gpu_mainloop.WaitYield(std::chrono::milliseconds(100), Host_YieldToUI);
 	}
 	else
@@ -116,8 +133,12 @@ void Init()
 	// Padded so that SIMD overreads in the vertex loader are safe
 	s_video_buffer = static_cast<u8*>(Common::AllocateMemoryPages(FIFO_SIZE + 4));
 	ResetVideoBuffer();
+	s_parse_thread_enabled = SConfig::GetInstance().bCPUThread && g_ActiveConfig.bGPUParseThread;
+	s_use_gpu_parse_thread = s_parse_thread_enabled && !s_use_deterministic_gpu_thread;
 	if (SConfig::GetInstance().bCPUThread)
 		s_gpu_mainloop.Prepare();
+	if (s_parse_thread_enabled)
+		s_parse_loop.Prepare();
 	s_sync_ticks.store(0);
 }
 
@@ -134,6 +155,8 @@ void Shutdown()
 	s_video_buffer_seen_ptr = nullptr;
 	s_fifo_aux_write_ptr = nullptr;
 	s_fifo_aux_read_ptr = nullptr;
+	s_parse_thread_enabled = false;
+	s_use_gpu_parse_thread = false;
 }
 
 // May be executed from any thread, even the graphics thread.
@@ -146,6 +169,7 @@ void ExitGpuLoop()
 
 	// Terminate GPU thread loop
 	s_emu_running_state.Set();
+	s_parse_loop.Stop(false);
 	s_gpu_mainloop.Stop(false);
 }
 
@@ -153,14 +177,32 @@ void EmulatorState(bool running)
 {
 	s_emu_running_state.Set(running);
 	if (running)
+	{
+		s_parse_loop.Wakeup();
 		s_gpu_mainloop.Wakeup();
+	}
 	else
+	{
+		s_parse_loop.AllowSleep();
 		s_gpu_mainloop.AllowSleep();
+	}
 }
 
 void SyncGPU(SyncGPUReason reason, bool may_move_read_ptr)
 {
-	if (s_use_deterministic_gpu_thread)
+	if (s_use_gpu_parse_thread)
+	{
+		// Swaps, perf queries and bbox reads go through AsyncRequests like in plain dual
+		// core mode. The parse thread syncs itself when the buffers are full, anything
+		// else comes from the CPU thread and needs both threads idle.
+		if (reason != SyncGPUReason::Other && reason != SyncGPUReason::Wraparound &&
+			reason != SyncGPUReason::AuxSpace)
+			return;
+		if (reason == SyncGPUReason::Other)
+			s_parse_loop.Wait();
+	}
+
+	if (UsePreprocessedFifo())
 	{
 		s_gpu_mainloop.Wait();
 		if (!s_gpu_mainloop.IsRunning())
@@ -222,10 +264,27 @@ void* PopFifoAuxBuffer(size_t size)
 	return ret;
 }
 
+// Bytes that can be read from readPtr in one go: everything up to the write pointer, the
+// end of the FIFO or the breakpoint, whichever comes first.
+static u32 GetFifoReadSize(u32 readPtr)
+{
+	const SCPFifoStruct& fifo = CommandProcessor::fifo;
+	const u32 distance = fifo.CPReadWriteDistance;
+	const u32 breakpoint = fifo.CPBreakpoint;
+	u32 size = std::min(distance, fifo.CPEnd + 32 - readPtr);
+	// Reading 32 bytes at a time never stopped at a breakpoint inside a block either
+	if (fifo.bFF_BPEnable && breakpoint > readPtr)
+		size = std::min(size, (breakpoint - readPtr + 31) & ~31);
+	// At least a block, even if the registers are set up oddly
+	return std::max(std::min(size, MAX_FIFO_READ_SIZE), 32u);
+}
+
 // Description: RunGpuLoop() sends data through this function.
-static void ReadDataFromFifo(u32 readPtr)
+static void ReadDataFromFifo(u32 readPtr, size_t len)
 {
-	size_t len = 32;
+	// Start over when everything was decoded, only a partial command ever has to be moved
+	if (s_video_buffer_read_ptr == s_video_buffer_write_ptr)
+		s_video_buffer_read_ptr = s_video_buffer_write_ptr = s_video_buffer;
 	if (len > (size_t)(s_video_buffer + FIFO_SIZE - s_video_buffer_write_ptr))
 	{
 		size_t existing_len = s_video_buffer_write_ptr - s_video_buffer_read_ptr;
@@ -243,10 +302,9 @@ static void ReadDataFromFifo(u32 readPtr)
 	s_video_buffer_write_ptr += len;
 }
 
-// The deterministic_gpu_thread version.
-static void ReadDataFromFifoOnCPU(u32 readPtr)
+// The deterministic_gpu_thread version, also used by the parse thread.
+static void ReadDataFromFifoOnCPU(u32 readPtr, size_t len, u32* cycles = nullptr)
 {
-	size_t len = 32;
 	u8* write_ptr = s_video_buffer_write_ptr;
 	if (len > (size_t)(s_video_buffer + FIFO_SIZE - write_ptr))
 	{
@@ -274,7 +332,7 @@ static void ReadDataFromFifoOnCPU(u32 readPtr)
 	}
 	Memory::CopyFromEmu(s_video_buffer_write_ptr, readPtr, len);
 	DataReader fifo_reader(s_video_buffer_pp_read_ptr, write_ptr + len);
-	s_video_buffer_pp_read_ptr = OpcodeDecoder::Run<true>(fifo_reader, nullptr);
+	s_video_buffer_pp_read_ptr = OpcodeDecoder::Run<true>(fifo_reader, cycles);
 	// This would have to be locked if the GPU thread didn't spin.
 	s_video_buffer_write_ptr = write_ptr + len;
 }
@@ -289,6 +347,69 @@ void ResetVideoBuffer()
 	s_fifo_aux_read_ptr = s_fifo_aux_data;
 }
 
+// The first half of the GPU thread when the parse thread is used, see s_use_gpu_parse_thread
+static void RunParseLoop()
+{
+	Common::SetCurrentThreadName("GPU parse thread");
+
+	s_parse_loop.Run([] {
+		const SConfig& param = SConfig::GetInstance();
+		SCPFifoStruct& fifo = CommandProcessor::fifo;
+
+		// Do nothing while paused, or while the deterministic GPU thread is used
+		if (!s_emu_running_state.IsSet() || !s_use_gpu_parse_thread)
+			return;
+
+		CommandProcessor::SetCPStatusFromGPU();
+
+		while (!CommandProcessor::IsInterruptWaiting() && fifo.bFF_GPReadEnable &&
+			fifo.CPReadWriteDistance && !AtBreakpoint())
+		{
+			if (param.bSyncGPU && s_sync_ticks.load() < param.iSyncGpuMinDistance)
+				break;
+
+			u32 cyclesExecuted = 0;
+			u32 readPtr = fifo.CPReadPointer;
+			const u32 size = GetFifoReadSize(readPtr);
+			ReadDataFromFifoOnCPU(readPtr, size, &cyclesExecuted);
+			if (!s_gpu_mainloop.IsRunning())
+				return;
+
+			if (readPtr + size > fifo.CPEnd)
+				readPtr = fifo.CPBase;
+			else
+				readPtr += size;
+
+			Common::AtomicStore(fifo.CPReadPointer, readPtr);
+			Common::AtomicAdd(fifo.CPReadWriteDistance, -(s32)size);
+			if (s_video_buffer_pp_read_ptr == s_video_buffer_write_ptr)
+				Common::AtomicStore(fifo.SafeCPReadPointer, fifo.CPReadPointer);
+
+			CommandProcessor::SetCPStatusFromGPU();
+
+			// After the distance is updated, so the GPU thread sees an empty FIFO on its last run
+			s_gpu_mainloop.Wakeup();
+
+			if (param.bSyncGPU)
+			{
+				cyclesExecuted = (int)(cyclesExecuted / param.fSyncGpuOverclock);
+				int old = s_sync_ticks.fetch_sub(cyclesExecuted);
+				if (old >= param.iSyncGpuMaxDistance &&
+					old - (int)cyclesExecuted < param.iSyncGpuMaxDistance)
+					s_sync_wakeup_event.Set();
+			}
+		}
+
+		// fast skip remaining GPU time if fifo is empty
+		if (s_sync_ticks.load() > 0)
+		{
+			int old = s_sync_ticks.exchange(0);
+			if (old >= param.iSyncGpuMaxDistance)
+				s_sync_wakeup_event.Set();
+		}
+	});
+}
+
 // Description: Main FIFO update loop
 // Purpose: Keep the Core HW updated about the CPU-GPU distance
 void RunGpuLoop()
@@ -296,6 +417,9 @@ void RunGpuLoop()
 	AsyncRequests::GetInstance()->SetEnable(true);
 	AsyncRequests::GetInstance()->SetPassthrough(false);
 
+	if (s_parse_thread_enabled)
+		s_parse_thread = std::thread(RunParseLoop);
+
 	s_gpu_mainloop.Run(
 		[] {
 		const SConfig& param = SConfig::GetInstance();
@@ -306,11 +430,12 @@ void RunGpuLoop()
 		if (!s_emu_running_state.IsSet())
 			return;
 
-		if (s_use_deterministic_gpu_thread)
+		if (UsePreprocessedFifo())
 		{
 			AsyncRequests::GetInstance()->PullEvents();
 
-			// All the fifo/CP stuff is on the CPU.  We just need to run the opcode decoder.
+			// All the fifo/CP stuff is on the CPU or the parse thread.  We just need to run the
+			// opcode decoder.
 			u8* seen_ptr = s_video_buffer_seen_ptr;
 			u8* write_ptr = s_video_buffer_write_ptr;
 			// See comment in SyncGPU
@@ -320,6 +445,10 @@ void RunGpuLoop()
 				s_video_buffer_read_ptr = OpcodeDecoder::Run<false>(g_VideoData, nullptr);
 				s_video_buffer_seen_ptr = write_ptr;
 			}
+
+			// Like in plain dual core mode, draw what's buffered once the FIFO is empty
+			if (s_use_gpu_parse_thread && CommandProcessor::fifo.CPReadWriteDistance == 0)
+				g_vertex_manager->Flush();
 		}
 		else
 		{
@@ -338,24 +467,25 @@ void RunGpuLoop()
 
 				u32 cyclesExecuted = 0;
 				u32 readPtr = fifo.CPReadPointer;
-				ReadDataFromFifo(readPtr);
+				const u32 size = GetFifoReadSize(readPtr);
+				ReadDataFromFifo(readPtr, size);
 
-				if (readPtr == fifo.CPEnd)
+				if (readPtr + size > fifo.CPEnd)
 					readPtr = fifo.CPBase;
 				else
-					readPtr += 32;
+					readPtr += size;
 
-				_assert_msg_(COMMANDPROCESSOR, (s32)fifo.CPReadWriteDistance - 32 >= 0,
+				_assert_msg_(COMMANDPROCESSOR, (s32)fifo.CPReadWriteDistance - (s32)size >= 0,
 					"Negative fifo.CPReadWriteDistance = %i in FIFO Loop !\nThat can produce "
 					"instability in the game. Please report it.",
-					fifo.CPReadWriteDistance - 32);
+					fifo.CPReadWriteDistance - (s32)size);
 
 				u8* write_ptr = s_video_buffer_write_ptr;
 				g_VideoData.SetReadPosition(s_video_buffer_read_ptr, write_ptr);
 				s_video_buffer_read_ptr = OpcodeDecoder::Run(g_VideoData, &cyclesExecuted);
 
 				Common::AtomicStore(fifo.CPReadPointer, readPtr);
-				Common::AtomicAdd(fifo.CPReadWriteDistance, -32);
+				Common::AtomicAdd(fifo.CPReadWriteDistance, -(s32)size);
 				if ((write_ptr - s_video_buffer_read_ptr) == 0)
 					Common::AtomicStore(fifo.SafeCPReadPointer, fifo.CPReadPointer);
 
@@ -392,6 +522,12 @@ void RunGpuLoop()
 	},
 		100);
 
+	if (s_parse_thread.joinable())
+	{
+		s_parse_loop.Stop(false);
+		s_parse_thread.join();
+	}
+
 	AsyncRequests::GetInstance()->SetEnable(false);
 	AsyncRequests::GetInstance()->SetPassthrough(true);
 }
@@ -403,11 +539,14 @@ void FlushGpu()
 	if (!param.bCPUThread || s_use_deterministic_gpu_thread)
 		return;
 
+	if (s_use_gpu_parse_thread)
+		s_parse_loop.Wait();
 	s_gpu_mainloop.Wait();
 }
 
 void GpuMaySleep()
 {
+	s_parse_loop.AllowSleep();
 	s_gpu_mainloop.AllowSleep();
 }
 
@@ -424,6 +563,8 @@ void RunGpu()
 	// wake up GPU thread
 	if (param.bCPUThread && !s_use_deterministic_gpu_thread)
 	{
+		if (s_use_gpu_parse_thread)
+			s_parse_loop.Wakeup();
 		s_gpu_mainloop.Wakeup();
 	}
 
@@ -449,7 +590,7 @@ static int RunGpuOnCpu(int ticks)
 	{
 		if (s_use_deterministic_gpu_thread)
 		{
-			ReadDataFromFifoOnCPU(fifo.CPReadPointer);
+			ReadDataFromFifoOnCPU(fifo.CPReadPointer, 32);
 			s_gpu_mainloop.Wakeup();
 		}
 		else
@@ -460,7 +601,7 @@ static int RunGpuOnCpu(int ticks)
 				FPURoundMode::LoadDefaultSIMDState();
 				reset_simd_state = true;
 			}
-			ReadDataFromFifo(fifo.CPReadPointer);
+			ReadDataFromFifo(fifo.CPReadPointer, 32);
 			u32 cycles = 0;
 			g_VideoData.SetReadPosition(s_video_buffer_read_ptr, s_video_buffer_write_ptr);
 				s_video_buffer_read_ptr = OpcodeDecoder::Run(g_VideoData, &cycles);
@@ -513,11 +654,14 @@ void UpdateWantDeterminism(bool want)
 	}
 
 	gpu_thread = gpu_thread && param.bCPUThread;
+	const bool parse_thread = s_parse_thread_enabled && !gpu_thread;
 
-	if (s_use_deterministic_gpu_thread != gpu_thread)
+	if (s_use_deterministic_gpu_thread != gpu_thread || s_use_gpu_parse_thread != parse_thread)
 	{
+		const bool was_preprocessed = UsePreprocessedFifo();
 		s_use_deterministic_gpu_thread = gpu_thread;
-		if (gpu_thread)
+		s_use_gpu_parse_thread = parse_thread;
+		if (UsePreprocessedFifo() && !was_preprocessed)
 		{
 			// These haven't been updated in non-deterministic mode.
 			s_video_buffer_seen_ptr = s_video_buffer_pp_read_ptr = s_video_buffer_read_ptr;
@@ -532,6 +676,11 @@ bool UseDeterministicGPUThread()
 	return s_use_deterministic_gpu_thread;
 }
 
+bool UsePreprocessedFifo()
+{
+	return s_use_deterministic_gpu_thread || s_use_gpu_parse_thread;
+}
+
 /* This function checks the emulated CPU - GPU distance and may wake up the GPU,
 * or block the CPU if required. It should be called by the CPU thread regularly.
 * @ticks The gone emulated CPU time.
@@ -545,7 +694,8 @@ static int WaitForGpuThread(int ticks)
 	int now = old + ticks;
 
 	// GPU is idle, so stop polling.
-	if (old >= 0 && s_gpu_mainloop.IsDone())
+	Common::BlockingLoop& fifo_loop = s_use_gpu_parse_thread ? s_parse_loop : s_gpu_mainloop;
+	if (old >= 0 && fifo_loop.IsDone())
 		return -1;
 
 	// Wakeup GPU
@@ -20,6 +20,10 @@ void DoState(PointerWrap &f);
 void PauseAndLock(bool doLock, bool unpauseOnUnlock);
 void UpdateWantDeterminism(bool want);
 bool UseDeterministicGPUThread();
+// The commands are preprocessed before the GPU thread runs them, by the CPU thread for the
+// deterministic GPU thread or by the parse thread. Display lists and indexed XF loads are
+// then taken from the aux FIFO, and the preprocessor raises the tokens.
+bool UsePreprocessedFifo();
 
 // Used for diagnostics.
 enum class SyncGPUReason
@@ -1,52 +1,380 @@
-// Copyright (C) 2003-2009 Dolphin Project.
+// Copyright 2013 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
 
-// This program is free software: you can redistribute it and/or modify
-// it under the terms of the GNU General Public License as published by
-// the Free Software Foundation, version 2.0.
+// Display lists are cached per (address, size) and validated with a hash of
+// their contents on every call. The first call interprets the list while
+// recording it: runs of register writes (BP/XF/CP/indexed XF) are stored as
+// byte ranges and replayed through the opcode decoder, draws keep the
+// vertices produced by the vertex loader. Later calls copy those vertices
+// straight into the vertex manager buffer as long as the vertex loader and
+// the position matrix index match the ones used while recording.
+// Only draws with direct vertex data can be cached, indexed attributes read
+// from the vertex arrays which are not covered by the hash.
 
-// This program is distributed in the hope that it will be useful,
-// but WITHOUT ANY WARRANTY; without even the implied warranty of
-// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
-// GNU General Public License 2.0 for more details.
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+#include <xxhash.h>
 
-// A copy of the GPL 2.0 should have been included with the program.
-// If not, see http://www.gnu.org/licenses/
+#include "Common/CommonTypes.h"
+#include "Core/HW/Memmap.h"
+#include "VideoCommon/BPMemory.h"
+#include "VideoCommon/CPMemory.h"
+#include "VideoCommon/DataReader.h"
+#include "VideoCommon/DLCache.h"
+#include "VideoCommon/OpcodeDecoding.h"
+#include "VideoCommon/Statistics.h"
+#include "VideoCommon/VertexLoaderBase.h"
+#include "VideoCommon/VertexLoaderManager.h"
+#include "VideoCommon/VertexManagerBase.h"
+#include "VideoCommon/VideoConfig.h"
+#include "VideoCommon/XFMemory.h"
 
-// Official SVN repository and contact information can be found at
-// http://code.google.com/p/dolphin-emu/
+namespace DLCache
+{
 
-// TODO: Handle cache-is-full condition :p
+// Lists not called for this many frames are released.
+static const u32 DL_CACHE_MAX_AGE = 300;
+// Upper bound for the converted vertex data kept by the cache.
+static const size_t DL_CACHE_MAX_VERTEX_BYTES = 64 * 1024 * 1024;
 
+struct CachedDraw
+{
+	u32 offset;          // Offset of the draw opcode inside the list
+	u8 cmd_byte;
+	u16 count;
+	s32 vertex_size;     // Raw vertex size used to walk the list
+	const VertexLoaderBase* loader;
+	u32 matrix_index;
+	u32 finalcount;
+	std::vector<u8> data;
+};
 
-#include "Common.h"
-#include "DLCache.h"
+struct CachedOp
+{
+	u32 offset;
+	u32 size;
+	// Index into draws, -1 for a range of register writes
+	s32 draw;
+};
 
-namespace DLCache
+struct CachedDisplayList
 {
+	u64 hash = 0;
+	u32 check_context = 0;
+	bool uncacheable = false;
+	bool recorded = false;
+	size_t vertex_bytes = 0;
+	std::vector<CachedOp> ops;
+	std::vector<CachedDraw> draws;
+};
+
+static std::unordered_map<u64, CachedDisplayList> s_cache;
+static size_t s_vertex_bytes = 0;
+static u32 s_check_context = 1;
+
+static inline u64 CacheKey(u32 address, u32 size)
+{
+	return (u64(address) << 32) | size;
+}
+
+static void ResetEntry(CachedDisplayList& entry)
+{
+	s_vertex_bytes -= entry.vertex_bytes;
+	entry.vertex_bytes = 0;
+	entry.recorded = false;
+	entry.uncacheable = false;
+	entry.ops.clear();
+	entry.draws.clear();
+}
 
 void Init()
 {
+	Clear();
 }
 
 void Shutdown()
 {
+	Clear();
 }
 
-void Clear() 
+void Clear()
 {
+	s_cache.clear();
+	s_vertex_bytes = 0;
 }
 
 void ProgressiveCleanup()
 {
+	// Age based eviction, if that is not enough to stay inside the budget
+	// drop everything older than the current frame.
+	u32 max_age = DL_CACHE_MAX_AGE;
+	while (true)
+	{
+		for (auto it = s_cache.begin(); it != s_cache.end();)
+		{
+			if (s_check_context - it->second.check_context > max_age)
+			{
+				s_vertex_bytes -= it->second.vertex_bytes;
+				it = s_cache.erase(it);
+			}
+			else
+			{
+				++it;
+			}
+		}
+		if (s_vertex_bytes <= DL_CACHE_MAX_VERTEX_BYTES || max_age == 0)
+			break;
+		max_age = 0;
+	}
+}
+
+static inline bool IsCacheableDraw()
+{
+	// Indexed attributes read from the vertex arrays.
+	for (int i = 0; i < 12; i++)
+	{
+		if (g_main_cp_state.vtx_desc.GetVertexArrayStatus(i) >= 0x2)
+			return false;
+	}
+	// The CPU bounding box is updated as a side effect of the vertex loaders.
+	return g_ActiveConfig.iBBoxMode != BBoxCPU && s_vertex_bytes < DL_CACHE_MAX_VERTEX_BYTES;
 }
-}  // namespace
+
+static inline u32 RunRange(u8* start, u32 offset, u32 size)
+{
+	u32 cycles = 0;
+	if (size)
+	{
+		g_VideoData.SetReadPosition(start + offset, start + offset + size);
+		OpcodeDecoder::Run<false, false>(g_VideoData, &cycles);
+	}
+	return cycles;
+}
+
+static inline void PrepareDrawParameters(VertexLoaderParameters& parameters, u8 cmd_byte, u16 count, u8* source, size_t buf_size)
+{
+	CPState& state = g_main_cp_state;
+	parameters.count = count;
+	parameters.buf_size = buf_size;
+	parameters.primitive = (cmd_byte & GX_PRIMITIVE_MASK) >> GX_PRIMITIVE_SHIFT;
+	u32 vtx_attr_group = cmd_byte & GX_VAT_MASK;
+	parameters.vtx_attr_group = vtx_attr_group;
+	parameters.needloaderrefresh = (state.attr_dirty & (1u << vtx_attr_group)) != 0;
+	parameters.skip_draw = xfmem.viewport.wd == 0.0f
+		|| xfmem.viewport.ht == 0.0f
+		|| (bpmem.scissorBR.x + 1 - bpmem.scissorTL.x) == 0
+		|| (bpmem.scissorBR.y + 1 - bpmem.scissorTL.y) == 0;
+	parameters.VtxDesc = &state.vtx_desc;
+	parameters.VtxAttr = &state.vtx_attr[vtx_attr_group];
+	parameters.source = source;
+	state.attr_dirty &= ~(1 << vtx_attr_group);
+}
+
+// Executes a draw of the list, either from the converted vertices or through
+// the vertex loader, refreshing the cached vertices in the latter case.
+// Returns false if the raw vertex size changed, the rest of the list then
+// has to be interpreted.
+static bool ExecuteDraw(CachedDisplayList& entry, CachedDraw& draw, u8* start, u32 size, u32* cycles)
+{
+	u32 data_offset = draw.offset + 1 + GX_DRAW_PRIMITIVES_SIZE;
+	VertexLoaderParameters parameters;
+	PrepareDrawParameters(parameters, draw.cmd_byte, draw.count, start + data_offset, size - data_offset);
+	const VertexLoaderBase* loader = VertexLoaderManager::GetActiveLoader(parameters);
+	parameters.needloaderrefresh = false;
+	if (loader->m_VertexSize != draw.vertex_size)
+		return false;
+
+	*cycles += GX_NOP_CYCLES + GX_DRAW_PRIMITIVES_CYCLES * draw.count;
+	if (parameters.skip_draw)
+		return true;
+
+	if (draw.loader == loader && draw.matrix_index == g_main_cp_state.matrix_index_a.Hex && !draw.data.empty())
+	{
+		VertexLoaderManager::AddConvertedVertices(loader, parameters.primitive, draw.count, draw.data.data(), draw.finalcount);
+		INCSTAT(stats.thisFrame.numDListCacheHits);
+		return true;
+	}
+
+	u32 readsize = 0;
+	u32 writesize = 0;
+	VertexLoaderManager::ConvertVertices(parameters, readsize, writesize);
+	if (IsCacheableDraw())
+	{
+		s_vertex_bytes -= draw.data.size();
+		entry.vertex_bytes -= draw.data.size();
+		const u8* converted = g_vertex_manager->GetCurrentBufferPointer();
+		draw.data.assign(converted, converted + writesize);
+		draw.loader = loader;
+		draw.matrix_index = g_main_cp_state.matrix_index_a.Hex;
+		draw.finalcount = writesize / loader->m_native_stride;
+		s_vertex_bytes += writesize;
+		entry.vertex_bytes += writesize;
+	}
+	g_vertex_manager->IncCurrentBufferPointer(writesize);
+	return true;
+}
+
+// Interprets the list while splitting it into register write ranges and draws.
+static u32 Record(CachedDisplayList& entry, u8* start, u32 size)
+{
+	u32 cycles = 0;
+	u32 raw_start = 0;
+	DataReader reader(start, start + size);
+	while (reader.size())
+	{
+		u32 cmd_offset = u32(reader.GetReadPosition() - start);
+		u8 cmd_byte = reader.Read<u8>();
+		size_t distance = reader.size();
+		size_t cmd_size = 0;
+		switch (cmd_byte)
+		{
+		case GX_NOP:
+		case GX_UNKNOWN_RESET:
+		case GX_CMD_UNKNOWN_METRICS:
+		case GX_CMD_INVL_VC:
+			break;
+		case GX_LOAD_CP_REG:
+			cmd_size = GX_LOAD_CP_REG_SIZE;
+			break;
+		case GX_LOAD_XF_REG:
+			cmd_size = GX_LOAD_XF_REG_SIZE;
+			if (distance >= GX_LOAD_XF_REG_SIZE)
+				cmd_size += (((reader.Peek<u32>() >> 16) & 15) + 1) * sizeof(u32);
+			break;
+		case GX_LOAD_INDX_A:
+		case GX_LOAD_INDX_B:
+		case GX_LOAD_INDX_C:
+		case GX_LOAD_INDX_D:
+			cmd_size = GX_LOAD_INDX_SIZE;
+			break;
+		case GX_LOAD_BP_REG:
+			cmd_size = GX_LOAD_BP_REG_SIZE;
+			break;
+		default:
+			if ((cmd_byte & GX_DRAW_PRIMITIVES) == 0x80 && distance >= GX_DRAW_PRIMITIVES_SIZE)
+			{
+				u16 count = reader.Read<u16>();
+				if (count == 0)
+				{
+					// Nothing to convert, keep it in the register write range.
+					continue;
+				}
+				// Flush the pending register writes, the draw depends on them.
+				cycles += RunRange(start, raw_start, cmd_offset - raw_start);
+				if (raw_start != cmd_offset)
+					entry.ops.push_back({ raw_start, cmd_offset - raw_start, -1 });
+
+				VertexLoaderParameters parameters;
+				PrepareDrawParameters(parameters, cmd_byte, count, reader.GetReadPosition(), reader.size());
+				const VertexLoaderBase* loader = VertexLoaderManager::GetActiveLoader(parameters);
+				parameters.needloaderrefresh = false;
+				u32 readsize = count * loader->m_VertexSize;
+				if (reader.size() < readsize)
+				{
+					// Same as the decoder, a truncated draw ends the list.
+					entry.uncacheable = true;
+					return cycles;
+				}
+				entry.draws.emplace_back();
+				CachedDraw& draw = entry.draws.back();
+				draw.offset = cmd_offset;
+				draw.cmd_byte = cmd_byte;
+				draw.count = count;
+				draw.vertex_size = loader->m_VertexSize;
+				draw.loader = nullptr;
+				draw.matrix_index = 0;
+				draw.finalcount = 0;
+				ExecuteDraw(entry, draw, start, size, &cycles);
+				entry.ops.push_back({ cmd_offset, 0, s32(entry.draws.size() - 1) });
+				reader.ReadSkip(readsize);
+				raw_start = cmd_offset + 1 + GX_DRAW_PRIMITIVES_SIZE + readsize;
+				continue;
+			}
+			// Nested calls and unknown opcodes are left to the decoder.
+			entry.uncacheable = true;
+			return cycles + RunRange(start, raw_start, size - raw_start);
+		}
+		if (distance < cmd_size)
+		{
+			entry.uncacheable = true;
+			return cycles + RunRange(start, raw_start, size - raw_start);
+		}
+		reader.ReadSkip(u32(cmd_size));
+	}
+	cycles += RunRange(start, raw_start, size - raw_start);
+	if (raw_start != size)
+		entry.ops.push_back({ raw_start, size - raw_start, -1 });
+	entry.recorded = true;
+	return cycles;
+}
+
+static u32 Replay(CachedDisplayList& entry, u8* start, u32 size)
+{
+	u32 cycles = 0;
+	for (const CachedOp& op : entry.ops)
+	{
+		if (op.draw < 0)
+		{
+			cycles += RunRange(start, op.offset, op.size);
+		}
+		else if (!ExecuteDraw(entry, entry.draws[op.draw], start, size, &cycles))
+		{
+			// The vertex format changed the layout of the list, interpret the
+			// remainder and record it again on the next call.
+			cycles += RunRange(start, op.offset, size - op.offset);
+			ResetEntry(entry);
+			entry.hash = 0;
+			break;
+		}
+	}
+	return cycles;
+}
+
+}  // namespace DLCache
 
 // NOTE - outside the namespace on purpose.
-bool HandleDisplayList(u32 address, u32 size)
+bool HandleDisplayList(u32 address, u32 size, u32* cycles)
 {
-	return false;
+	using namespace DLCache;
+	u8* start = Memory::GetPointer(address);
+	if (start == nullptr || size == 0)
+		return false;
+
+	u64 hash = XXH64(start, size, 0);
+	CachedDisplayList& entry = s_cache[CacheKey(address, size)];
+	entry.check_context = s_check_context;
+	if (entry.hash != hash)
+	{
+		ResetEntry(entry);
+		entry.hash = hash;
+	}
+	else if (entry.uncacheable)
+	{
+		return false;
+	}
+
+	if (entry.recorded)
+	{
+		*cycles = Replay(entry, start, size);
+	}
+	else
+	{
+		*cycles = Record(entry, start, size);
+		if (entry.uncacheable)
+		{
+			// Keep the hash so the list is not scanned again until it changes.
+			s_vertex_bytes -= entry.vertex_bytes;
+			entry.vertex_bytes = 0;
+			entry.ops.clear();
+			entry.draws.clear();
+		}
+	}
+	return true;
 }
 
 void IncrementCheckContextId()
 {
+	DLCache::s_check_context++;
 }
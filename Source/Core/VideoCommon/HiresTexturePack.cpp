@@ -0,0 +1,229 @@
+// Copyright 2013 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include <cstring>
+#include <xxhash.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "Common/Logging/Log.h"
+#include "Common/MathUtil.h"
+#include "Common/StringUtil.h"
+#include "VideoCommon/HiresTexturePack.h"
+#include "VideoCommon/TextureDecoder.h"
+#include "VideoCommon/TextureUtil.h"
+
+namespace HiresTexturePack
+{
+u64 HashName(const std::string& name)
+{
+	return XXH64(name.data(), name.size(), 0);
+}
+
+u64 GetDataSize(const Entry& entry)
+{
+	// Custom textures are only loaded in the formats TextureUtil::GetTextureSizeInBytes knows
+	if (entry.format < PC_TEX_FMT_BGRA32 || entry.format > PC_TEX_FMT_DXT5 ||
+		entry.width == 0 || entry.width > PACK_MAX_TEXTURE_SIZE ||
+		entry.height == 0 || entry.height > PACK_MAX_TEXTURE_SIZE || entry.levels == 0 ||
+		entry.levels > (u32)IntLog2(std::max(entry.width, entry.height)) + 1 ||
+		(entry.nrm_levels != 0 && entry.nrm_levels < entry.levels))
+	{
+		return 0;
+	}
+	u64 size = 0;
+	for (u32 level = 0; level < entry.levels; level++)
+	{
+		size += TextureUtil::GetTextureSizeInBytes(
+			TextureUtil::CalculateLevelSize(entry.width, level),
+			TextureUtil::CalculateLevelSize(entry.height, level),
+			static_cast<PC_TexFormat>(entry.format));
+	}
+	return entry.nrm_levels ? size * 2 : size;
+}
+
+Reader::~Reader()
+{
+	Close();
+}
+
+bool Reader::Open(const std::string& path)
+{
+	Close();
+#ifdef _WIN32
+	HANDLE file = CreateFile(UTF8ToTStr(path).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+		OPEN_EXISTING, FILE_FLAG_RANDOM_ACCESS, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+		return false;
+	LARGE_INTEGER size;
+	HANDLE mapping = nullptr;
+	const void* base = nullptr;
+	if (GetFileSizeEx(file, &size) && size.QuadPart >= (LONGLONG)sizeof(Header))
+		mapping = CreateFileMapping(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (mapping)
+		base = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	if (!base)
+	{
+		if (mapping)
+			CloseHandle(mapping);
+		CloseHandle(file);
+		return false;
+	}
+	m_file_handle = file;
+	m_mapping_handle = mapping;
+	m_size = (size_t)size.QuadPart;
+#else
+	int fd = open(path.c_str(), O_RDONLY);
+	if (fd < 0)
+		return false;
+	struct stat st;
+	void* base = MAP_FAILED;
+	if (fstat(fd, &st) == 0 && st.st_size >= (off_t)sizeof(Header))
+		base = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	// The mapping stays valid after the descriptor is closed
+	close(fd);
+	if (base == MAP_FAILED)
+		return false;
+	m_size = (size_t)st.st_size;
+#endif
+	m_base = static_cast<const u8*>(base);
+	m_header = reinterpret_cast<const Header*>(m_base);
+
+	const u64 toc_size = (u64)m_header->entry_count * sizeof(Entry);
+	if (m_header->magic != PACK_MAGIC || m_header->version != PACK_VERSION ||
+		m_header->toc_offset % PACK_DATA_ALIGNMENT != 0 ||
+		m_header->toc_offset > m_size || toc_size > m_size - m_header->toc_offset ||
+		m_header->names_offset > m_header->toc_offset)
+	{
+		ERROR_LOG(VIDEO, "Invalid custom texture pack %s", path.c_str());
+		Close();
+		return false;
+	}
+	m_entries = reinterpret_cast<const Entry*>(m_base + m_header->toc_offset);
+	m_names = reinterpret_cast<const char*>(m_base + m_header->names_offset);
+	const u64 names_size = m_header->toc_offset - m_header->names_offset;
+	for (u32 i = 0; i < m_header->entry_count; i++)
+	{
+		const Entry& entry = m_entries[i];
+		// The texture cache uploads the levels straight from the mapping, so the stored size
+		// has to be the one the levels need
+		if (entry.data_offset > m_size || entry.data_size > m_size - entry.data_offset ||
+			entry.data_size != GetDataSize(entry) ||
+			(u64)entry.name_offset + entry.name_length > names_size)
+		{
+			ERROR_LOG(VIDEO, "Custom texture pack %s is damaged", path.c_str());
+			Close();
+			return false;
+		}
+	}
+	INFO_LOG(VIDEO, "Mapped custom texture pack %s with %u textures", path.c_str(), m_header->entry_count);
+	return true;
+}
+
+void Reader::Close()
+{
+	if (m_base)
+	{
+#ifdef _WIN32
+		UnmapViewOfFile(m_base);
+		CloseHandle(m_mapping_handle);
+		CloseHandle(m_file_handle);
+		m_mapping_handle = nullptr;
+		m_file_handle = nullptr;
+#else
+		munmap(const_cast<u8*>(m_base), m_size);
+#endif
+	}
+	m_base = nullptr;
+	m_size = 0;
+	m_header = nullptr;
+	m_entries = nullptr;
+	m_names = nullptr;
+}
+
+const Entry* Reader::Find(const std::string& name) const
+{
+	if (!m_base)
+		return nullptr;
+	const u64 hash = HashName(name);
+	const Entry* end = m_entries + m_header->entry_count;
+	const Entry* entry = std::lower_bound(m_entries, end, hash,
+		[](const Entry& e, u64 h) { return e.name_hash < h; });
+	for (; entry != end && entry->name_hash == hash; ++entry)
+	{
+		if (entry->name_length == name.size() &&
+			memcmp(m_names + entry->name_offset, name.data(), name.size()) == 0)
+		{
+			return entry;
+		}
+	}
+	return nullptr;
+}
+
+bool Writer::Open(const std::string& path)
+{
+	m_entries.clear();
+	m_names.clear();
+	if (!m_file.Open(path, "wb"))
+		return false;
+	// The header is written last, once the offsets are known
+	Header header = {};
+	m_offset = sizeof(Header);
+	return m_file.WriteBytes(&header, sizeof(header));
+}
+
+bool Writer::Pad()
+{
+	static const u8 padding[PACK_DATA_ALIGNMENT] = {};
+	const u64 aligned = (m_offset + PACK_DATA_ALIGNMENT - 1) & ~(u64)(PACK_DATA_ALIGNMENT - 1);
+	if (!m_file.WriteBytes(padding, (size_t)(aligned - m_offset)))
+		return false;
+	m_offset = aligned;
+	return true;
+}
+
+bool Writer::AddTexture(const std::string& name, Entry entry, const u8* data)
+{
+	if (!Pad() || !m_file.WriteBytes(data, (size_t)entry.data_size))
+		return false;
+	entry.name_hash = HashName(name);
+	entry.data_offset = m_offset;
+	entry.name_offset = (u32)m_names.size();
+	entry.name_length = (u32)name.size();
+	m_names += name;
+	m_entries.push_back(entry);
+	m_offset += entry.data_size;
+	return true;
+}
+
+bool Writer::Finish(u32 flags)
+{
+	std::sort(m_entries.begin(), m_entries.end(),
+		[](const Entry& a, const Entry& b) { return a.name_hash < b.name_hash; });
+	Header header = {};
+	header.magic = PACK_MAGIC;
+	header.version = PACK_VERSION;
+	header.flags = flags;
+	header.entry_count = (u32)m_entries.size();
+	// The table of contents is read in place, so it starts aligned like the textures
+	bool success = Pad();
+	header.names_offset = m_offset;
+	success = success && m_file.WriteBytes(m_names.data(), m_names.size());
+	m_offset += m_names.size();
+	success = success && Pad();
+	header.toc_offset = m_offset;
+	success = success && m_file.WriteArray(m_entries.data(), m_entries.size()) &&
+		m_file.Seek(0, SEEK_SET) &&
+		m_file.WriteBytes(&header, sizeof(header));
+	return m_file.Close() && success;
+}
+}
@@ -0,0 +1,129 @@
+// Copyright 2013 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/NonCopyable.h"
+
+// Single file container for custom textures.
+// The file starts with a header, followed by the decoded mip chains (and material
+// maps) of every texture in the same layout HiresTexture::Load produces, a table of
+// names and a table of contents sorted by the hash of the texture name.
+// The reader maps the whole file in memory so textures are uploaded straight from
+// the mapped pages.
+namespace HiresTexturePack
+{
+enum
+{
+	PACK_MAGIC = 0x4B505448, // "HTPK"
+	PACK_VERSION = 1,
+	PACK_DATA_ALIGNMENT = 16,
+	// Largest width or height of a packed texture, its size in bytes still fits in an s32
+	PACK_MAX_TEXTURE_SIZE = 16384,
+};
+
+enum PackFlags
+{
+	// The pack contains textures named with the old <game_id>_<hash>_<format> scheme
+	PACK_FLAG_NATIVE_NAMES = 1 << 0,
+	// The pack contains textures named with the tex1_ scheme
+	PACK_FLAG_NEW_NAMES = 1 << 1,
+};
+
+enum EntryFlags
+{
+	ENTRY_FLAG_EMISSIVE_IN_COLOR = 1 << 0,
+};
+
+struct Header
+{
+	u32 magic;
+	u32 version;
+	u32 flags;
+	u32 entry_count;
+	u64 toc_offset;
+	u64 names_offset;
+};
+static_assert(sizeof(Header) == 32, "Unexpected pack header size");
+
+struct Entry
+{
+	u64 name_hash;
+	u64 data_offset;
+	u64 data_size;
+	u32 name_offset;
+	u32 name_length;
+	u32 width;
+	u32 height;
+	u32 levels;
+	u32 nrm_levels;
+	u32 format; // PC_TexFormat
+	u32 flags;
+};
+static_assert(sizeof(Entry) == 56, "Unexpected pack entry size");
+
+u64 HashName(const std::string& name);
+// Size of the mip chain, and the material maps if it has them, that the texture cache uploads
+// for the entry. 0 if the format, size or levels can't be loaded.
+u64 GetDataSize(const Entry& entry);
+
+class Reader : NonCopyable
+{
+public:
+	Reader() = default;
+	~Reader();
+
+	bool Open(const std::string& path);
+	void Close();
+	bool IsOpen() const
+	{
+		return m_base != nullptr;
+	}
+	u32 GetFlags() const
+	{
+		return m_header->flags;
+	}
+
+	// Returns nullptr if the pack has no texture with that name
+	const Entry* Find(const std::string& name) const;
+	const u8* GetData(const Entry& entry) const
+	{
+		return m_base + entry.data_offset;
+	}
+
+private:
+	const u8* m_base = nullptr;
+	size_t m_size = 0;
+	const Header* m_header = nullptr;
+	const Entry* m_entries = nullptr;
+	const char* m_names = nullptr;
+#ifdef _WIN32
+	void* m_file_handle = nullptr;
+	void* m_mapping_handle = nullptr;
+#endif
+};
+
+class Writer : NonCopyable
+{
+public:
+	bool Open(const std::string& path);
+	// The entry offsets and name fields are filled in by the writer
+	bool AddTexture(const std::string& name, Entry entry, const u8* data);
+	bool Finish(u32 flags);
+
+private:
+	// Pads the file up to PACK_DATA_ALIGNMENT
+	bool Pad();
+
+	File::IOFile m_file;
+	std::vector<Entry> m_entries;
+	std::string m_names;
+	u64 m_offset = 0;
+};
+}
@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <cinttypes>
 #include <cstring>
+#include <list>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -16,6 +17,7 @@
 #include <SOIL/SOIL.h>
 
 #include "Common/CommonPaths.h"
+#include "Common/CPUDetect.h"
 #include "Common/FileSearch.h"
 #include "Common/FileUtil.h"
 #include "Common/Flag.h"
@@ -29,6 +31,7 @@
 #include "Core/ConfigManager.h"
 
 #include "VideoCommon/ImageLoader.h"
+#include "VideoCommon/HiresTexturePack.h"
 #include "VideoCommon/HiresTextures.h"
 #include "VideoCommon/OnScreenDisplay.h"
 #include "VideoCommon/TextureUtil.h"
@@ -77,16 +80,45 @@ struct HiresTextureCacheItem
 
 typedef std::unordered_map<std::string, HiresTextureCacheItem> HiresTextureCache;
 static HiresTextureCache s_textureMap;
+// Held while the texture list changes, and by the lookups of Preload, which
+// unlike the other lookups don't run on the GPU thread
+static std::mutex s_textureMapMutex;
 
-static std::unordered_map<std::string, std::shared_ptr<HiresTexture>> s_textureCache;
+// Loaded textures, kept inside max_mem by evicting the least recently used ones
+struct HiresTextureCacheEntry
+{
+	std::shared_ptr<HiresTexture> texture;
+	std::list<std::string>::iterator lru_iter;
+};
+static std::unordered_map<std::string, HiresTextureCacheEntry> s_textureCache;
+// Most recently used textures at the front
+static std::list<std::string> s_textureCacheLRU;
 static std::mutex s_textureCacheMutex;
 static Common::Flag s_textureCacheAbortLoading;
 
+// When a pack exists for the game it replaces the texture directory and the cache
+static HiresTexturePack::Reader s_texturePack;
+
 static bool s_check_native_format;
 static bool s_check_new_format;
 static std::atomic<size_t> size_sum;
 static size_t max_mem = 0;
-static std::thread s_prefetcher;
+
+// Prefetching runs on several threads that pull from a list sorted by priority
+static std::vector<std::thread> s_prefetchers;
+static std::vector<std::string> s_prefetchQueue;
+static std::atomic<size_t> s_prefetchNext;
+static std::atomic<size_t> s_prefetchDone;
+static std::atomic<size_t> s_prefetchActive;
+static std::atomic<u32> s_prefetchLastReport;
+static u32 s_prefetchStartTime;
+static const u32 PREFETCH_REPORT_INTERVAL = 2000;
+static const int MAX_PREFETCH_THREADS = 8;
+
+// Number of times each texture was requested in the previous sessions and the
+// current one, stored per game so the prefetcher loads the textures in use first
+static std::unordered_map<std::string, u32> s_textureUsage;
+static bool s_textureUsageChanged;
 
 static const std::string s_format_prefix = "tex1_";
 HiresTexture::HiresTexture() :
@@ -95,7 +127,8 @@ HiresTexture::HiresTexture() :
 	m_levels(0),
 	m_nrm_levels(0),
 	m_cached_data(nullptr),
-	m_cached_data_size(0)
+	m_cached_data_size(0),
+	m_mapped_data(nullptr)
 {}
 
 void HiresTexture::Init()
@@ -110,14 +143,84 @@ void HiresTexture::Init()
 
 void HiresTexture::Shutdown()
 {
-	if (s_prefetcher.joinable())
-	{
-		s_textureCacheAbortLoading.Set();
-		s_prefetcher.join();
-	}
+	std::lock_guard<std::mutex> map_lock(s_textureMapMutex);
+	StopPrefetch();
+	SaveUsage();
 
 	s_textureMap.clear();
 	s_textureCache.clear();
+	s_textureCacheLRU.clear();
+	s_textureUsage.clear();
+	s_texturePack.Close();
+}
+
+std::string HiresTexture::GetUsageFilename()
+{
+	return File::GetUserPath(D_CACHE_IDX) + "HiresTextures_" + SConfig::GetInstance().m_strGameID + ".usage";
+}
+
+void HiresTexture::LoadUsage()
+{
+	s_textureUsage.clear();
+	s_textureUsageChanged = false;
+	std::string data;
+	if (!File::ReadFileToString(GetUsageFilename(), data))
+		return;
+	std::vector<std::string> lines;
+	SplitString(data, '\n', lines);
+	for (const std::string& line : lines)
+	{
+		// <count> <basename>
+		size_t separator = line.find(' ');
+		u32 count = 0;
+		if (separator != std::string::npos && TryParse(line.substr(0, separator), &count))
+			s_textureUsage[line.substr(separator + 1)] = count;
+	}
+}
+
+void HiresTexture::SaveUsage()
+{
+	std::lock_guard<std::mutex> lk(s_textureCacheMutex);
+	if (!s_textureUsageChanged || SConfig::GetInstance().m_strGameID.empty())
+		return;
+	std::string data;
+	for (const auto& usage : s_textureUsage)
+		data += StringFromFormat("%u %s\n", usage.second, usage.first.c_str());
+	File::CreateFullPath(File::GetUserPath(D_CACHE_IDX));
+	if (!File::WriteStringToFile(data, GetUsageFilename()))
+		ERROR_LOG(VIDEO, "Failed to save custom texture usage to %s", GetUsageFilename().c_str());
+	s_textureUsageChanged = false;
+}
+
+// Must be called with s_textureCacheMutex held
+static void RemoveFromCache(std::unordered_map<std::string, HiresTextureCacheEntry>::iterator iter)
+{
+	size_sum.fetch_sub(iter->second.texture->m_cached_data_size);
+	s_textureCacheLRU.erase(iter->second.lru_iter);
+	s_textureCache.erase(iter);
+}
+
+// Must be called with s_textureCacheMutex held.
+// Frees the least recently used textures until required_size more bytes fit in
+// the budget, returns false if that is not possible.
+static bool EvictFromCache(size_t required_size)
+{
+	if (required_size > max_mem)
+		return false;
+	while (size_sum.load() + required_size > max_mem && !s_textureCacheLRU.empty())
+		RemoveFromCache(s_textureCache.find(s_textureCacheLRU.back()));
+	return true;
+}
+
+// Must be called with s_textureCacheMutex held.
+// Textures requested by the game go to the front of the LRU list, prefetched ones
+// to the back so they are the first to be evicted.
+static void InsertIntoCache(const std::string& basename, std::shared_ptr<HiresTexture> texture, bool used)
+{
+	HiresTextureCacheEntry& entry = s_textureCache[basename];
+	entry.texture = std::move(texture);
+	entry.lru_iter = s_textureCacheLRU.insert(used ? s_textureCacheLRU.begin() : s_textureCacheLRU.end(), basename);
+	size_sum.fetch_add(entry.texture->m_cached_data_size);
 }
 
 std::string HiresTexture::GetTextureDirectory(const std::string& game_id)
@@ -131,40 +234,29 @@ std::string HiresTexture::GetTextureDirectory(const std::string& game_id)
 	return texture_directory;
 }
 
-void HiresTexture::Update()
+std::string HiresTexture::GetTexturePackPath(const std::string& game_id)
 {
-	s_check_native_format = false;
-	s_check_new_format = false;
-	bool BuildMaterialMaps = g_ActiveConfig.bHiresMaterialMapsBuild;
-	if (s_prefetcher.joinable())
-	{
-		s_textureCacheAbortLoading.Set();
-		s_prefetcher.join();
-	}
+	const std::string pack_path = File::GetUserPath(D_HIRESTEXTURES_IDX) + game_id + ".htp";
 
-	if (!g_ActiveConfig.bHiresTextures)
-	{
-		s_textureMap.clear();
-		s_textureCache.clear();
-		size_sum.store(0);
-		return;
-	}
+	// If there's no pack with the region-specific ID, look for a 3-character region-free one
+	if (!File::Exists(pack_path))
+		return File::GetUserPath(D_HIRESTEXTURES_IDX) + game_id.substr(0, 3) + ".htp";
 
-	if (!g_ActiveConfig.bCacheHiresTextures)
-	{
-		s_textureCache.clear();
-		size_sum.store(0);
-	}
+	return pack_path;
+}
 
-	s_textureMap.clear();
-	const std::string& game_id = SConfig::GetInstance().m_strGameID;
-	const std::string texture_directory = GetTextureDirectory(game_id);
+// Fills map with the custom textures found in texture_directory,
+// returns the HiresTexturePack::PackFlags matching the names found.
+static u32 ScanTextureDirectory(const std::string& texture_directory, const std::string& game_id,
+	bool build_material_maps, HiresTextureCache& map)
+{
+	u32 name_flags = 0;
 
 	std::string ddscode(".dds");
 	std::string cddscode(".DDS");
 	std::vector<std::string> Extensions;
 	Extensions.push_back(".png");
-	if (!BuildMaterialMaps)
+	if (!build_material_maps)
 	{
 		Extensions.push_back(".dds");
 	}
@@ -181,11 +273,11 @@ void HiresTexture::Update()
 		SplitPath(fileitem, nullptr, &FileName, &Extension);
 		if (FileName.substr(0, code.length()) == code)
 		{
-			s_check_native_format = true;
+			name_flags |= HiresTexturePack::PACK_FLAG_NATIVE_NAMES;
 		}
 		else if (FileName.substr(0, s_format_prefix.length()) == s_format_prefix)
 		{
-			s_check_new_format = true;
+			name_flags |= HiresTexturePack::PACK_FLAG_NEW_NAMES;
 		}
 		else
 		{
@@ -193,22 +285,22 @@ void HiresTexture::Update()
 			continue;
 		}
 		size_t map_index = 0;
-		size_t max_type = BuildMaterialMaps ? MapType::emissive : MapType::normal;
+		size_t max_type = build_material_maps ? MapType::emissive : MapType::normal;
 		bool luma_encoded = false;
 		for (size_t tag = 1; tag <= max_type; tag++)
 		{
 			if (StringEndsWith(FileName, s_maps_tags[tag]))
 			{
-				map_index = BuildMaterialMaps ? tag : MapType::material;
+				map_index = build_material_maps ? tag : MapType::material;
 				FileName = FileName.substr(0, FileName.size() - s_maps_tags[tag].size());
 				break;
 			}
 		}
-		if (BuildMaterialMaps && map_index == MapType::material)
+		if (build_material_maps && map_index == MapType::material)
 		{
 			continue;
 		}
-		else if (!BuildMaterialMaps && map_index == MapType::color)
+		else if (!build_material_maps && map_index == MapType::color)
 		{
 			if (StringEndsWith(FileName, "_lum"))
 			{
@@ -226,9 +318,9 @@ void HiresTexture::Update()
 			sscanf(miplevel.substr(3, std::string::npos).c_str(), "%i", &level);
 			FileName = FileName.substr(0, idx);
 		}
-		HiresTextureCache::iterator iter = s_textureMap.find(FileName);
+		HiresTextureCache::iterator iter = map.find(FileName);
 		u32 min_item_size = level + 1;
-		if (iter == s_textureMap.end())
+		if (iter == map.end())
 		{
 			HiresTextureCacheItem item(min_item_size);
 			if (luma_encoded)
@@ -238,7 +330,7 @@ void HiresTexture::Update()
 			item.maps[map_index].resize(min_item_size);
 			std::vector<hires_mip_level> &dst = item.maps[map_index];
 			dst[level] = mip_level_detail;
-			s_textureMap.emplace(FileName, item);
+			map.emplace(FileName, item);
 		}
 		else
 		{
@@ -254,6 +346,51 @@ void HiresTexture::Update()
 			dst[level] = mip_level_detail;
 		}
 	}
+	return name_flags;
+}
+
+void HiresTexture::Update()
+{
+	s_check_native_format = false;
+	s_check_new_format = false;
+	bool BuildMaterialMaps = g_ActiveConfig.bHiresMaterialMapsBuild;
+	std::lock_guard<std::mutex> map_lock(s_textureMapMutex);
+	StopPrefetch();
+	SaveUsage();
+
+	if (!g_ActiveConfig.bHiresTextures)
+	{
+		s_texturePack.Close();
+		s_textureMap.clear();
+		s_textureCache.clear();
+		s_textureCacheLRU.clear();
+		s_textureUsage.clear();
+		size_sum.store(0);
+		return;
+	}
+
+	if (!g_ActiveConfig.bCacheHiresTextures)
+	{
+		s_textureCache.clear();
+		s_textureCacheLRU.clear();
+		size_sum.store(0);
+	}
+	LoadUsage();
+
+	s_textureMap.clear();
+	s_texturePack.Close();
+	const std::string& game_id = SConfig::GetInstance().m_strGameID;
+	if (s_texturePack.Open(GetTexturePackPath(game_id)))
+	{
+		// Packed textures are mapped in memory, there is nothing to scan or prefetch
+		s_check_native_format = (s_texturePack.GetFlags() & HiresTexturePack::PACK_FLAG_NATIVE_NAMES) != 0;
+		s_check_new_format = (s_texturePack.GetFlags() & HiresTexturePack::PACK_FLAG_NEW_NAMES) != 0;
+		OSD::AddMessage("Custom Textures loaded from texture pack", 5000);
+		return;
+	}
+	u32 name_flags = ScanTextureDirectory(GetTextureDirectory(game_id), game_id, BuildMaterialMaps, s_textureMap);
+	s_check_native_format = (name_flags & HiresTexturePack::PACK_FLAG_NATIVE_NAMES) != 0;
+	s_check_new_format = (name_flags & HiresTexturePack::PACK_FLAG_NEW_NAMES) != 0;
 
 	if (g_ActiveConfig.bCacheHiresTextures && s_textureMap.size() > 0)
 	{
@@ -261,63 +398,121 @@ void HiresTexture::Update()
 		auto iter = s_textureCache.begin();
 		while (iter != s_textureCache.end())
 		{
-			if (s_textureMap.find(iter->first) == s_textureMap.end())
+			auto current = iter++;
+			if (s_textureMap.find(current->first) == s_textureMap.end())
 			{
-				size_sum.fetch_sub(iter->second->m_cached_data_size);
-				iter = s_textureCache.erase(iter);
-			}
-			else
-			{
-				iter++;
+				RemoveFromCache(current);
 			}
 		}
-		s_textureCacheAbortLoading.Clear();
-		s_prefetcher = std::thread(Prefetch);
+		StartPrefetch();
 	}
 }
 
-void HiresTexture::Prefetch()
+void HiresTexture::StartPrefetch()
 {
-	Common::SetCurrentThreadName("Prefetcher");
-
-	u32 starttime = Common::Timer::GetTimeMs();
+	// Textures used in previous sessions come first, the most used ones before the others
+	std::vector<std::pair<u32, const std::string*>> order;
+	order.reserve(s_textureMap.size());
 	for (const auto& entry : s_textureMap)
 	{
-		const std::string& base_filename = entry.first;
+		if (s_textureCache.find(entry.first) != s_textureCache.end())
+			continue;
+		auto usage = s_textureUsage.find(entry.first);
+		order.emplace_back(usage != s_textureUsage.end() ? usage->second : 0, &entry.first);
+	}
+	std::stable_sort(order.begin(), order.end(), [](const auto& a, const auto& b) { return a.first > b.first; });
+	s_prefetchQueue.clear();
+	s_prefetchQueue.reserve(order.size());
+	for (const auto& entry : order)
+		s_prefetchQueue.push_back(*entry.second);
+	if (s_prefetchQueue.empty())
+		return;
 
-		std::unique_lock<std::mutex> lk(s_textureCacheMutex);
+	s_prefetchNext.store(0);
+	s_prefetchDone.store(0);
+	s_textureCacheAbortLoading.Clear();
+	s_prefetchStartTime = Common::Timer::GetTimeMs();
+	s_prefetchLastReport.store(s_prefetchStartTime);
+	int threads = std::min(std::max(cpu_info.logical_cpu_count - 1, 1), MAX_PREFETCH_THREADS);
+	threads = std::min<int>(threads, static_cast<int>(s_prefetchQueue.size()));
+	s_prefetchActive.store(threads);
+	for (int i = 0; i < threads; i++)
+		s_prefetchers.emplace_back(Prefetch);
+}
 
-		auto iter = s_textureCache.find(base_filename);
-		if (iter == s_textureCache.end())
+void HiresTexture::StopPrefetch()
+{
+	s_textureCacheAbortLoading.Set();
+	for (std::thread& prefetcher : s_prefetchers)
+		prefetcher.join();
+	s_prefetchers.clear();
+	s_prefetchQueue.clear();
+}
+
+void HiresTexture::Prefetch()
+{
+	Common::SetCurrentThreadName("Prefetcher");
+
+	bool budget_full = false;
+	size_t index;
+	while (!budget_full && !s_textureCacheAbortLoading.IsSet() &&
+		(index = s_prefetchNext.fetch_add(1)) < s_prefetchQueue.size())
+	{
+		const std::string& base_filename = s_prefetchQueue[index];
+		bool cached;
+		{
+			// The game may have requested it in the meantime
+			std::lock_guard<std::mutex> lk(s_textureCacheMutex);
+			cached = s_textureCache.find(base_filename) != s_textureCache.end();
+		}
+		std::shared_ptr<HiresTexture> ptr;
+		if (!cached)
 		{
-			lk.unlock();
-			HiresTexture* ptr = Load(base_filename, [](size_t requested_size)
+			ptr.reset(Load(base_filename, [](size_t requested_size)
 			{
 				return new u8[requested_size];
-			}, true);
-			lk.lock();
-			if (ptr != nullptr)
-			{
-				size_sum.fetch_add(ptr->m_cached_data_size);
-				iter = s_textureCache.insert(iter, std::make_pair(base_filename, std::shared_ptr<HiresTexture>(ptr)));
-			}
+			}, true));
 		}
-
-		if (s_textureCacheAbortLoading.IsSet())
+		if (ptr)
 		{
-			return;
+			std::lock_guard<std::mutex> lk(s_textureCacheMutex);
+			// Prefetching in priority order, once the budget is used up the remaining
+			// textures are less useful than the ones already loaded
+			if (size_sum.load() + ptr->m_cached_data_size > max_mem)
+				budget_full = true;
+			else if (s_textureCache.find(base_filename) == s_textureCache.end())
+				InsertIntoCache(base_filename, std::move(ptr), false);
 		}
+		s_prefetchDone.fetch_add(1);
 
-		if (size_sum.load() > max_mem)
+		u32 now = Common::Timer::GetTimeMs();
+		u32 last_report = s_prefetchLastReport.load();
+		if (now - last_report >= PREFETCH_REPORT_INTERVAL &&
+			s_prefetchLastReport.compare_exchange_strong(last_report, now))
 		{
-			g_Config.bCacheHiresTextures = false;
-
-			OSD::AddMessage(StringFromFormat("Custom Textures prefetching after %.1f MB aborted, not enough RAM available", size_sum / (1024.0 * 1024.0)), 10000);
-			return;
+			double elapsed = (now - s_prefetchStartTime) / 1000.0;
+			OSD::AddMessage(StringFromFormat("Custom Textures prefetching %zu/%zu, %.1f MB (%.1f MB/s)",
+				s_prefetchDone.load(), s_prefetchQueue.size(), size_sum / (1024.0 * 1024.0),
+				size_sum / (1024.0 * 1024.0) / elapsed), PREFETCH_REPORT_INTERVAL);
 		}
 	}
-	u32 stoptime = Common::Timer::GetTimeMs();
-	OSD::AddMessage(StringFromFormat("Custom Textures loaded, %.1f MB in %.1f s", size_sum / (1024.0 * 1024.0), (stoptime - starttime) / 1000.0), 10000);
+
+	if (budget_full)
+	{
+		// Let the other threads stop as well
+		s_prefetchNext.store(s_prefetchQueue.size());
+	}
+	// The last thread to finish reports the result
+	if (s_prefetchActive.fetch_sub(1) != 1 || s_textureCacheAbortLoading.IsSet())
+		return;
+	double elapsed = (Common::Timer::GetTimeMs() - s_prefetchStartTime) / 1000.0;
+	double size_mb = size_sum / (1024.0 * 1024.0);
+	std::string message = StringFromFormat("Custom Textures loaded, %zu/%zu textures, %.1f MB in %.1f s (%.1f MB/s)",
+		s_prefetchDone.load(), s_prefetchQueue.size(), size_mb, elapsed, elapsed > 0 ? size_mb / elapsed : 0.0);
+	if (s_prefetchDone.load() < s_prefetchQueue.size())
+		message += ", memory budget reached";
+	INFO_LOG(VIDEO, "%s", message.c_str());
+	OSD::AddMessage(message, 10000);
 }
 
 std::string HiresTexture::GenBaseName(
@@ -347,6 +542,10 @@ std::string HiresTexture::GenBaseName(
 			else
 				return name;
 		}
+		else if (s_texturePack.Find(name))
+		{
+			return name;
+		}
 	}
 	if (dump || s_check_new_format || convert)
 	{
@@ -619,40 +818,107 @@ std::shared_ptr<HiresTexture> HiresTexture::Search(
 	const std::string& basename,
 	std::function<u8*(size_t)> request_buffer_delegate)
 {
+	if (s_texturePack.IsOpen())
+	{
+		const HiresTexturePack::Entry* entry = s_texturePack.Find(basename);
+		if (!entry)
+			return nullptr;
+		{
+			std::lock_guard<std::mutex> lk(s_textureCacheMutex);
+			s_textureUsage[basename]++;
+			s_textureUsageChanged = true;
+		}
+		std::shared_ptr<HiresTexture> ptr(new HiresTexture());
+		ptr->m_format = static_cast<PC_TexFormat>(entry->format);
+		ptr->m_width = entry->width;
+		ptr->m_height = entry->height;
+		ptr->m_levels = entry->levels;
+		ptr->m_nrm_levels = entry->nrm_levels;
+		ptr->emissive_in_color = (entry->flags & HiresTexturePack::ENTRY_FLAG_EMISSIVE_IN_COLOR) != 0;
+		ptr->m_mapped_data = s_texturePack.GetData(*entry);
+		return ptr;
+	}
 	if (g_ActiveConfig.bCacheHiresTextures)
 	{
 		std::unique_lock<std::mutex> lk(s_textureCacheMutex);
+		if (s_textureMap.find(basename) != s_textureMap.end())
+		{
+			s_textureUsage[basename]++;
+			s_textureUsageChanged = true;
+		}
 
 		auto iter = s_textureCache.find(basename);
 		if (iter != s_textureCache.end())
 		{
-			HiresTexture* current = iter->second.get();
+			s_textureCacheLRU.splice(s_textureCacheLRU.begin(), s_textureCacheLRU, iter->second.lru_iter);
+			HiresTexture* current = iter->second.texture.get();
 			u8* dst = request_buffer_delegate(current->m_cached_data_size);
 			memcpy(dst, current->m_cached_data.get(), current->m_cached_data_size);
-			return iter->second;
+			return iter->second.texture;
 		}
 		lk.unlock();
-		if (size_sum.load() < max_mem)
+		std::shared_ptr<HiresTexture> ptr(Load(basename, [](size_t requested_size)
 		{
-			std::shared_ptr<HiresTexture> ptr(Load(basename, [](size_t requested_size)
-			{
-				return new u8[requested_size];
-			}, true));
+			return new u8[requested_size];
+		}, true));
+		if (ptr)
+		{
+			HiresTexture* current = ptr.get();
+			u8* dst = request_buffer_delegate(current->m_cached_data_size);
+			memcpy(dst, current->m_cached_data.get(), current->m_cached_data_size);
 			lk.lock();
-			if (ptr)
+			// The prefetcher may have loaded it in the meantime
+			if (s_textureCache.find(basename) == s_textureCache.end() &&
+				EvictFromCache(current->m_cached_data_size))
 			{
-				s_textureCache[basename] = ptr;
-				HiresTexture* current = ptr.get();
-				size_sum.fetch_add(current->m_cached_data_size);
-				u8* dst = request_buffer_delegate(current->m_cached_data_size);
-				memcpy(dst, current->m_cached_data.get(), current->m_cached_data_size);
+				InsertIntoCache(basename, ptr, true);
 			}
-			return ptr;
 		}
+		return ptr;
 	}
 	return std::shared_ptr<HiresTexture>(Load(basename, request_buffer_delegate, false));
 }
 
+bool HiresTexture::Preload(
+	const u8* texture, size_t texture_size,
+	u32 width, u32 height,
+	int format,
+	bool has_mipmaps)
+{
+	// Converting renames files and changes the texture list, that stays on the GPU thread
+	if (!g_ActiveConfig.bHiresTextures || g_ActiveConfig.bConvertHiresTextures)
+		return false;
+	std::lock_guard<std::mutex> map_lock(s_textureMapMutex);
+	const std::string basename = GenBaseName(texture, texture_size, nullptr, 0, width, height,
+		format, has_mipmaps, g_ActiveConfig.bDumpTextures);
+	// Packed textures are mapped, there is nothing to load
+	if (s_texturePack.IsOpen())
+		return s_texturePack.Find(basename) != nullptr;
+	if (s_textureMap.find(basename) == s_textureMap.end())
+		return false;
+	if (!g_ActiveConfig.bCacheHiresTextures)
+		return true;
+	{
+		std::lock_guard<std::mutex> lk(s_textureCacheMutex);
+		if (s_textureCache.find(basename) != s_textureCache.end())
+			return true;
+	}
+	std::shared_ptr<HiresTexture> ptr(Load(basename, [](size_t requested_size)
+	{
+		return new u8[requested_size];
+	}, true));
+	if (ptr)
+	{
+		std::lock_guard<std::mutex> lk(s_textureCacheMutex);
+		if (s_textureCache.find(basename) == s_textureCache.end() &&
+			EvictFromCache(ptr->m_cached_data_size))
+		{
+			InsertIntoCache(basename, std::move(ptr), true);
+		}
+	}
+	return true;
+}
+
 HiresTexture* HiresTexture::Load(const std::string& basename,
 	std::function<u8*(size_t)> request_buffer_delegate, bool cacheresult)
 {
@@ -665,7 +931,14 @@ HiresTexture* HiresTexture::Load(const std::string& basename,
 	{
 		return nullptr;
 	}
-	HiresTextureCacheItem& current = iter->second;
+	return Load(iter->second, request_buffer_delegate, cacheresult,
+		g_ActiveConfig.HiresMaterialMapsEnabled(), g_ActiveConfig.bHiresMaterialMapsBuild);
+}
+
+HiresTexture* HiresTexture::Load(const HiresTextureCacheItem& current,
+	std::function<u8*(size_t)> request_buffer_delegate, bool cacheresult,
+	bool material_maps, bool build_material_maps)
+{
 	if (current.maps[MapType::color].size() == 0)
 	{
 		return nullptr;
@@ -682,8 +955,8 @@ HiresTexture* HiresTexture::Load(const std::string& basename,
 	bool last_level_is_dds = false;
 	bool allocated_data = false;
 	bool mipmapsize_included = false;
-	size_t material_mat_index = g_ActiveConfig.bHiresMaterialMapsBuild ? MapType::normal : MapType::material;
-	bool nrm_posible = current.maps[MapType::color].size() == current.maps[material_mat_index].size() && g_ActiveConfig.HiresMaterialMapsEnabled();
+	size_t material_mat_index = build_material_maps ? MapType::normal : MapType::material;
+	bool nrm_posible = current.maps[MapType::color].size() == current.maps[material_mat_index].size() && material_maps;
 	size_t remaining_buffer_size = 0;
 	size_t total_buffer_size = 0;
 	std::function<u8*(size_t, bool)> first_level_function = [&](size_t requiredsize, bool mipmapsincluded)
@@ -714,7 +987,7 @@ HiresTexture* HiresTexture::Load(const std::string& basename,
 	for (size_t level = 0; level < current.maps[MapType::color].size(); level++)
 	{
 		ImageLoaderParams imgInfo;
-		hires_mip_level &item = current.maps[MapType::color][level];
+		const hires_mip_level &item = current.maps[MapType::color][level];
 		bool emissive_present = current.emissive_in_color;
 		imgInfo.dst = nullptr;
 		imgInfo.Path = item.path.c_str();
@@ -748,7 +1021,7 @@ HiresTexture* HiresTexture::Load(const std::string& basename,
 				break;
 			}
 			last_level_is_dds = false;
-			if (g_ActiveConfig.bHiresMaterialMapsBuild)
+			if (build_material_maps)
 			{
 				emissive_present = BuildColor(current, imgInfo, level);
 			}
@@ -843,7 +1116,7 @@ HiresTexture* HiresTexture::Load(const std::string& basename,
 		for (size_t level = 0; level < current.maps[material_mat_index].size(); level++)
 		{
 			ImageLoaderParams imgInfo;
-			hires_mip_level &item = current.maps[material_mat_index][level];
+			const hires_mip_level &item = current.maps[material_mat_index][level];
 			imgInfo.dst = nullptr;
 			imgInfo.Path = item.path.c_str();
 			imgInfo.request_buffer_delegate = allocation_function;
@@ -867,7 +1140,7 @@ HiresTexture* HiresTexture::Load(const std::string& basename,
 					break;
 				}
 				last_level_is_dds = false;
-				if (g_ActiveConfig.bHiresMaterialMapsBuild)
+				if (build_material_maps)
 				{
 					BuildMaterial(current, imgInfo, level);
 				}
@@ -961,3 +1234,71 @@ HiresTexture* HiresTexture::Load(const std::string& basename,
 	}
 	return ret;
 }
+
+bool HiresTexture::BuildPack(const std::string& game_id, const std::string& texture_directory,
+	bool material_maps, bool build_material_maps,
+	std::function<bool(const std::string&, float)> progress)
+{
+	HiresTextureCache textures;
+	u32 name_flags = ScanTextureDirectory(texture_directory, game_id, build_material_maps, textures);
+	if (textures.empty())
+	{
+		ERROR_LOG(VIDEO, "No custom textures found in %s", texture_directory.c_str());
+		return false;
+	}
+	// Sorted so the same directory always produces the same file
+	std::vector<const HiresTextureCache::value_type*> items;
+	items.reserve(textures.size());
+	for (const auto& item : textures)
+		items.push_back(&item);
+	std::sort(items.begin(), items.end(), [](const auto* a, const auto* b) { return a->first < b->first; });
+
+	const std::string pack_path = texture_directory + ".htp";
+	const std::string temp_path = pack_path + ".tmp";
+	HiresTexturePack::Writer writer;
+	if (!writer.Open(temp_path))
+	{
+		ERROR_LOG(VIDEO, "Failed to create custom texture pack %s", temp_path.c_str());
+		return false;
+	}
+	bool success = true;
+	for (size_t i = 0; i < items.size() && success; i++)
+	{
+		const std::string& name = items[i]->first;
+		if (!progress(name, static_cast<float>(i) / items.size()))
+		{
+			success = false;
+			break;
+		}
+		std::unique_ptr<HiresTexture> texture(Load(items[i]->second, [](size_t requested_size)
+		{
+			return new u8[requested_size];
+		}, true, material_maps, build_material_maps));
+		if (!texture)
+			continue;
+		HiresTexturePack::Entry entry = {};
+		entry.width = texture->m_width;
+		entry.height = texture->m_height;
+		entry.levels = texture->m_levels;
+		entry.nrm_levels = texture->m_nrm_levels;
+		entry.format = texture->m_format;
+		entry.flags = texture->emissive_in_color ? HiresTexturePack::ENTRY_FLAG_EMISSIVE_IN_COLOR : 0;
+		// The loader over-allocates, only the levels the texture cache uploads are stored
+		entry.data_size = HiresTexturePack::GetDataSize(entry);
+		if (!entry.data_size)
+		{
+			ERROR_LOG(VIDEO, "Custom texture %s can't be packed", name.c_str());
+			continue;
+		}
+		success = writer.AddTexture(name, entry, texture->m_cached_data.get());
+	}
+	success = writer.Finish(name_flags) && success;
+	if (!success || !File::Rename(temp_path, pack_path))
+	{
+		File::Delete(temp_path);
+		return false;
+	}
+	progress("", 1.0f);
+	INFO_LOG(VIDEO, "Packed %zu custom textures into %s", items.size(), pack_path.c_str());
+	return true;
+}
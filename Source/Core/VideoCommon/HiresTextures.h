@@ -11,6 +11,8 @@
 #include "VideoCommon/TextureDecoder.h"
 #include "VideoCommon/VideoCommon.h"
 
+struct HiresTextureCacheItem;
+
 class HiresTexture
 {
 public:
@@ -30,6 +32,25 @@ public:
 		bool has_mipmaps,
 		bool dump = false);
 
+	// Loads the custom texture of a texture that isn't paletted into the cache ahead of
+	// its first use, from any thread. Returns whether there is a custom texture for it.
+	static bool Preload(
+		const u8* texture, size_t texture_size,
+		u32 width, u32 height,
+		int format,
+		bool has_mipmaps);
+
+	// Packs the custom textures of game_id found in texture_directory into
+	// texture_directory.htp, a single file that is mapped instead of loading every
+	// texture on its own. Material maps are packed if material_maps is set, built
+	// from their sources if build_material_maps is. progress receives the name of
+	// the texture being packed and the completed fraction, returning false aborts.
+	static bool BuildPack(const std::string& game_id, const std::string& texture_directory,
+		bool material_maps, bool build_material_maps,
+		std::function<bool(const std::string&, float)> progress);
+	// The directory the custom textures of game_id are loaded from
+	static std::string GetTextureDirectory(const std::string& game_id);
+
 	~HiresTexture()
 	{};
 	PC_TexFormat m_format;
@@ -37,10 +58,20 @@ public:
 	bool emissive_in_color;
 	std::unique_ptr<u8> m_cached_data;
 	size_t m_cached_data_size;
+	// Texture data inside a mapped texture pack, nullptr for textures loaded from files
+	const u8* m_mapped_data;
 private:
 	static HiresTexture* Load(const std::string& base_filename,
 		std::function<u8*(size_t)> request_buffer_delegate, bool cacheresult);
+	static HiresTexture* Load(const HiresTextureCacheItem& item,
+		std::function<u8*(size_t)> request_buffer_delegate, bool cacheresult,
+		bool material_maps, bool build_material_maps);
 	static void Prefetch();
+	static void StartPrefetch();
+	static void StopPrefetch();
+	static std::string GetUsageFilename();
+	static void LoadUsage();
+	static void SaveUsage();
 	HiresTexture();
-	static std::string GetTextureDirectory(const std::string& game_id);
+	static std::string GetTexturePackPath(const std::string& game_id);
 };
\ No newline at end of file
@@ -5,6 +5,8 @@
 #include <cstddef>
 
 #include "Common/CommonTypes.h"
+#include "Common/CPUDetect.h"
+#include "Common/Intrinsics.h"
 #include "Common/Logging/Log.h"
 #include "VideoCommon/IndexGenerator.h"
 #include "VideoCommon/OpcodeDecoding.h"
@@ -17,8 +19,132 @@ u32 IndexGenerator::base_index;
 
 static void(*primitive_table[8])(u32);
 
+// Long runs of a primitive are written in blocks of 24 indices, the same pattern
+// every time, moved by a fixed amount per block. The scalar loops below write
+// what is left over.
+static const u32 BLOCK_SIZE = 24;
+struct IndexPattern
+{
+	// Vertices a block moves the pattern by
+	u32 vertices;
+	// Indices of two consecutive blocks, relative to the first vertex of the first
+	u16 start[2 * BLOCK_SIZE];
+	// How much each index of a block grows from one block to the next
+	u16 step[BLOCK_SIZE];
+};
+
+static IndexPattern s_strip_pattern;
+static IndexPattern s_fan_pattern;
+static IndexPattern s_quad_pattern;
+static IndexPattern s_list_pattern;
+static IndexPattern s_line_strip_pattern;
+
+static void InitPattern(IndexPattern& pattern, u32 vertices, const u16* start, u16 step, bool fan)
+{
+	pattern.vertices = vertices;
+	for (u32 i = 0; i < BLOCK_SIZE; i++)
+	{
+		// The first vertex of a fan is part of every triangle
+		pattern.step[i] = fan && i % 3 == 0 ? 0 : step;
+		pattern.start[i] = start[i];
+		pattern.start[i + BLOCK_SIZE] = start[i] + pattern.step[i];
+	}
+}
+
+#ifdef _M_X86
+AVX2_TARGET static u16* WriteBlocksAVX2(u16* ptr, const IndexPattern& pattern, u32 first, u32 pairs)
+{
+	const __m256i base = _mm256_set1_epi16((s16)first);
+	__m256i indices0 = _mm256_add_epi16(_mm256_loadu_si256((const __m256i*)pattern.start), base);
+	__m256i indices1 = _mm256_add_epi16(_mm256_loadu_si256((const __m256i*)(pattern.start + 16)), base);
+	__m256i indices2 = _mm256_add_epi16(_mm256_loadu_si256((const __m256i*)(pattern.start + 32)), base);
+	// Two blocks at once, so the indices move by two steps. A ymm register holds 16
+	// indices, the steps repeat every block of 24.
+	const __m128i step0 = _mm_loadu_si128((const __m128i*)pattern.step);
+	const __m128i step1 = _mm_loadu_si128((const __m128i*)(pattern.step + 8));
+	const __m128i step2 = _mm_loadu_si128((const __m128i*)(pattern.step + 16));
+	__m256i steps0 = _mm256_inserti128_si256(_mm256_castsi128_si256(step0), step1, 1);
+	__m256i steps1 = _mm256_inserti128_si256(_mm256_castsi128_si256(step2), step0, 1);
+	__m256i steps2 = _mm256_inserti128_si256(_mm256_castsi128_si256(step1), step2, 1);
+	steps0 = _mm256_add_epi16(steps0, steps0);
+	steps1 = _mm256_add_epi16(steps1, steps1);
+	steps2 = _mm256_add_epi16(steps2, steps2);
+	for (u32 i = 0; i < pairs; i++)
+	{
+		_mm256_storeu_si256((__m256i*)ptr, indices0);
+		_mm256_storeu_si256((__m256i*)(ptr + 16), indices1);
+		_mm256_storeu_si256((__m256i*)(ptr + 32), indices2);
+		indices0 = _mm256_add_epi16(indices0, steps0);
+		indices1 = _mm256_add_epi16(indices1, steps1);
+		indices2 = _mm256_add_epi16(indices2, steps2);
+		ptr += 2 * BLOCK_SIZE;
+	}
+	_mm256_zeroupper();
+	return ptr;
+}
+#endif
+
+// Writes blocks times the pattern for a run starting at vertex first
+static u16* WriteBlocks(u16* ptr, const IndexPattern& pattern, u32 first, u32 blocks)
+{
+#ifdef _M_X86
+	if (blocks == 0)
+		return ptr;
+	u32 done = 0;
+	if (cpu_info.bAVX2 && blocks >= 2)
+	{
+		done = blocks & ~1u;
+		ptr = WriteBlocksAVX2(ptr, pattern, first, done / 2);
+	}
+	// Continues after the blocks already written. Not from a new first vertex, the
+	// first index of a fan stays the same.
+	const __m128i step0 = _mm_loadu_si128((const __m128i*)pattern.step);
+	const __m128i step1 = _mm_loadu_si128((const __m128i*)(pattern.step + 8));
+	const __m128i step2 = _mm_loadu_si128((const __m128i*)(pattern.step + 16));
+	const __m128i base = _mm_set1_epi16((s16)first);
+	const __m128i steps_done = _mm_set1_epi16((s16)done);
+	__m128i indices0 = _mm_add_epi16(_mm_loadu_si128((const __m128i*)pattern.start), base);
+	__m128i indices1 = _mm_add_epi16(_mm_loadu_si128((const __m128i*)(pattern.start + 8)), base);
+	__m128i indices2 = _mm_add_epi16(_mm_loadu_si128((const __m128i*)(pattern.start + 16)), base);
+	indices0 = _mm_add_epi16(indices0, _mm_mullo_epi16(step0, steps_done));
+	indices1 = _mm_add_epi16(indices1, _mm_mullo_epi16(step1, steps_done));
+	indices2 = _mm_add_epi16(indices2, _mm_mullo_epi16(step2, steps_done));
+	for (u32 i = done; i < blocks; i++)
+	{
+		_mm_storeu_si128((__m128i*)ptr, indices0);
+		_mm_storeu_si128((__m128i*)(ptr + 8), indices1);
+		_mm_storeu_si128((__m128i*)(ptr + 16), indices2);
+		indices0 = _mm_add_epi16(indices0, step0);
+		indices1 = _mm_add_epi16(indices1, step1);
+		indices2 = _mm_add_epi16(indices2, step2);
+		ptr += BLOCK_SIZE;
+	}
+#else
+	for (u32 i = 0; i < blocks; i++)
+	{
+		for (u32 j = 0; j < BLOCK_SIZE; j++)
+			*ptr++ = first + pattern.start[j] + i * pattern.step[j];
+	}
+#endif
+	return ptr;
+}
+
 void IndexGenerator::Init()
 {
+	// Triangle k of a strip is k, k + 1, k + 2, every other one wound the other way
+	static const u16 strip[BLOCK_SIZE] = { 0, 1, 2, 1, 3, 2, 2, 3, 4, 3, 5, 4, 4, 5, 6, 5, 7, 6, 6, 7, 8, 7, 9, 8 };
+	static const u16 fan[BLOCK_SIZE] = { 0, 1, 2, 0, 2, 3, 0, 3, 4, 0, 4, 5, 0, 5, 6, 0, 6, 7, 0, 7, 8, 0, 8, 9 };
+	static const u16 quads[BLOCK_SIZE] = { 0, 1, 2, 0, 2, 3, 4, 5, 6, 4, 6, 7, 8, 9, 10, 8, 10, 11, 12, 13, 14, 12, 14, 15 };
+	static const u16 line_strip[BLOCK_SIZE] = { 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12 };
+	u16 list[BLOCK_SIZE];
+	for (u32 i = 0; i < BLOCK_SIZE; i++)
+		list[i] = i;
+	InitPattern(s_strip_pattern, 8, strip, 8, false);
+	InitPattern(s_fan_pattern, 8, fan, 8, true);
+	InitPattern(s_quad_pattern, 16, quads, 16, false);
+	InitPattern(s_list_pattern, BLOCK_SIZE, list, BLOCK_SIZE, false);
+	InitPattern(s_line_strip_pattern, 12, line_strip, 12, false);
+
 	primitive_table[GX_DRAW_QUADS] = IndexGenerator::AddQuads;
 #if defined(_DEBUG) || defined(DEBUGFAST)
 	primitive_table[GX_DRAW_QUADS_2] = IndexGenerator::AddQuads_nonstandard;
@@ -57,9 +183,10 @@ __forceinline u16* IndexGenerator::WriteTriangle(u16* ptr, u32 index1, u32 index
 
 void IndexGenerator::AddList(u32 const numVerts)
 {
-	u32 i = base_index + 2;
+	const u32 blocks = numVerts / BLOCK_SIZE;
+	u16* ptr = WriteBlocks(index_buffer_current, s_list_pattern, base_index, blocks);
+	u32 i = base_index + blocks * BLOCK_SIZE + 2;
 	u32 top = (base_index + numVerts);
-	u16* ptr = index_buffer_current;
 	while (i < top)
 	{
 		ptr = WriteTriangle(ptr, i - 2, i - 1, i);
@@ -70,9 +197,11 @@ void IndexGenerator::AddList(u32 const numVerts)
 
 void IndexGenerator::AddStrip(u32 const numVerts)
 {
-	u16* ptr = index_buffer_current;
+	// A block is 8 triangles, an even number so the winding starts over
+	const u32 blocks = numVerts > 2 ? (numVerts - 2) / 8 : 0;
+	u16* ptr = WriteBlocks(index_buffer_current, s_strip_pattern, base_index, blocks);
 	u32 top = (base_index + numVerts);
-	u32 a = base_index;
+	u32 a = base_index + blocks * 8;
 	u32 i = a + 2;
 	u32 wind = 1;
 	while (i < top)
@@ -112,9 +241,10 @@ void IndexGenerator::AddStrip(u32 const numVerts)
 
 void IndexGenerator::AddFan(u32 numVerts)
 {
-	u32 i = base_index + 2;
+	const u32 blocks = numVerts > 2 ? (numVerts - 2) / 8 : 0;
+	u16* ptr = WriteBlocks(index_buffer_current, s_fan_pattern, base_index, blocks);
+	u32 i = base_index + blocks * 8 + 2;
 	u32 top = (base_index + numVerts);
-	u16* ptr = index_buffer_current;
 
 	while (i < top)
 	{
@@ -143,9 +273,10 @@ void IndexGenerator::AddFan(u32 numVerts)
  */
 void IndexGenerator::AddQuads(u32 numVerts)
 {
-	u32 i = base_index + 3;
+	const u32 blocks = numVerts / 16;
+	u16* ptr = WriteBlocks(index_buffer_current, s_quad_pattern, base_index, blocks);
+	u32 i = base_index + blocks * 16 + 3;
 	u32 top = (base_index + numVerts);
-	u16* ptr = index_buffer_current;
 	while (i < top)
 	{
 		ptr = WriteTriangle(ptr, i - 3, i - 2, i - 1);
@@ -170,9 +301,11 @@ void IndexGenerator::AddQuads_nonstandard(u32 numVerts)
 // Lines
 void IndexGenerator::AddLineList(u32 numVerts)
 {
-	u32 i = base_index + 1;
+	// Same indices as a triangle list
+	const u32 blocks = numVerts / BLOCK_SIZE;
+	u16* ptr = WriteBlocks(index_buffer_current, s_list_pattern, base_index, blocks);
+	u32 i = base_index + blocks * BLOCK_SIZE + 1;
 	u32 top = (base_index + numVerts);
-	u16* ptr = index_buffer_current;
 	while (i < top)
 	{
 		*ptr++ = i - 1;
@@ -186,9 +319,10 @@ void IndexGenerator::AddLineList(u32 numVerts)
 // so converting them to lists
 void IndexGenerator::AddLineStrip(u32 numVerts)
 {
-	u32 i = base_index + 1;
+	const u32 blocks = numVerts > 1 ? (numVerts - 1) / 12 : 0;
+	u16* ptr = WriteBlocks(index_buffer_current, s_line_strip_pattern, base_index, blocks);
+	u32 i = base_index + blocks * 12 + 1;
 	u32 top = (base_index + numVerts);
-	u16* ptr = index_buffer_current;
 	while (i < top)
 	{
 		*ptr++ = i - 1;
@@ -201,9 +335,10 @@ void IndexGenerator::AddLineStrip(u32 numVerts)
 // Points
 void IndexGenerator::AddPoints(u32 numVerts)
 {
-	u32 i = base_index;
+	const u32 blocks = numVerts / BLOCK_SIZE;
+	u16 *ptr = WriteBlocks(index_buffer_current, s_list_pattern, base_index, blocks);
+	u32 i = base_index + blocks * BLOCK_SIZE;
 	u32 top = (base_index + numVerts);
-	u16 *ptr = index_buffer_current;
 	while (i < top)
 	{
 		*ptr++ = i;
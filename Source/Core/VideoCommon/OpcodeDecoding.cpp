@@ -21,12 +21,16 @@
 #include "VideoCommon/CommandProcessor.h"
 #include "VideoCommon/CPMemory.h"
 #include "VideoCommon/DataReader.h"
+#include "VideoCommon/DLCache.h"
 #include "VideoCommon/Fifo.h"
 #include "VideoCommon/OpcodeDecoding.h"
+#include "VideoCommon/StageTiming.h"
 #include "VideoCommon/Statistics.h"
+#include "VideoCommon/TexturePrefetch.h"
 #include "VideoCommon/VertexLoaderManager.h"
 #include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/VideoCommon.h"
+#include "VideoCommon/VideoConfig.h"
 #include "VideoCommon/XFMemory.h"
 
 bool g_bRecordFifoData = false;
@@ -45,7 +49,7 @@ __forceinline u32 InterpretDisplayList(u32 address, u32 size)
 {
 	u8* startAddress;
 
-	if (Fifo::UseDeterministicGPUThread())
+	if (Fifo::UsePreprocessedFifo())
 		startAddress = static_cast<u8*>(Fifo::PopFifoAuxBuffer(size));
 	else
 		startAddress = static_cast<u8*>(Memory::GetPointer(address));
@@ -62,7 +66,11 @@ __forceinline u32 InterpretDisplayList(u32 address, u32 size)
 
 		// temporarily swap dl and non-dl (small "hack" for the stats)
 		Statistics::SwapDL();
-		OpcodeDecoder::Run<false, false>(g_VideoData, &cycles);
+		// The fifo recorder needs the raw commands of the list
+		bool cached = g_ActiveConfig.bDisplayListCache && !g_bRecordFifoData
+			&& !Fifo::UsePreprocessedFifo() && HandleDisplayList(address, size, &cycles);
+		if (!cached)
+			OpcodeDecoder::Run<false, false>(g_VideoData, &cycles);
 		INCSTAT(stats.thisFrame.numDListsCalled);
 		// un-swap
 		Statistics::SwapDL();
@@ -161,6 +169,7 @@ void Init()
 template <bool is_preprocess, bool sizeCheck>
 u8* Run(DataReader& reader, u32* cycles)
 {
+	StageTiming::ScopedStage timing(StageTiming::STAGE_OPCODE_DECODE, !is_preprocess);
 	u32 totalCycles = 0;
 	u8* opcodeStart;
 	while (true)
@@ -313,6 +322,7 @@ u8* Run(DataReader& reader, u32* cycles)
 						{
 							totalCycles += GX_NOP_CYCLES + GX_DRAW_PRIMITIVES_CYCLES * parameters.count;
 							reader.ReadSkip(readsize);
+							TexturePrefetch::Draw();
 						}
 						else
 						{
@@ -0,0 +1,163 @@
+// Copyright 2013 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+
+#include "Common/StringUtil.h"
+#include "VideoCommon/StageTiming.h"
+
+namespace StageTiming
+{
+static const char* const s_stage_names[STAGE_COUNT] = {
+	"opcode_decode",
+	"vertex_conversion",
+	"texture",
+	"shader",
+	"flush",
+};
+
+static std::atomic<bool> s_enabled{ false };
+
+// Video thread state
+static Stage s_current = STAGE_COUNT;
+static u64 s_stage_start;
+static u64 s_frame_start;
+static u32 s_frame_number;
+static std::array<u64, STAGE_COUNT> s_stage_ns;
+
+static std::mutex s_frames_lock;
+static std::vector<Frame> s_frames;
+
+static u64 GetTimeNs()
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(
+		std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+const char* GetStageName(Stage stage)
+{
+	return s_stage_names[stage];
+}
+
+void SetEnabled(bool enabled)
+{
+	if (!enabled)
+	{
+		s_enabled.store(false);
+		return;
+	}
+	s_current = STAGE_COUNT;
+	s_frame_start = GetTimeNs();
+	s_frame_number = 0;
+	s_stage_ns.fill(0);
+	{
+		std::lock_guard<std::mutex> lk(s_frames_lock);
+		s_frames.clear();
+	}
+	s_enabled.store(true);
+}
+
+bool IsEnabled()
+{
+	return s_enabled.load(std::memory_order_relaxed);
+}
+
+Stage Enter(Stage stage)
+{
+	const u64 now = GetTimeNs();
+	const Stage parent = s_current;
+	if (parent != STAGE_COUNT)
+		s_stage_ns[parent] += now - s_stage_start;
+	s_current = stage;
+	s_stage_start = now;
+	return parent;
+}
+
+void Leave(Stage parent)
+{
+	const u64 now = GetTimeNs();
+	// Nothing is current if timing was enabled again within the stage
+	if (s_current != STAGE_COUNT)
+		s_stage_ns[s_current] += now - s_stage_start;
+	s_current = parent;
+	s_stage_start = now;
+}
+
+void EndFrame()
+{
+	if (!IsEnabled())
+		return;
+	const u64 now = GetTimeNs();
+	// A swap within a stage splits it between the frames
+	if (s_current != STAGE_COUNT)
+	{
+		s_stage_ns[s_current] += now - s_stage_start;
+		s_stage_start = now;
+	}
+	Frame frame;
+	frame.number = s_frame_number++;
+	frame.total_ns = now - s_frame_start;
+	frame.stage_ns = s_stage_ns;
+	s_frame_start = now;
+	s_stage_ns.fill(0);
+
+	std::lock_guard<std::mutex> lk(s_frames_lock);
+	s_frames.push_back(frame);
+}
+
+std::vector<Frame> TakeFrames()
+{
+	std::lock_guard<std::mutex> lk(s_frames_lock);
+	std::vector<Frame> frames;
+	frames.swap(s_frames);
+	return frames;
+}
+
+static double ToMs(u64 ns)
+{
+	return ns / 1000000.0;
+}
+
+static u64 GetOtherNs(const Frame& frame)
+{
+	u64 stages = 0;
+	for (u64 ns : frame.stage_ns)
+		stages += ns;
+	return frame.total_ns > stages ? frame.total_ns - stages : 0;
+}
+
+std::string FramesToCSV(const std::vector<Frame>& frames)
+{
+	std::string result = "frame,total_ms";
+	for (const char* name : s_stage_names)
+		result += StringFromFormat(",%s_ms", name);
+	result += ",other_ms\n";
+	for (const Frame& frame : frames)
+	{
+		result += StringFromFormat("%u,%.3f", frame.number, ToMs(frame.total_ns));
+		for (u64 ns : frame.stage_ns)
+			result += StringFromFormat(",%.3f", ToMs(ns));
+		result += StringFromFormat(",%.3f\n", ToMs(GetOtherNs(frame)));
+	}
+	return result;
+}
+
+std::string FramesToJSON(const std::vector<Frame>& frames)
+{
+	std::string result = "[\n";
+	for (size_t i = 0; i < frames.size(); ++i)
+	{
+		const Frame& frame = frames[i];
+		result += StringFromFormat("  {\"frame\": %u, \"total_ms\": %.3f", frame.number, ToMs(frame.total_ns));
+		for (u32 stage = 0; stage < STAGE_COUNT; ++stage)
+			result += StringFromFormat(", \"%s_ms\": %.3f", s_stage_names[stage], ToMs(frame.stage_ns[stage]));
+		result += StringFromFormat(", \"other_ms\": %.3f}%s\n", ToMs(GetOtherNs(frame)),
+			i + 1 < frames.size() ? "," : "");
+	}
+	result += "]\n";
+	return result;
+}
+}
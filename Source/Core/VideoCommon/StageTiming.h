@@ -0,0 +1,78 @@
+// Copyright 2013 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+// Per frame timings of the stages of the video thread, for measuring VideoCommon changes
+// on FIFO logs. Time spent in a stage nested in another one, like the texture loads of a
+// flush, only counts for the inner stage, so the stages of a frame add up to the time the
+// thread spent in any of them. Only the video thread is timed.
+
+#pragma once
+
+#include <array>
+#include <string>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+namespace StageTiming
+{
+enum Stage : u32
+{
+	STAGE_OPCODE_DECODE,
+	STAGE_VERTEX_CONVERSION,
+	STAGE_TEXTURE,
+	STAGE_SHADER,
+	STAGE_FLUSH,
+	STAGE_COUNT
+};
+
+struct Frame
+{
+	u32 number;
+	// Wall time since the previous frame, the stages and whatever else the thread did
+	u64 total_ns;
+	std::array<u64, STAGE_COUNT> stage_ns;
+};
+
+const char* GetStageName(Stage stage);
+
+// Enabling starts the first frame and drops the frames recorded so far, disabling keeps
+// them for TakeFrames.
+// Only change it while the video thread isn't running.
+void SetEnabled(bool enabled);
+bool IsEnabled();
+
+Stage Enter(Stage stage);
+void Leave(Stage parent);
+
+class ScopedStage
+{
+public:
+	explicit ScopedStage(Stage stage, bool active = true) : m_active(active && IsEnabled())
+	{
+		if (m_active)
+			m_parent = Enter(stage);
+	}
+	~ScopedStage()
+	{
+		if (m_active)
+			Leave(m_parent);
+	}
+	ScopedStage(const ScopedStage&) = delete;
+	ScopedStage& operator=(const ScopedStage&) = delete;
+
+private:
+	bool m_active;
+	Stage m_parent = STAGE_COUNT;
+};
+
+// Called by the renderer at each swap
+void EndFrame();
+// Returns the frames recorded since the last call, can be called from any thread
+std::vector<Frame> TakeFrames();
+
+// One line or object per frame, times in milliseconds
+std::string FramesToCSV(const std::vector<Frame>& frames);
+std::string FramesToJSON(const std::vector<Frame>& frames);
+}
@@ -11,6 +11,7 @@
 #include "Common/FileUtil.h"
 #include "Common/MemoryUtil.h"
 #include "Common/StringUtil.h"
+#include "Common/ThreadPool.h"
 
 #include "Core/ConfigManager.h"
 #include "Core/FifoPlayer/FifoPlayer.h"
@@ -21,9 +22,11 @@
 #include "VideoCommon/FramebufferManagerBase.h"
 #include "VideoCommon/HiresTextures.h"
 #include "VideoCommon/RenderBase.h"
+#include "VideoCommon/StageTiming.h"
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/SamplerCommon.h"
 #include "VideoCommon/TextureCacheBase.h"
+#include "VideoCommon/TexturePrefetch.h"
 #include "VideoCommon/TextureScalerCommon.h"
 #include "VideoCommon/PostProcessing.h"
 #include "VideoCommon/TextureUtil.h"
@@ -44,14 +47,14 @@ void TextureCacheBase::CheckTempSize(size_t required_size)
 
 	temp_size = required_size;
 	Common::FreeAlignedMemory(temp);
-	temp = static_cast<u8*>(Common::AllocateAlignedMemory(temp_size, 16));
+	temp = static_cast<u8*>(Common::AllocateAlignedMemory(temp_size, 32));
 }
 
 TextureCacheBase::TextureCacheBase()
 {
 	SetBackupConfig(g_ActiveConfig);
 	temp_size = 2048 * 2048 * 4;
-	temp = static_cast<u8*>(Common::AllocateAlignedMemory(temp_size, 16));
+	temp = static_cast<u8*>(Common::AllocateAlignedMemory(temp_size, 32));
 
 	TexDecoder_SetTexFmtOverlayOptions(backup_config.texfmt_overlay, backup_config.texfmt_overlay_center);
 
@@ -66,18 +69,21 @@ TextureCacheBase::TextureCacheBase()
 void TextureCacheBase::Invalidate()
 {
 	UnbindTextures();
-	auto iter = textures_by_address.begin();
-	auto end = textures_by_address.end();
-	while (iter != end)
-	{
-		iter = InvalidateTexture(iter);
-	}
-	textures_by_address.clear();
-	textures_by_hash.clear();
+	textures_by_address.ForEach([this](u32 handle) {
+		InvalidateTexture(textures_by_address.Get(handle));
+	});
+	textures_by_address.Clear();
+	textures_by_hash.Clear();
+	// Jobs still running keep their own reference, their results are simply dropped
+	scaled_textures.clear();
+	watched_hashes.clear();
+	TexturePrefetch::Clear();
 }
 
 TextureCacheBase::~TextureCacheBase()
 {
+	// Every backend destroys its texture cache before the emulated memory goes away
+	TexturePrefetch::Shutdown();
 	HiresTexture::Shutdown();
 	UnbindTextures();
 	Invalidate();
@@ -153,40 +159,50 @@ void TextureCacheBase::Cleanup(s32 _frameCount)
 		// if we are using less than the memory limit increase kill threshold
 		texture_kill_threshold *= TEXTURE_KILL_MULTIPLIER;
 	}
-	auto iter = textures_by_address.begin();
-	auto tcend = textures_by_address.end();
-	while (iter != tcend)
-	{
-		if (iter->second->frameCount == FRAMECOUNT_INVALID)
+	textures_by_address.ForEach([&](u32 handle) {
+		TCacheEntryBase* entry = textures_by_address.Get(handle);
+		if (entry->frameCount == FRAMECOUNT_INVALID)
 		{
-			iter->second->frameCount = _frameCount;
+			entry->frameCount = _frameCount;
 		}
-		if (_frameCount > texture_kill_threshold + iter->second->frameCount)
+		if (_frameCount > texture_kill_threshold + entry->frameCount)
 		{
-			if (iter->second->IsEfbCopy())
+			if (entry->IsEfbCopy())
 			{
 				// Only remove EFB copies when they wouldn't be used anymore(changed hash), because EFB copies living on the
 				// host GPU are unrecoverable. Perform this check only every TEXTURE_KILL_THRESHOLD for performance reasons
-				if ((_frameCount - iter->second->frameCount) % TEXTURE_KILL_THRESHOLD == 1 &&
-					iter->second->hash != iter->second->CalculateHash())
+				if ((_frameCount - entry->frameCount) % TEXTURE_KILL_THRESHOLD == 1 &&
+					entry->hash != entry->CalculateHash())
 				{
-					iter = InvalidateTexture(iter);
-				}
-				else
-				{
-					++iter;
+					InvalidateTexture(entry);
 				}
 			}
 			else
 			{
-				iter = InvalidateTexture(iter);
+				InvalidateTexture(entry);
 			}
 		}
+	});
+	for (auto iter4 = watched_hashes.begin(); iter4 != watched_hashes.end();)
+	{
+		if (_frameCount > texture_kill_threshold + iter4->second.frameCount)
+			iter4 = watched_hashes.erase(iter4);
 		else
+			++iter4;
+	}
+	auto iter3 = scaled_textures.begin();
+	while (iter3 != scaled_textures.end())
+	{
+		if (iter3->second->ready.load() && _frameCount > texture_kill_threshold + iter3->second->frameCount)
 		{
-			++iter;
+			iter3 = scaled_textures.erase(iter3);
+		}
+		else
+		{
+			++iter3;
 		}
 	}
+	TexturePrefetch::Cleanup();
 	TexPool::iterator iter2 = texture_pool.begin();
 	TexPool::iterator tcend2 = texture_pool.end();
 	while (iter2 != tcend2)
@@ -208,17 +224,6 @@ void TextureCacheBase::Cleanup(s32 _frameCount)
 	}
 }
 
-bool TextureCacheBase::TCacheEntryBase::OverlapsMemoryRange(u32 range_address, u32 range_size) const
-{
-	if (addr + size_in_bytes <= range_address)
-		return false;
-
-	if (addr >= range_address + range_size)
-		return false;
-
-	return true;
-}
-
 TextureCacheBase::TCacheEntryBase* TextureCacheBase::ApplyPaletteToEntry(TCacheEntryBase* entry, u32 tlutaddr, u32 tlutfmt, u32 palette_size)
 {
 	TCacheEntryConfig newconfig;
@@ -237,12 +242,12 @@ TextureCacheBase::TCacheEntryBase* TextureCacheBase::ApplyPaletteToEntry(TCacheE
 		decoded_entry->frameCount = FRAMECOUNT_INVALID;
 		decoded_entry->is_efb_copy = false;
 		g_texture_cache->LoadLut(tlutfmt, &texMem[tlutaddr], palette_size);
-		auto iter = textures_by_address.emplace(entry->addr, decoded_entry);
+		InsertTexture(decoded_entry);
 		if (g_texture_cache->Palettize(decoded_entry, entry))
 		{
 			return decoded_entry;
 		}
-		InvalidateTexture(iter);
+		InvalidateTexture(decoded_entry);
 	}
 	return nullptr;
 }
@@ -287,15 +292,15 @@ void TextureCacheBase::ScaleTextureCacheEntryTo(TextureCacheBase::TCacheEntryBas
 		newentry->CopyRectangleFromTexture(*entry, srcrect, dstrect);
 
 		// Keep track of the pointer for textures_by_hash
-		if ((*entry)->textures_by_hash_iter != textures_by_hash.end())
+		if ((*entry)->textures_by_hash_handle != TexHashCache::NONE)
 		{
-			newentry->textures_by_hash_iter = textures_by_hash.emplace((*entry)->hash, newentry);
+			newentry->textures_by_hash_handle = textures_by_hash.Insert((*entry)->hash, newentry);
 		}
 
-		InvalidateTexture(GetTexCacheIter(*entry));
+		InvalidateTexture(*entry);
 
 		*entry = newentry;
-		textures_by_address.emplace((*entry)->addr, *entry);
+		InsertTexture(*entry);
 	}
 	else
 	{
@@ -303,6 +308,74 @@ void TextureCacheBase::ScaleTextureCacheEntryTo(TextureCacheBase::TCacheEntryBas
 	}
 }
 
+TextureCacheBase::TCacheEntryBase* TextureCacheBase::ApplyScaledTexture(TCacheEntryBase* entry)
+{
+	if (!entry->scaled_texture || !entry->scaled_texture->ready.load())
+		return entry;
+
+	std::shared_ptr<ScaledTexture> scaled = std::move(entry->scaled_texture);
+	scaled->frameCount = frameCount;
+	TCacheEntryConfig newconfig = entry->config;
+	newconfig.width *= scaled->factor;
+	newconfig.height *= scaled->factor;
+	TCacheEntryBase* newentry = AllocateTexture(newconfig);
+	if (!newentry)
+	{
+		ERROR_LOG(VIDEO, "Scaling failed");
+		return entry;
+	}
+	newentry->SetGeneralParameters(entry->addr, entry->size_in_bytes, entry->format);
+	newentry->SetDimensions(entry->native_width, entry->native_height, entry->native_levels);
+	newentry->SetHiresParams(false, entry->basename, true, false);
+	newentry->SetHashes(entry->hash, entry->base_hash);
+	newentry->frameCount = frameCount;
+	newentry->is_efb_copy = false;
+	LoadScaledTexture(newentry, *scaled);
+
+	// Keep track of the pointer for textures_by_hash
+	if (entry->textures_by_hash_handle != TexHashCache::NONE)
+	{
+		newentry->textures_by_hash_handle = textures_by_hash.Insert(newentry->hash, newentry);
+	}
+	InvalidateTexture(entry);
+	InsertTexture(newentry);
+	// Partial updates applied to the native texture are done again on the scaled one
+	// as AllocateTexture marked it as possibly overlapping
+	return newentry;
+}
+
+void TextureCacheBase::LoadScaledTexture(TCacheEntryBase* entry, const ScaledTexture& scaled)
+{
+	for (u32 level = 0; level < scaled.levels.size(); ++level)
+	{
+		const ScaledTexture::Level& l = scaled.levels[level];
+		entry->Load(reinterpret_cast<const u8*>(l.data.data()), l.width * scaled.factor,
+			l.height * scaled.factor, l.expanded_width * scaled.factor, level);
+	}
+}
+
+void TextureCacheBase::ScaleTextureAsync(std::shared_ptr<ScaledTexture> scaled, int type, bool deposterize)
+{
+	Common::AsyncWorker::ExecuteAsync([scaled, type, deposterize]()
+	{
+		// Each worker keeps its own scaler so the buffers are reused between textures,
+		// the jobs already run concurrently so the scaling itself is not split again
+		thread_local std::unique_ptr<TextureScaler> scaler;
+		if (!scaler)
+		{
+			scaler = std::make_unique<TextureScaler>();
+			scaler->SetMaxThreads(1);
+		}
+		const int factor = scaled->factor;
+		for (ScaledTexture::Level& level : scaled->levels)
+		{
+			const u32* out = scaler->Scale(level.data.data(), level.expanded_width, level.height, type, factor, deposterize);
+			level.data.assign(out, out + level.expanded_width * level.height * factor * factor);
+		}
+		scaled->ready.store(true);
+	});
+}
+
 TextureCacheBase::TCacheEntryBase* TextureCacheBase::DoPartialTextureUpdates(TCacheEntryBase* entry_to_update, u32 tlutaddr, u32 tlutfmt, u32 palette_size)
 {
 	// If the flag may_have_overlapping_textures is cleared, there are no overlapping EFB copies,
@@ -328,14 +401,15 @@ TextureCacheBase::TCacheEntryBase* TextureCacheBase::DoPartialTextureUpdates(TCa
 
 	u32 numBlocksX = (entry_to_update->native_width + block_width - 1) / block_width;
 
-	auto iter = FindOverlappingTextures(entry_to_update->addr, entry_to_update->size_in_bytes);
-	while (iter.first != iter.second)
+	textures_by_address.FindOverlapping(entry_to_update->addr, entry_to_update->size_in_bytes, &overlapping_textures);
+	for (TCacheEntryBase* entry : overlapping_textures)
 	{
-		TCacheEntryBase* entry = iter.first->second;
+		// Skip textures invalidated by an earlier partial update
+		if (entry->textures_by_address_handle == TexAddrCache::NONE)
+			continue;
 		if (entry != entry_to_update
 			&& entry->IsEfbCopy()
-			&& entry->references.count(entry_to_update) == 0
-			&& entry->OverlapsMemoryRange(entry_to_update->addr, entry_to_update->size_in_bytes)
+			&& !entry->HasReference(entry_to_update)
 			&& entry->memory_stride == numBlocksX * block_size)
 		{
 			if (entry->hash == entry->CalculateHash())
@@ -353,7 +427,6 @@ TextureCacheBase::TCacheEntryBase* TextureCacheBase::DoPartialTextureUpdates(TCa
 					}
 					else
 					{
-						++iter.first;
 						continue;
 					}
 				}
@@ -416,7 +489,7 @@ TextureCacheBase::TCacheEntryBase* TextureCacheBase::DoPartialTextureUpdates(TCa
 				{
 					// Remove the temporary converted texture, it won't be used anywhere else
 					// TODO: It would be nice to convert and copy in one step, but this code path isn't common
-					InvalidateTexture(GetTexCacheIter(entry));
+					InvalidateTexture(entry);
 				}
 				else
 				{
@@ -429,11 +502,9 @@ TextureCacheBase::TCacheEntryBase* TextureCacheBase::DoPartialTextureUpdates(TCa
 			else
 			{
 				// If the hash does not match, this EFB copy will not be used for anything, so remove it
-				iter.first = InvalidateTexture(iter.first);
-				continue;
+				InvalidateTexture(entry);
 			}
 		}
-		++iter.first;
 	}
 	return entry_to_update;
 }
@@ -482,6 +553,7 @@ void TextureCacheBase::UnbindTextures()
 
 TextureCacheBase::TCacheEntryBase* TextureCacheBase::Load(const u32 stage)
 {
+	StageTiming::ScopedStage timing(StageTiming::STAGE_TEXTURE);
 	const FourTexUnits &tex = bpmem.tex[stage >> 2];
 	const u32 id = stage & 3;
 	const u32 address = (tex.texImage3[id].image_base/* & 0x1FFFFF*/) << 5;
@@ -556,8 +628,36 @@ TextureCacheBase::TCacheEntryBase* TextureCacheBase::Load(const u32 stage)
 	if (g_bRecordFifoData && !from_tmem)
 		FifoRecorder::GetInstance().UseMemory(address, texture_size + additional_mips_size, MemoryUpdate::TEXTURE_MAP);
 
-	// TODO: This doesn't hash GB tiles for preloaded RGBA8 textures (instead, it's hashing more data from the low tmem bank than it should)	
-	tex_hash = GetHash64(src_data, texture_size, g_ActiveConfig.iSafeTextureCache_ColorSamples);
+	// With write watching, textures in RAM are only hashed again after their pages were written
+	WatchedHash* watched = nullptr;
+	if (g_ActiveConfig.bTextureWriteWatch && !from_tmem && Memory::IsWriteWatchSupported())
+	{
+		watched = &watched_hashes[(u64)address << 32 | texture_size];
+		watched->frameCount = frameCount;
+	}
+	// Textures the predictive FIFO saw coming may be hashed and decoded already
+	std::shared_ptr<TexturePrefetch::Texture> prefetched;
+	if (watched)
+		prefetched = TexturePrefetch::Take(address, texture_size);
+	if (watched && !Memory::WrittenSince(address, texture_size, watched->stamp))
+	{
+		tex_hash = watched->hash;
+	}
+	else if (prefetched)
+	{
+		watched->stamp = prefetched->stamp;
+		watched->hash = tex_hash = prefetched->hash;
+	}
+	else
+	{
+		// Watched before hashing, so a write that misses the hash still marks the pages
+		if (watched)
+			watched->stamp = Memory::WatchPages(address, texture_size);
+		// TODO: This doesn't hash GB tiles for preloaded RGBA8 textures (instead, it's hashing more data from the low tmem bank than it should)	
+		tex_hash = GetHash64(src_data, texture_size, g_ActiveConfig.iSafeTextureCache_ColorSamples);
+		if (watched)
+			watched->hash = tex_hash;
+	}
 	u32 palette_size = std::min(TexDecoder_GetPaletteSize(texformat), TMEM_SIZE - tlutaddr);
 	if (isPaletteTexture)
 	{
@@ -594,15 +694,14 @@ TextureCacheBase::TCacheEntryBase* TextureCacheBase::Load(const u32 stage)
 	//
 	// For efb copies, the entry created in CopyRenderTargetToTexture always has to be used, or else it was
 	// done in vain.
-	auto iter_range = textures_by_address.equal_range(address);
-	TexAddrCache::iterator iter = iter_range.first;
-	TexAddrCache::iterator oldest_entry = iter;
+	TCacheEntryBase* oldest_entry = nullptr;
 	s32 temp_frameCount = 0x7fffffff;
-	TexAddrCache::iterator unconverted_copy = textures_by_address.end();
+	TCacheEntryBase* unconverted_copy = nullptr;
 
-	while (iter != iter_range.second)
+	for (u32 handle = textures_by_address.Find(address); handle != TexAddrCache::NONE;)
 	{
-		TCacheEntryBase* entry = iter->second;
+		TCacheEntryBase* entry = textures_by_address.Get(handle);
+		handle = textures_by_address.Next(handle);
 		// Do not load strided EFB copies, they are not meant to be used directly
 		if (entry->IsEfbCopy() && entry->native_width >= nativeW && entry->native_height >= nativeH &&
 			entry->memory_stride == entry->BytesPerRow())
@@ -622,7 +721,7 @@ TextureCacheBase::TCacheEntryBase* TextureCacheBase::Load(const u32 stage)
 				// perform the conversion later. Currently, we only convert EFB copies to
 				// palette textures; we could do other conversions if it proved to be
 				// beneficial.
-				unconverted_copy = iter;
+				unconverted_copy = entry;
 			}
 			else
 			{
@@ -630,7 +729,7 @@ TextureCacheBase::TCacheEntryBase* TextureCacheBase::Load(const u32 stage)
 				// never be useful again. It's theoretically possible for a game to do
 				// something weird where the copy could become useful in the future, but in
 				// practice it doesn't happen.
-				iter = InvalidateTexture(iter);
+				InvalidateTexture(entry);
 				continue;
 			}
 		}
@@ -640,7 +739,7 @@ TextureCacheBase::TCacheEntryBase* TextureCacheBase::Load(const u32 stage)
 			if (entry->hash == (full_hash) && entry->format == full_format && entry->native_levels >= tex_levels &&
 				entry->native_width == nativeW && entry->native_height == nativeH)
 			{
-				entry = DoPartialTextureUpdates(iter->second, tlutaddr, tlutfmt, palette_size);
+				entry = DoPartialTextureUpdates(ApplyScaledTexture(entry), tlutaddr, tlutfmt, palette_size);
 				return ReturnEntry(stage, entry);
 			}
 		}
@@ -653,16 +752,15 @@ TextureCacheBase::TCacheEntryBase* TextureCacheBase::Load(const u32 stage)
 			!entry->IsEfbCopy() && !(isPaletteTexture && entry->base_hash == tex_hash))
 		{
 			temp_frameCount = entry->frameCount;
-			oldest_entry = iter;
+			oldest_entry = entry;
 		}
-		++iter;
 	}
 	std::string basename;
-	if (unconverted_copy != textures_by_address.end())
+	if (unconverted_copy)
 	{
 		g_texture_cache->LoadLut(tlutfmt, &texMem[tlutaddr], palette_size);
 		// Perform palette decoding.
-		TCacheEntryBase* decoded_entry = ApplyPaletteToEntry(unconverted_copy->second, tlutaddr, tlutfmt, palette_size);
+		TCacheEntryBase* decoded_entry = ApplyPaletteToEntry(unconverted_copy, tlutaddr, tlutfmt, palette_size);
 
 		if (decoded_entry)
 		{
@@ -677,19 +775,17 @@ TextureCacheBase::TCacheEntryBase* TextureCacheBase::Load(const u32 stage)
 	if (g_ActiveConfig.iSafeTextureCache_ColorSamples == 0 ||
 		std::max(texture_size, palette_size) <= (u32)g_ActiveConfig.iSafeTextureCache_ColorSamples * 8)
 	{
-		auto hash_range = textures_by_hash.equal_range(full_hash);
-		TexHashCache::iterator hash_iter = hash_range.first;
-		while (hash_iter != hash_range.second)
+		for (u32 handle = textures_by_hash.Find(full_hash); handle != TexHashCache::NONE;
+			handle = textures_by_hash.Next(handle))
 		{
-			TCacheEntryBase* entry = hash_iter->second;
+			TCacheEntryBase* entry = textures_by_hash.Get(handle);
 			// All parameters, except the address, need to match here
 			if (entry->format == full_format && entry->native_levels >= tex_levels &&
 				entry->native_width == nativeW && entry->native_height == nativeH)
 			{
-				entry = DoPartialTextureUpdates(hash_iter->second, tlutaddr, tlutfmt, palette_size);
+				entry = DoPartialTextureUpdates(ApplyScaledTexture(entry), tlutaddr, tlutfmt, palette_size);
 				return ReturnEntry(stage, entry);
 			}
-			++hash_iter;
 		}
 	}
 
@@ -743,6 +839,29 @@ TextureCacheBase::TCacheEntryBase* TextureCacheBase::Load(const u32 stage)
 	// how many levels the allocated texture shall have
 	const u32 texLevels = hires_tex ? hires_tex->m_levels : tex_levels;
 	const bool use_scaling = (g_ActiveConfig.iTexScalingType > 0) && !hires_tex && (width < 384) && (height < 384);
+	// With async scaling the native texture is uploaded right away, the scaled
+	// version produced by the workers replaces it on a later frame
+	const bool scale_async = use_scaling && g_ActiveConfig.bTexScalingAsync;
+	std::shared_ptr<ScaledTexture> scaled_tex;
+	bool new_scaled_tex = false;
+	if (scale_async)
+	{
+		// Textures that are not fully hashed are only shared by entries at the same address
+		const bool fully_hashed = g_ActiveConfig.iSafeTextureCache_ColorSamples == 0 ||
+			std::max(texture_size, palette_size) <= (u32)g_ActiveConfig.iSafeTextureCache_ColorSamples * 8;
+		ScaledTextureKey key(full_hash, fully_hashed ? 0 : address, full_format, nativeW, nativeH, texLevels);
+		std::shared_ptr<ScaledTexture>& slot = scaled_textures[key];
+		if (!slot)
+		{
+			slot = std::make_shared<ScaledTexture>();
+			slot->factor = g_ActiveConfig.iTexScalingFactor;
+			new_scaled_tex = true;
+		}
+		scaled_tex = slot;
+		scaled_tex->frameCount = frameCount;
+	}
+	const bool scaled_ready = scaled_tex && scaled_tex->ready.load();
+	const bool scale_now = use_scaling && !scale_async;
 	// We can decode on the GPU if it is a supported format and the flag is enabled.
 	// Currently we don't decode RGBA8 textures from Tmem, as that would require copying from both
 	// banks, and if we're doing an copy we may as well just do the whole thing on the CPU, since
@@ -763,31 +882,35 @@ TextureCacheBase::TCacheEntryBase* TextureCacheBase::Load(const u32 stage)
 	
 	if (use_scaling)
 	{
-		config.width *= g_ActiveConfig.iTexScalingFactor;
-		config.height *= g_ActiveConfig.iTexScalingFactor;
+		if (scale_now || scaled_ready)
+		{
+			config.width *= g_ActiveConfig.iTexScalingFactor;
+			config.height *= g_ActiveConfig.iTexScalingFactor;
+		}
 		config.pcformat = PC_TEX_FMT_RGBA32;
 	}
 	TCacheEntryBase* entry = AllocateTexture(config);
 	GFX_DEBUGGER_PAUSE_AT(NEXT_NEW_TEXTURE, true);
 
-	iter = textures_by_address.emplace(address, entry);
+	entry->SetGeneralParameters(address, texture_size, full_format);
+	InsertTexture(entry);
 	if (g_ActiveConfig.iSafeTextureCache_ColorSamples == 0 ||
 		std::max(texture_size, palette_size) <= (u32)g_ActiveConfig.iSafeTextureCache_ColorSamples * 8)
 	{
-		entry->textures_by_hash_iter = textures_by_hash.emplace(full_hash, entry);
+		entry->textures_by_hash_handle = textures_by_hash.Insert(full_hash, entry);
 	}
 
-	entry->SetGeneralParameters(address, texture_size, full_format);
 	entry->SetDimensions(nativeW, nativeH, tex_levels);
-	entry->SetHiresParams(!!hires_tex, basename, use_scaling, !!hires_tex && hires_tex->emissive_in_color);
+	entry->SetHiresParams(!!hires_tex, basename, scale_now || scaled_ready, !!hires_tex && hires_tex->emissive_in_color);
 	entry->SetHashes(full_hash, tex_hash);
 	entry->is_efb_copy = false;
 
 	// load texture
 	if (hires_tex)
 	{
-		entry->Load(TextureCacheBase::temp, width, height, expandedWidth, 0);
-		u8 *Bufferptr = TextureCacheBase::temp;
+		// Textures from a pack are uploaded straight from the mapped file
+		const u8* Bufferptr = hires_tex->m_mapped_data ? hires_tex->m_mapped_data : TextureCacheBase::temp;
+		entry->Load(Bufferptr, width, height, expandedWidth, 0);
 		Bufferptr += TextureUtil::GetTextureSizeInBytes(width, height, pcfmt);
 		for (u32 level = 1; level != texLevels; ++level)
 		{
@@ -809,6 +932,15 @@ TextureCacheBase::TCacheEntryBase* TextureCacheBase::Load(const u32 stage)
 			}
 		}
 	}
+	else if (scaled_ready)
+	{
+		LoadScaledTexture(entry, *scaled_tex);
+		if (g_ActiveConfig.bDumpTextures)
+		{
+			for (u32 level = 0; level != texLevels; ++level)
+				DumpTexture(entry, basename, level);
+		}
+	}
 	else
 	{
 		const u8* ptr_even = NULL;
@@ -819,6 +951,10 @@ TextureCacheBase::TCacheEntryBase* TextureCacheBase::Load(const u32 stage)
 			ptr_odd = &texMem[bpmem.tex[stage / 4].texImage2[stage % 4].tmem_odd * TMEM_LINE_SIZE];
 		}
 
+		const bool predecoded = prefetched && prefetched->IsDecoded(texformat, expandedWidth,
+			expandedHeight, texLevels, PC_TEX_FMT_RGBA32 == config.pcformat,
+			config.pcformat >= PC_TEX_FMT_DXT1);
+
 		if (decode_on_gpu)
 		{
 			u32 row_stride = bytes_per_block * (expandedWidth / bsw);
@@ -833,11 +969,23 @@ TextureCacheBase::TCacheEntryBase* TextureCacheBase::Load(const u32 stage)
 			u32 twidth = width;
 			u32 theight = height;
 			u32 texpandedWidth = expandedWidth;
-			if (texformat == GX_TF_RGBA8 && from_tmem)
+			if (predecoded)
+			{
+				texturedata = prefetched->GetLevel(0);
+			}
+			else if (texformat == GX_TF_RGBA8 && from_tmem)
 			{
 				TexDecoder_DecodeRGBA8FromTmem(reinterpret_cast<u32*>(texturedata),
 					src_data, ptr_odd, expandedWidth, expandedHeight);
 			}
+			else if (g_ActiveConfig.bOMPDecoder)
+			{
+				const TexDecoderLevel level = { texturedata, src_data, expandedWidth, expandedHeight };
+				TexDecoder_DecodeLevels(&level, 1, texformat, tlutaddr,
+					static_cast<TlutFormat>(tlutfmt),
+					PC_TEX_FMT_RGBA32 == config.pcformat,
+					config.pcformat >= PC_TEX_FMT_DXT1);
+			}
 			else
 			{
 				TexDecoder_Decode(texturedata, src_data, expandedWidth,
@@ -846,7 +994,13 @@ TextureCacheBase::TCacheEntryBase* TextureCacheBase::Load(const u32 stage)
 					PC_TEX_FMT_RGBA32 == config.pcformat,
 					config.pcformat >= PC_TEX_FMT_DXT1);
 			}
-			if (use_scaling)
+			if (new_scaled_tex)
+			{
+				const u32* level_data = reinterpret_cast<u32*>(texturedata);
+				scaled_tex->levels.push_back({ twidth, theight, texpandedWidth,
+					std::vector<u32>(level_data, level_data + texpandedWidth * theight) });
+			}
+			if (scale_now)
 			{
 				texturedata = reinterpret_cast<u8*>(m_scaler->Scale((u32*)texturedata, expandedWidth, height));
 				twidth *= g_ActiveConfig.iTexScalingFactor;
@@ -861,6 +1015,36 @@ TextureCacheBase::TCacheEntryBase* TextureCacheBase::Load(const u32 stage)
 		}
 		src_data += texture_size;
 
+		// The parallel decoder gets all the mip levels at once so the small ones are decoded
+		// next to the large ones, they are uploaded one by one below.
+		std::vector<TexDecoderLevel> mip_levels;
+		if (!decode_on_gpu && !predecoded && g_ActiveConfig.bOMPDecoder && texLevels > 1)
+		{
+			const u8* mip_even = ptr_even;
+			const u8* mip_odd = ptr_odd;
+			const u8* mip_data = src_data;
+			std::vector<size_t> offsets;
+			size_t decoded_size = 0;
+			for (u32 level = 1; level != texLevels; ++level)
+			{
+				const u32 expanded_mip_width = Common::AlignUpSizePow2(TextureUtil::CalculateLevelSize(width, level), bsw);
+				const u32 expanded_mip_height = Common::AlignUpSizePow2(TextureUtil::CalculateLevelSize(height, level), bsh);
+				const u8*& mip_src = from_tmem ? ((level % 2) ? mip_odd : mip_even) : mip_data;
+				mip_levels.push_back({ nullptr, mip_src, expanded_mip_width, expanded_mip_height });
+				mip_src += TexDecoder_GetTextureSizeInBytes(expanded_mip_width, expanded_mip_height, texformat);
+				offsets.push_back(decoded_size);
+				// Room for RGBA, the largest decoded format. Aligned for the SIMD decoders.
+				decoded_size += Common::AlignUpSizePow2(expanded_mip_width * expanded_mip_height * 4, 32);
+			}
+			CheckTempSize(decoded_size);
+			for (size_t i = 0; i < mip_levels.size(); ++i)
+				mip_levels[i].dst = TextureCacheBase::temp + offsets[i];
+			TexDecoder_DecodeLevels(mip_levels.data(), (u32)mip_levels.size(), texformat, tlutaddr,
+				static_cast<TlutFormat>(tlutfmt),
+				PC_TEX_FMT_RGBA32 == config.pcformat,
+				config.pcformat >= PC_TEX_FMT_DXT1);
+		}
+
 		for (u32 level = 1; level != texLevels; ++level)
 		{
 			const u32 mip_width = TextureUtil::CalculateLevelSize(width, level);
@@ -886,14 +1070,31 @@ TextureCacheBase::TCacheEntryBase* TextureCacheBase::Load(const u32 stage)
 				u32 twidth = mip_width;
 				u32 theight = mip_height;
 				u32 texpandedWidth = expanded_mip_width;
-				TexDecoder_Decode(texturedata, mip_src_data, expanded_mip_width,
-					expanded_mip_height, texformat, tlutaddr,
-					static_cast<TlutFormat>(tlutfmt),
-					PC_TEX_FMT_RGBA32 == config.pcformat,
-					config.pcformat >= PC_TEX_FMT_DXT1);
-				if (use_scaling)
+				if (predecoded)
 				{
-					texturedata = reinterpret_cast<u8*>(m_scaler->Scale((u32*)texturedata, expandedWidth, height));
+					texturedata = prefetched->GetLevel(level);
+				}
+				else if (!mip_levels.empty())
+				{
+					texturedata = mip_levels[level - 1].dst;
+				}
+				else
+				{
+					TexDecoder_Decode(texturedata, mip_src_data, expanded_mip_width,
+						expanded_mip_height, texformat, tlutaddr,
+						static_cast<TlutFormat>(tlutfmt),
+						PC_TEX_FMT_RGBA32 == config.pcformat,
+						config.pcformat >= PC_TEX_FMT_DXT1);
+				}
+				if (new_scaled_tex)
+				{
+					const u32* level_data = reinterpret_cast<u32*>(texturedata);
+					scaled_tex->levels.push_back({ twidth, theight, texpandedWidth,
+						std::vector<u32>(level_data, level_data + texpandedWidth * theight) });
+				}
+				if (scale_now)
+				{
+					texturedata = reinterpret_cast<u8*>(m_scaler->Scale((u32*)texturedata, expanded_mip_width, mip_height));
 					twidth *= g_ActiveConfig.iTexScalingFactor;
 					theight *= g_ActiveConfig.iTexScalingFactor;
 					texpandedWidth *= g_ActiveConfig.iTexScalingFactor;
@@ -905,11 +1106,17 @@ TextureCacheBase::TCacheEntryBase* TextureCacheBase::Load(const u32 stage)
 			if (g_ActiveConfig.bDumpTextures)
 				DumpTexture(entry, basename, level);
 		}
+		if (scale_async)
+		{
+			if (new_scaled_tex)
+				ScaleTextureAsync(scaled_tex, g_ActiveConfig.iTexScalingType, g_ActiveConfig.bTexDeposterize);
+			entry->scaled_texture = scaled_tex;
+		}
 	}
 
 	INCSTAT(stats.numTexturesCreated);
-	SETSTAT(stats.numTexturesAlive, textures_by_address.size());
-	entry = DoPartialTextureUpdates(iter->second, tlutaddr, tlutfmt, palette_size);
+	SETSTAT(stats.numTexturesAlive, textures_by_address.GetSize());
+	entry = DoPartialTextureUpdates(entry, tlutaddr, tlutfmt, palette_size);
 	return ReturnEntry(stage, entry);
 }
 
@@ -1247,13 +1454,10 @@ void TextureCacheBase::CopyRenderTargetToTexture(u32 dstAddr, u32 dstFormat, u32
 	}
 
 	// remove all texture cache entries at dstAddr
+	for (u32 handle = textures_by_address.Find(dstAddr); handle != TexAddrCache::NONE;
+		handle = textures_by_address.Find(dstAddr))
 	{
-		auto iter_range = textures_by_address.equal_range(dstAddr);
-		TexAddrCache::iterator iter = iter_range.first;
-		while (iter != iter_range.second)
-		{
-			iter = InvalidateTexture(iter);
-		}
+		InvalidateTexture(textures_by_address.Get(handle));
 	}
 
 	// Get the base (in memory) format of this efb copy.
@@ -1313,6 +1517,9 @@ void TextureCacheBase::CopyRenderTargetToTexture(u32 dstAddr, u32 dstFormat, u32
 		}
 	}
 
+	// The copy is written through the device view, which isn't write-protected
+	Memory::MarkWritten(dstAddr, num_blocks_y * dstStride);
+
 	if (g_bRecordFifoData)
 	{
 		// Mark the memory behind this efb copy as dynamicly generated for the Fifo log
@@ -1344,20 +1551,13 @@ void TextureCacheBase::CopyRenderTargetToTexture(u32 dstAddr, u32 dstFormat, u32
 	// TODO: This also invalidates partial overlaps, which we currently don't have a better way
 	//       of dealing with.
 	bool invalidate_textures = dstStride == bytes_per_row || !copy_to_vram;
-	auto iter = FindOverlappingTextures(dstAddr, covered_range);
-	while (iter.first != iter.second)
+	textures_by_address.FindOverlapping(dstAddr, covered_range, &overlapping_textures);
+	for (TCacheEntryBase* entry : overlapping_textures)
 	{
-		TCacheEntryBase* entry = iter.first->second;
-		if (entry->OverlapsMemoryRange(dstAddr, covered_range))
-		{
-			if (invalidate_textures)
-			{
-				iter.first = InvalidateTexture(iter.first);
-				continue;
-			}
+		if (invalidate_textures)
+			InvalidateTexture(entry);
+		else
 			entry->may_have_overlapping_textures = true;
-		}
-		++iter.first;
 	}
 
 	if (copy_to_vram)
@@ -1393,7 +1593,7 @@ void TextureCacheBase::CopyRenderTargetToTexture(u32 dstAddr, u32 dstFormat, u32
 					count++), 0);
 			}
 
-			textures_by_address.emplace(dstAddr, entry);
+			InsertTexture(entry);
 		}
 	}
 }
@@ -1413,20 +1613,23 @@ TextureCacheBase::TCacheEntryBase* TextureCacheBase::AllocateTexture(const TCach
 		entry = CreateTexture(config);
 		INCSTAT(stats.numTexturesCreated);
 	}
-	entry->textures_by_hash_iter = textures_by_hash.end();
+	entry->textures_by_address_handle = TexAddrCache::NONE;
+	entry->textures_by_hash_handle = TexHashCache::NONE;
 	entry->may_have_overlapping_textures = true;
+	entry->scaled_texture.reset();
 	return entry;
 }
 
 void TextureCacheBase::DisposeTexture(TCacheEntryBase* entry)
 {
-	if (entry->textures_by_hash_iter != textures_by_hash.end())
+	if (entry->textures_by_hash_handle != TexHashCache::NONE)
 	{
-		textures_by_hash.erase(entry->textures_by_hash_iter);
-		entry->textures_by_hash_iter = textures_by_hash.end();
+		textures_by_hash.Erase(entry->textures_by_hash_handle);
+		entry->textures_by_hash_handle = TexHashCache::NONE;
 	}
 
 	entry->DestroyAllReferences();
+	entry->scaled_texture.reset();
 
 	entry->frameCount = FRAMECOUNT_INVALID;
 
@@ -1448,47 +1651,19 @@ TextureCacheBase::FindMatchingTextureFromPool(const TCacheEntryConfig& config)
 	return matching_iter != range.second ? matching_iter : texture_pool.end();
 }
 
-TextureCacheBase::TexAddrCache::iterator TextureCacheBase::GetTexCacheIter(TextureCacheBase::TCacheEntryBase* entry)
+void TextureCacheBase::InsertTexture(TCacheEntryBase* entry)
 {
-	auto iter_range = textures_by_address.equal_range(entry->addr);
-	TexAddrCache::iterator iter = iter_range.first;
-
-	while (iter != iter_range.second)
-	{
-		if (iter->second == entry)
-		{
-			return iter;
-		}
-		++iter;
-	}
-	return textures_by_address.end();
+	entry->textures_by_address_handle = textures_by_address.Insert(entry->addr, entry->size_in_bytes, entry);
 }
 
-TextureCacheBase::TexAddrCache::iterator TextureCacheBase::InvalidateTexture(TexAddrCache::iterator iter)
+void TextureCacheBase::InvalidateTexture(TCacheEntryBase* entry)
 {
-	if (iter == textures_by_address.end())
-		return textures_by_address.end();
-
-	TCacheEntryBase* entry = iter->second;
-	DisposeTexture(iter->second);
-	return textures_by_address.erase(iter);
-}
+	if (entry->textures_by_address_handle == TexAddrCache::NONE)
+		return;
 
-std::pair<TextureCacheBase::TexAddrCache::iterator, TextureCacheBase::TexAddrCache::iterator>
-TextureCacheBase::FindOverlappingTextures(u32 addr, u32 size_in_bytes)
-{
-	// We index by the starting address only, so there is no way to query all textures
-	// which end after the given addr. But the GC textures have a limited size, so we
-	// look for all textures which have a start address bigger than addr minus the maximal
-	// texture size. But this yields false-positives which must be checked later on.
-
-	// 1024 x 1024 texel times 8 nibbles per texel
-	constexpr u32 max_texture_size = 1024 * 1024 * 4;
-	u32 lower_addr = addr > max_texture_size ? addr - max_texture_size : 0;
-	auto begin = textures_by_address.lower_bound(lower_addr);
-	auto end = textures_by_address.upper_bound(addr + size_in_bytes);
-
-	return std::make_pair(begin, end);
+	textures_by_address.Erase(entry->textures_by_address_handle);
+	entry->textures_by_address_handle = TexAddrCache::NONE;
+	DisposeTexture(entry);
 }
 
 u32 TextureCacheBase::TCacheEntryBase::BytesPerRow() const
@@ -4,17 +4,20 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
+#include <atomic>
 #include <map>
 #include <memory>
 #include <tuple>
 #include <unordered_map>
-#include <unordered_set>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/Thread.h"
 
 #include "VideoCommon/BPMemory.h"
+#include "VideoCommon/TextureCacheIndex.h"
 #include "VideoCommon/TextureDecoder.h"
 #include "VideoCommon/VideoCommon.h"
 
@@ -110,6 +113,23 @@ public:
 		PC_TexFormat pcformat = PC_TEX_FMT_NONE;
 	};
 
+	// Upscaled version of a texture, produced on the worker threads when
+	// bTexScalingAsync is set. It is shared by all the cache entries with the
+	// same contents, so the same texture is never scaled twice.
+	struct ScaledTexture
+	{
+		struct Level
+		{
+			u32 width, height, expanded_width;
+			// Decoded native texture until ready is set, the scaled one afterwards
+			std::vector<u32> data;
+		};
+		std::vector<Level> levels;
+		u32 factor = 1;
+		std::atomic<bool> ready{ false };
+		s32 frameCount = FRAMECOUNT_INVALID;
+	};
+
 	struct TCacheEntryBase
 	{
 		TCacheEntryConfig config;
@@ -132,16 +152,22 @@ public:
 		u64 hash = {};
 		u64 base_hash = {};
 
-		// Keep an iterator to the entry in textures_by_hash, so it does not need to be searched when removing the cache entry
-		std::multimap<u64, TCacheEntryBase*>::iterator textures_by_hash_iter;
+		// Handles of the entry in textures_by_address and textures_by_hash, so it does not need to be searched
+		// when removing the cache entry. NONE while the entry isn't in there.
+		u32 textures_by_address_handle = FlatMultiMap<u64, TCacheEntryBase*>::NONE;
+		u32 textures_by_hash_handle = FlatMultiMap<u64, TCacheEntryBase*>::NONE;
 
 		// This is used to keep track of both:
 		//   * efb copies used by this partially updated texture
 		//   * partially updated textures which refer to this efb copy
-		std::unordered_set<TCacheEntryBase*> references;
+		// There are only a few of them, a vector is cheaper to search than a set.
+		std::vector<TCacheEntryBase*> references;
 
 		std::string basename;
 
+		// Scaled texture being produced for this entry, it replaces the entry once ready
+		std::shared_ptr<ScaledTexture> scaled_texture;
+
 		void SetGeneralParameters(u32 _addr, u32 _size, u32 _format)
 		{
 			addr = _addr;
@@ -175,14 +201,25 @@ public:
 		void CreateReference(TCacheEntryBase* other_entry)
 		{
 			// References are two-way, so they can easily be destroyed later
-			this->references.emplace(other_entry);
-			other_entry->references.emplace(this);
+			if (HasReference(other_entry))
+				return;
+			this->references.push_back(other_entry);
+			other_entry->references.push_back(this);
+		}
+
+		bool HasReference(const TCacheEntryBase* other_entry) const
+		{
+			return std::find(references.begin(), references.end(), other_entry) != references.end();
 		}
 
 		void DestroyAllReferences()
 		{
 			for (auto& reference : references)
-				reference->references.erase(this);
+			{
+				auto& other_references = reference->references;
+				other_references.erase(std::remove(other_references.begin(), other_references.end(), this),
+					other_references.end());
+			}
 
 			references.clear();
 		}
@@ -210,7 +247,6 @@ public:
 		{}
 		virtual void FromRenderTarget(bool is_depth_copy, const EFBRectangle& srcRect,
 			bool scaleByHalf, u32 cbufid, const float *colmat, u32 width, u32 height) = 0;
-		bool OverlapsMemoryRange(u32 range_address, u32 range_size) const;
 		virtual bool SupportsMaterialMap() const = 0;
 		// Decodes the specified data to the GPU texture specified by entry.
 		// width, height are the size of the image in pixels.
@@ -281,10 +317,21 @@ protected:
 	TextureCacheBase();
 	virtual TCacheEntryBase* CreateTexture(const TCacheEntryConfig& config) = 0;
 private:
-	typedef std::multimap<u32, TCacheEntryBase*> TexAddrCache;
-	typedef std::multimap<u64, TCacheEntryBase*> TexHashCache;
+	typedef TextureAddressMap<TCacheEntryBase*> TexAddrCache;
+	typedef FlatMultiMap<u64, TCacheEntryBase*> TexHashCache;
 	typedef std::unordered_multimap<TCacheEntryConfig, TCacheEntryBase*, TCacheEntryConfig::Hasher> TexPool;
 	typedef std::unordered_map<std::string, TCacheEntryBase*> HiresTexPool;
+	// hash, address (0 if the texture is fully hashed), format, width, height, levels
+	typedef std::tuple<u64, u32, u32, u32, u32, u32> ScaledTextureKey;
+	typedef std::map<ScaledTextureKey, std::shared_ptr<ScaledTexture>> ScaledTextureCache;
+	// Hash of the texture in RAM at address << 32 | size, good until its pages are written
+	struct WatchedHash
+	{
+		u64 hash;
+		u64 stamp;
+		s32 frameCount;
+	};
+	typedef std::unordered_map<u64, WatchedHash> WatchedHashCache;
 
 	void SetBackupConfig(const VideoConfig& config);
 	void ScaleTextureCacheEntryTo(TCacheEntryBase** entry, u32 new_width, u32 new_height);
@@ -292,21 +339,23 @@ private:
 	TCacheEntryBase* DoPartialTextureUpdates(TCacheEntryBase* entry_to_update, u32 tlutaddr, u32 tlutfmt, u32 palette_size);
 	TextureCacheBase::TCacheEntryBase* ApplyPaletteToEntry(TCacheEntryBase* entry, u32 tlutaddr, u32 tlutfmt, u32 palette_size);
 	void DumpTexture(TCacheEntryBase* entry, std::string basename, u32 level);
+	TCacheEntryBase* ApplyScaledTexture(TCacheEntryBase* entry);
+	void LoadScaledTexture(TCacheEntryBase* entry, const ScaledTexture& scaled);
+	static void ScaleTextureAsync(std::shared_ptr<ScaledTexture> scaled, int type, bool deposterize);
 
 	TexPool::iterator FindMatchingTextureFromPool(const TCacheEntryConfig& config);
-	TexAddrCache::iterator GetTexCacheIter(TCacheEntryBase* entry);
-	TexAddrCache::iterator InvalidateTexture(TexAddrCache::iterator t_iter);
+	void InsertTexture(TCacheEntryBase* entry);
+	void InvalidateTexture(TCacheEntryBase* entry);
 	TCacheEntryBase* ReturnEntry(u32 stage, TCacheEntryBase* entry);
 
-	// Return all possible overlapping textures. As addr+size of the textures is not
-	// indexed, this may return false positives.
-	std::pair<TexAddrCache::iterator, TexAddrCache::iterator>
-		FindOverlappingTextures(u32 addr, u32 size_in_bytes);
-
 	TexAddrCache textures_by_address;
 	TexHashCache textures_by_hash;
+	// Result of the last overlap search in textures_by_address
+	std::vector<TCacheEntryBase*> overlapping_textures;
 	TexPool texture_pool;
 	size_t texture_pool_memory_usage = {};
+	ScaledTextureCache scaled_textures;
+	WatchedHashCache watched_hashes;
 	
 	u32 s_last_texture = {};
 
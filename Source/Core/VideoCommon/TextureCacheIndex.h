@@ -0,0 +1,349 @@
+// Copyright 2013 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+// Lookup structures of the texture cache, kept in flat arrays so a lookup
+// touches a few cache lines instead of walking tree nodes.
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+// Multimap from an integer key to values. An open addressing table maps each key
+// to the first and last node of that key, the nodes of a key are linked in
+// insertion order. A handle stays valid until its node is erased, erasing never
+// moves other nodes so it is safe while walking the nodes.
+template <typename Key, typename T>
+class FlatMultiMap
+{
+public:
+	static const u32 NONE = 0xFFFFFFFF;
+
+	u32 Insert(Key key, T value)
+	{
+		if ((m_key_count + 1) * 2 > m_buckets.size())
+			Rehash(std::max<size_t>(m_buckets.size() * 2, 64));
+
+		u32 handle = m_free;
+		if (handle != NONE)
+		{
+			m_free = m_nodes[handle].next;
+		}
+		else
+		{
+			handle = (u32)m_nodes.size();
+			m_nodes.emplace_back();
+		}
+		Node& node = m_nodes[handle];
+		node.key = key;
+		node.value = value;
+		node.next = NONE;
+		node.live = true;
+
+		Bucket& bucket = m_buckets[FindSlot(key)];
+		if (bucket.first == NONE)
+		{
+			bucket.key = key;
+			bucket.first = handle;
+			node.prev = NONE;
+			m_key_count++;
+		}
+		else
+		{
+			node.prev = bucket.last;
+			m_nodes[bucket.last].next = handle;
+		}
+		bucket.last = handle;
+		m_size++;
+		return handle;
+	}
+
+	void Erase(u32 handle)
+	{
+		Node& node = m_nodes[handle];
+		const u32 slot = FindSlot(node.key);
+		Bucket& bucket = m_buckets[slot];
+		if (node.prev != NONE)
+			m_nodes[node.prev].next = node.next;
+		else
+			bucket.first = node.next;
+		if (node.next != NONE)
+			m_nodes[node.next].prev = node.prev;
+		else
+			bucket.last = node.prev;
+		if (bucket.first == NONE)
+			RemoveSlot(slot);
+
+		node.value = T();
+		node.live = false;
+		node.next = m_free;
+		m_free = handle;
+		m_size--;
+	}
+
+	void Clear()
+	{
+		m_nodes.clear();
+		std::fill(m_buckets.begin(), m_buckets.end(), Bucket());
+		m_free = NONE;
+		m_size = 0;
+		m_key_count = 0;
+	}
+
+	// First node of key in insertion order, NONE if there is none
+	u32 Find(Key key) const
+	{
+		if (m_buckets.empty())
+			return NONE;
+		return m_buckets[FindSlot(key)].first;
+	}
+	// Next node with the same key
+	u32 Next(u32 handle) const
+	{
+		return m_nodes[handle].next;
+	}
+	T Get(u32 handle) const
+	{
+		return m_nodes[handle].value;
+	}
+	Key GetKey(u32 handle) const
+	{
+		return m_nodes[handle].key;
+	}
+	size_t GetSize() const
+	{
+		return m_size;
+	}
+
+	// Calls func(handle) for every node. func may erase nodes.
+	template <typename F>
+	void ForEach(F func) const
+	{
+		for (u32 handle = 0; handle < m_nodes.size(); handle++)
+		{
+			if (m_nodes[handle].live)
+				func(handle);
+		}
+	}
+
+private:
+	struct Node
+	{
+		Key key;
+		T value;
+		// Neighbours with the same key, next links the free nodes
+		u32 prev;
+		u32 next;
+		bool live;
+	};
+	struct Bucket
+	{
+		Key key = {};
+		u32 first = NONE;
+		u32 last = NONE;
+	};
+
+	u32 GetHome(Key key) const
+	{
+		// Fibonacci hashing, texture addresses and hashes both spread well with it
+		return (u32)(((u64)key * 0x9E3779B97F4A7C15ULL) >> m_shift);
+	}
+
+	// Slot of key, or the empty slot where it would go
+	u32 FindSlot(Key key) const
+	{
+		const u32 mask = (u32)m_buckets.size() - 1;
+		u32 slot = GetHome(key);
+		while (m_buckets[slot].first != NONE && m_buckets[slot].key != key)
+			slot = (slot + 1) & mask;
+		return slot;
+	}
+
+	// Backward shift deletion, keeps the probe sequences free of holes
+	void RemoveSlot(u32 slot)
+	{
+		const u32 mask = (u32)m_buckets.size() - 1;
+		u32 hole = slot;
+		for (u32 i = (slot + 1) & mask; m_buckets[i].first != NONE; i = (i + 1) & mask)
+		{
+			const u32 home = GetHome(m_buckets[i].key);
+			if (((i - home) & mask) >= ((i - hole) & mask))
+			{
+				m_buckets[hole] = m_buckets[i];
+				hole = i;
+			}
+		}
+		m_buckets[hole] = Bucket();
+		m_key_count--;
+	}
+
+	void Rehash(size_t bucket_count)
+	{
+		std::vector<Bucket> old_buckets(bucket_count);
+		old_buckets.swap(m_buckets);
+		m_shift = 64;
+		for (size_t count = bucket_count; count > 1; count >>= 1)
+			m_shift--;
+		for (const Bucket& bucket : old_buckets)
+		{
+			if (bucket.first != NONE)
+				m_buckets[FindSlot(bucket.key)] = bucket;
+		}
+	}
+
+	std::vector<Node> m_nodes;
+	std::vector<Bucket> m_buckets;
+	u32 m_free = NONE;
+	u32 m_shift = 64;
+	size_t m_size = 0;
+	size_t m_key_count = 0;
+};
+
+template <typename Key, typename T>
+const u32 FlatMultiMap<Key, T>::NONE;
+
+// Textures by their address in emulated memory. On top of the lookup by address,
+// every texture is listed in the 64 KiB pages it covers, so the textures in a range
+// are found by looking at the pages of the range only.
+template <typename T>
+class TextureAddressMap
+{
+public:
+	static const u32 NONE = FlatMultiMap<u32, T>::NONE;
+
+	TextureAddressMap() : m_pages(PAGE_COUNT)
+	{
+	}
+
+	u32 Insert(u32 address, u32 size, T value)
+	{
+		const u32 handle = m_map.Insert(address, value);
+		if (handle >= m_ranges.size())
+			m_ranges.resize(handle + 1);
+		m_ranges[handle] = { size, m_order++ };
+		ForEachPage(address, size, [&](std::vector<u32>& page) { page.push_back(handle); });
+		return handle;
+	}
+
+	void Erase(u32 handle)
+	{
+		ForEachPage(m_map.GetKey(handle), m_ranges[handle].size, [&](std::vector<u32>& page) {
+			auto iter = std::find(page.begin(), page.end(), handle);
+			*iter = page.back();
+			page.pop_back();
+		});
+		m_map.Erase(handle);
+	}
+
+	void Clear()
+	{
+		m_map.Clear();
+		m_ranges.clear();
+		for (std::vector<u32>& page : m_pages)
+			page.clear();
+	}
+
+	u32 Find(u32 address) const
+	{
+		return m_map.Find(address);
+	}
+	u32 Next(u32 handle) const
+	{
+		return m_map.Next(handle);
+	}
+	T Get(u32 handle) const
+	{
+		return m_map.Get(handle);
+	}
+	size_t GetSize() const
+	{
+		return m_map.GetSize();
+	}
+	template <typename F>
+	void ForEach(F func) const
+	{
+		m_map.ForEach(func);
+	}
+
+	// Replaces values with the values whose range overlaps [address, address + size),
+	// ordered by address and then by insertion like a std::multimap
+	void FindOverlapping(u32 address, u32 size, std::vector<T>* values)
+	{
+		m_found.clear();
+		const u64 first = address >> PAGE_SHIFT;
+		const u64 last = ((u64)address + std::max(size, 1u) - 1) >> PAGE_SHIFT;
+		if (last - first + 1 >= PAGE_COUNT)
+		{
+			m_map.ForEach([&](u32 handle) {
+				if (Overlaps(handle, address, size))
+					m_found.push_back(handle);
+			});
+		}
+		else
+		{
+			for (u64 page = first; page <= last; page++)
+			{
+				for (u32 handle : m_pages[page & (PAGE_COUNT - 1)])
+				{
+					// A texture covering several pages of the range is only taken from the first one
+					const u64 texture_first = m_map.GetKey(handle) >> PAGE_SHIFT;
+					if (page == std::max(first, texture_first) && Overlaps(handle, address, size))
+						m_found.push_back(handle);
+				}
+			}
+		}
+
+		std::sort(m_found.begin(), m_found.end(), [this](u32 a, u32 b) {
+			const u32 address_a = m_map.GetKey(a);
+			const u32 address_b = m_map.GetKey(b);
+			return address_a != address_b ? address_a < address_b : m_ranges[a].order < m_ranges[b].order;
+		});
+		values->clear();
+		for (u32 handle : m_found)
+			values->push_back(m_map.Get(handle));
+	}
+
+private:
+	static const u32 PAGE_SHIFT = 16;
+	// Pages further apart share a list, which only costs a few extra checks
+	static const u32 PAGE_COUNT = 8192;
+
+	struct Range
+	{
+		u32 size;
+		u64 order;
+	};
+
+	bool Overlaps(u32 handle, u32 address, u32 size) const
+	{
+		const u64 texture_address = m_map.GetKey(handle);
+		return texture_address + m_ranges[handle].size > address &&
+			texture_address < (u64)address + size;
+	}
+
+	template <typename F>
+	void ForEachPage(u32 address, u32 size, F func)
+	{
+		const u64 first = address >> PAGE_SHIFT;
+		const u64 last = ((u64)address + std::max(size, 1u) - 1) >> PAGE_SHIFT;
+		const u64 count = std::min<u64>(last - first + 1, PAGE_COUNT);
+		for (u64 page = first; page < first + count; page++)
+			func(m_pages[page & (PAGE_COUNT - 1)]);
+	}
+
+	FlatMultiMap<u32, T> m_map;
+	std::vector<Range> m_ranges;
+	std::vector<std::vector<u32>> m_pages;
+	std::vector<u32> m_found;
+	u64 m_order = 0;
+};
+
+template <typename T>
+const u32 TextureAddressMap<T>::NONE;
+template <typename T>
+const u32 TextureAddressMap<T>::PAGE_SHIFT;
+template <typename T>
+const u32 TextureAddressMap<T>::PAGE_COUNT;
@@ -117,6 +117,18 @@ enum PC_TexFormat
 	PC_TEX_FMT_RGBA_FLOAT
 };
 PC_TexFormat TexDecoder_Decode(u8 *dst, const u8 *src, u32 width, u32 height, u32 texformat, u32 tlutaddr, TlutFormat tlutfmt, bool rgbaOnly = false, bool compressed_supported = false);
+
+// One texture, usually a mip level, for TexDecoder_DecodeLevels. Sizes are expanded to whole blocks.
+struct TexDecoderLevel
+{
+	u8 *dst;
+	const u8 *src;
+	u32 width;
+	u32 height;
+};
+// Like TexDecoder_Decode for several textures of the same format. Unless they are small, they are
+// split in bands of block rows that are decoded on the thread pool; the levels are decoded concurrently.
+PC_TexFormat TexDecoder_DecodeLevels(const TexDecoderLevel *levels, u32 count, u32 texformat, u32 tlutaddr, TlutFormat tlutfmt, bool rgbaOnly = false, bool compressed_supported = false);
 PC_TexFormat GetPC_TexFormat(u32 texformat, TlutFormat tlutfmt, bool compressed_supported = false);
 PC_TexFormat TexDecoder_DecodeRGBA8FromTmem(u32* dst, const u8 *src_ar, const u8 *src_gb, u32 width, u32 height);
 PC_TexFormat TexDecoder_DecodeBGRA8FromTmem(u32* dst, const u8 *src_ar, const u8 *src_gb, u32 width, u32 height);
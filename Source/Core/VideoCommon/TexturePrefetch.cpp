@@ -0,0 +1,302 @@
+// Copyright 2013 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+
+#include "Common/Align.h"
+#include "Common/Hash.h"
+#include "Common/MathUtil.h"
+#include "Common/MemoryUtil.h"
+#include "Common/Thread.h"
+#include "Common/ThreadPool.h"
+#include "Core/HW/Memmap.h"
+#include "VideoCommon/BPMemory.h"
+#include "VideoCommon/Fifo.h"
+#include "VideoCommon/HiresTextures.h"
+#include "VideoCommon/SamplerCommon.h"
+#include "VideoCommon/TextureCacheBase.h"
+#include "VideoCommon/TextureDecoder.h"
+#include "VideoCommon/TexturePrefetch.h"
+#include "VideoCommon/TextureUtil.h"
+#include "VideoCommon/VideoConfig.h"
+
+namespace TexturePrefetch
+{
+// Results waiting for Load, and the memory their decoded levels may take
+static const size_t MAX_TEXTURES = 256;
+static const size_t MAX_DECODED_SIZE = 64 * 1024 * 1024;
+// Frames a finished result is kept for a Load that takes it
+static const u32 MAX_AGE = 2;
+static const size_t MAX_ISSUED = 4096;
+
+// Preprocessor state: the texture registers as the draws being preprocessed see them,
+// the registers of both FourTexUnits from BPMEM_TX_SETMODE0 on
+static constexpr u32 TEX_REG_COUNT = 64;
+static FourTexUnits s_tex[2];
+static_assert(sizeof(s_tex) == TEX_REG_COUNT * sizeof(u32), "Unexpected texture register count");
+static u32 s_bp_mask;
+static u32 s_dirty_stages;
+// Stamps of the textures prefetched already, they are only prefetched again after a write
+static std::unordered_map<u64, u64> s_issued;
+
+static std::mutex s_lock;
+static std::unordered_map<u64, std::shared_ptr<Texture>> s_textures;
+static size_t s_decoded_size;
+static std::atomic<int> s_jobs{ 0 };
+
+Texture::~Texture()
+{
+	if (data)
+		Common::FreeAlignedMemory(data);
+}
+
+u8* Texture::GetLevel(u32 level) const
+{
+	return data ? data + offsets[level] : nullptr;
+}
+
+bool Texture::IsDecoded(u32 texformat, u32 expanded_width, u32 expanded_height, u32 tex_levels,
+	bool rgba, bool compressed) const
+{
+	const u32 bsw = TexDecoder_GetBlockWidthInTexels(format);
+	const u32 bsh = TexDecoder_GetBlockHeightInTexels(format);
+	return data && format == texformat && levels >= tex_levels && rgba_only == rgba &&
+		compressed_supported == compressed &&
+		Common::AlignUpSizePow2(width, bsw) == expanded_width &&
+		Common::AlignUpSizePow2(height, bsh) == expanded_height;
+}
+
+// Must be called with s_lock held
+static void Remove(std::unordered_map<u64, std::shared_ptr<Texture>>::iterator iter)
+{
+	s_decoded_size -= iter->second->offsets.empty() ? 0 : iter->second->offsets.back();
+	s_textures.erase(iter);
+}
+
+bool IsEnabled()
+{
+	return g_ActiveConfig.bPredictiveFifo && g_ActiveConfig.bTextureWriteWatch &&
+		Memory::IsWriteWatchSupported() && Fifo::UsePreprocessedFifo() && g_texture_cache;
+}
+
+void Init()
+{
+	memset(s_tex, 0, sizeof(s_tex));
+	s_bp_mask = 0xFFFFFF;
+	s_dirty_stages = 0;
+	s_issued.clear();
+}
+
+void Shutdown()
+{
+	// The jobs read emulated memory, which goes away after the video backend
+	WaitForJobs();
+	Clear();
+	s_issued.clear();
+}
+
+void WaitForJobs()
+{
+	while (s_jobs.load())
+		Common::YieldCPU();
+}
+
+void Clear()
+{
+	std::lock_guard<std::mutex> lk(s_lock);
+	s_textures.clear();
+	s_decoded_size = 0;
+}
+
+void LoadBPReg(u32 value)
+{
+	const u32 reg = value >> 24;
+	const u32 newval = value & 0xFFFFFF;
+	if (reg == BPMEM_BP_MASK)
+	{
+		s_bp_mask = newval;
+		return;
+	}
+	const u32 mask = s_bp_mask;
+	s_bp_mask = 0xFFFFFF;
+	if (reg < BPMEM_TX_SETMODE0 || reg >= BPMEM_TX_SETMODE0 + TEX_REG_COUNT)
+		return;
+	u32& shadow = reinterpret_cast<u32*>(s_tex)[reg - BPMEM_TX_SETMODE0];
+	const u32 oldval = shadow;
+	shadow = (oldval & ~mask) | (newval & mask);
+	if (shadow != oldval)
+		s_dirty_stages |= 1 << (((reg - BPMEM_TX_SETMODE0) >> 5) * 4 + (reg & 3));
+}
+
+static void Prefetch(u32 stage)
+{
+	const FourTexUnits& tex = s_tex[stage >> 2];
+	const u32 id = stage & 3;
+	// Textures preloaded to TMEM come from data the GPU thread hasn't loaded yet
+	if (tex.texImage1[id].image_type != 0)
+		return;
+	const u32 address = tex.texImage3[id].image_base << 5;
+	const u32 width = tex.texImage0[id].width + 1;
+	const u32 height = tex.texImage0[id].height + 1;
+	const u32 texformat = tex.texImage0[id].format;
+	const TlutFormat tlutfmt = static_cast<TlutFormat>(tex.texTlut[id].tlut_format);
+	const bool use_mipmaps = SamplerCommon::IsBpTexMode0MipmapsEnabled(tex.texMode0[id]);
+	u32 tex_levels = use_mipmaps ? ((tex.texMode1[id].max_lod + 0xf) / 0x10 + 1) : 1;
+	tex_levels = std::min<u32>(IntLog2(std::max(width, height)) + 1, tex_levels);
+	// Only the texture itself is known ahead, the palette is loaded to TMEM on the GPU thread
+	const bool is_palette = texformat == GX_TF_C4 || texformat == GX_TF_C8 || texformat == GX_TF_C14X2;
+	if (is_palette && tlutfmt > GX_TL_RGB5A3)
+		return;
+
+	const u32 bsw = TexDecoder_GetBlockWidthInTexels(texformat);
+	const u32 bsh = TexDecoder_GetBlockHeightInTexels(texformat);
+	const u32 texture_size = TexDecoder_GetTextureSizeInBytes(
+		Common::AlignUpSizePow2(width, bsw), Common::AlignUpSizePow2(height, bsh), texformat);
+	u32 full_size = 0;
+	std::vector<size_t> offsets;
+	size_t decoded_size = 0;
+	for (u32 level = 0; level != tex_levels; ++level)
+	{
+		const u32 expanded_width = Common::AlignUpSizePow2(TextureUtil::CalculateLevelSize(width, level), bsw);
+		const u32 expanded_height = Common::AlignUpSizePow2(TextureUtil::CalculateLevelSize(height, level), bsh);
+		full_size += TexDecoder_GetTextureSizeInBytes(expanded_width, expanded_height, texformat);
+		offsets.push_back(decoded_size);
+		// Room for RGBA, the largest decoded format. Aligned for the SIMD decoders.
+		decoded_size += Common::AlignUpSizePow2(expanded_width * expanded_height * 4, 32);
+	}
+	// The end of the last level
+	offsets.push_back(decoded_size);
+
+	const u64 key = (u64)address << 32 | texture_size;
+	auto issued = s_issued.find(key);
+	if (issued != s_issued.end() && !Memory::WrittenSince(address, full_size, issued->second))
+		return;
+	const u8* src = Memory::GetPointer(address);
+	if (!src)
+		return;
+	// Taken before the data is read on the worker, like the stamps of Load
+	const u64 stamp = Memory::WatchPages(address, full_size);
+	if (!stamp)
+		return;
+	if (s_issued.size() >= MAX_ISSUED)
+		s_issued.clear();
+	s_issued[key] = stamp;
+
+	auto texture = std::make_shared<Texture>();
+	texture->address = address;
+	texture->size = texture_size;
+	texture->full_size = full_size;
+	texture->format = texformat;
+	texture->width = width;
+	texture->height = height;
+	texture->levels = tex_levels;
+	texture->color_samples = g_ActiveConfig.iSafeTextureCache_ColorSamples;
+	texture->stamp = stamp;
+	// The format Load decodes to, textures it scales are always RGBA
+	PC_TexFormat pcfmt = g_texture_cache->GetNativeTextureFormat(texformat, tlutfmt, width, height);
+	if (g_ActiveConfig.iTexScalingType > 0 && width < 384 && height < 384)
+		pcfmt = PC_TEX_FMT_RGBA32;
+	texture->rgba_only = pcfmt == PC_TEX_FMT_RGBA32;
+	texture->compressed_supported = pcfmt >= PC_TEX_FMT_DXT1;
+	const bool hires = g_ActiveConfig.bHiresTextures && !is_palette;
+	bool decode = !is_palette && !g_ActiveConfig.UseGPUTextureDecoding();
+	{
+		std::lock_guard<std::mutex> lk(s_lock);
+		auto iter = s_textures.find(key);
+		if (iter != s_textures.end())
+			Remove(iter);
+		else if (s_textures.size() >= MAX_TEXTURES)
+			return;
+		decode = decode && s_decoded_size + decoded_size <= MAX_DECODED_SIZE;
+		if (decode)
+		{
+			texture->offsets = std::move(offsets);
+			s_decoded_size += decoded_size;
+		}
+		s_textures[key] = texture;
+	}
+
+	s_jobs++;
+	Common::AsyncWorker::ExecuteAsync([texture, src, tlutfmt, use_mipmaps, hires, bsw, bsh]()
+	{
+		texture->hash = GetHash64(src, texture->size, texture->color_samples);
+		// A texture with a custom replacement is never decoded
+		const bool custom = hires && HiresTexture::Preload(src, texture->size, texture->width,
+			texture->height, texture->format, use_mipmaps);
+		if (!texture->offsets.empty() && !custom)
+		{
+			// The jobs already run concurrently, the levels are decoded one after the other
+			u8* data = static_cast<u8*>(Common::AllocateAlignedMemory(texture->offsets.back(), 32));
+			const u8* level_src = src;
+			for (u32 level = 0; level != texture->levels; ++level)
+			{
+				const u32 expanded_width = Common::AlignUpSizePow2(TextureUtil::CalculateLevelSize(texture->width, level), bsw);
+				const u32 expanded_height = Common::AlignUpSizePow2(TextureUtil::CalculateLevelSize(texture->height, level), bsh);
+				TexDecoder_Decode(data + texture->offsets[level], level_src, expanded_width, expanded_height,
+					texture->format, 0, tlutfmt, texture->rgba_only, texture->compressed_supported);
+				level_src += TexDecoder_GetTextureSizeInBytes(expanded_width, expanded_height, texture->format);
+			}
+			texture->data = data;
+		}
+		texture->ready.store(true);
+		s_jobs--;
+	});
+}
+
+void Draw()
+{
+	if (!s_dirty_stages)
+		return;
+	u32 stages = s_dirty_stages;
+	s_dirty_stages = 0;
+	if (!IsEnabled())
+		return;
+	for (u32 stage = 0; stages; ++stage, stages >>= 1)
+	{
+		if (stages & 1)
+			Prefetch(stage);
+	}
+}
+
+std::shared_ptr<Texture> Take(u32 address, u32 size)
+{
+	std::shared_ptr<Texture> texture;
+	{
+		std::lock_guard<std::mutex> lk(s_lock);
+		auto iter = s_textures.find((u64)address << 32 | size);
+		if (iter == s_textures.end())
+			return nullptr;
+		texture = iter->second;
+		Remove(iter);
+	}
+	// A result that isn't ready yet is left to its job, Load is faster doing the work itself
+	if (!texture->ready.load() ||
+		texture->color_samples != g_ActiveConfig.iSafeTextureCache_ColorSamples ||
+		Memory::WrittenSince(address, size, texture->stamp))
+	{
+		return nullptr;
+	}
+	// The hash only covers the first level, decoded mipmaps are only good if none was written
+	if (texture->data && Memory::WrittenSince(address, texture->full_size, texture->stamp))
+	{
+		Common::FreeAlignedMemory(texture->data);
+		texture->data = nullptr;
+	}
+	return texture;
+}
+
+void Cleanup()
+{
+	std::lock_guard<std::mutex> lk(s_lock);
+	for (auto iter = s_textures.begin(); iter != s_textures.end();)
+	{
+		auto current = iter++;
+		if (current->second->ready.load() && ++current->second->age > MAX_AGE)
+			Remove(current);
+	}
+}
+}
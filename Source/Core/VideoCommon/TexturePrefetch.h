@@ -0,0 +1,70 @@
+// Copyright 2013 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+// Texture prefetching for the predictive FIFO. When the FIFO is preprocessed ahead of
+// the GPU thread (GPU parse thread or deterministic dual core), the preprocessor keeps
+// a shadow of the texture registers and, at each draw, hashes and decodes the textures
+// that changed on the worker threads. TextureCacheBase::Load then takes the result
+// instead of doing the work itself, if the memory wasn't written since.
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+namespace TexturePrefetch
+{
+struct Texture
+{
+	~Texture();
+
+	// Buffer of a decoded level, nullptr if the texture was only hashed
+	u8* GetLevel(u32 level) const;
+	// Whether the decoded levels are what Load would decode with these parameters
+	bool IsDecoded(u32 texformat, u32 expanded_width, u32 expanded_height, u32 tex_levels,
+		bool rgba, bool compressed) const;
+
+	u32 address = 0;
+	// Size of the first level, the part Load hashes, and of all the levels
+	u32 size = 0;
+	u32 full_size = 0;
+	u32 format = 0;
+	u32 width = 0;
+	u32 height = 0;
+	u32 levels = 0;
+	bool rgba_only = false;
+	bool compressed_supported = false;
+	int color_samples = 0;
+	// From Memory::WatchPages, taken before the data was read
+	u64 stamp = 0;
+	u64 hash = 0;
+	// Decoded levels, aligned for the SIMD decoders
+	u8* data = nullptr;
+	std::vector<size_t> offsets;
+	std::atomic<bool> ready{ false };
+	// Frames the result waited for its texture
+	u32 age = 0;
+};
+
+bool IsEnabled();
+void Init();
+// Waits for the running jobs, the preprocessor must not run anymore
+void Shutdown();
+void WaitForJobs();
+// Drops the results, for when the hashing or decoding settings change
+void Clear();
+
+// Called by the preprocessor for BP writes and draws
+void LoadBPReg(u32 value);
+void Draw();
+
+// Called by Load, returns the finished result for a texture if its memory wasn't
+// written since it was hashed. The result is removed either way.
+std::shared_ptr<Texture> Take(u32 address, u32 size);
+// Called once per frame, drops the results nobody took
+void Cleanup();
+}
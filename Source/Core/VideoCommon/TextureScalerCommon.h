@@ -20,6 +20,7 @@
 #include "Common/CommonTypes.h"
 #include "Common/MemoryUtil.h"
 
+#include <functional>
 #include <vector>
 
 class TextureScaler
@@ -29,6 +30,16 @@ public:
 	~TextureScaler();
 
 	u32* Scale(u32* data, int width, int height);
+	// Same as above with explicit settings instead of the active config, safe to use
+	// outside of the video thread. Each thread needs its own TextureScaler though.
+	u32* Scale(u32* data, int width, int height, int type, int factor, bool deposterize);
+
+	// Limits the number of threads a single scaling operation is split over,
+	// 0 uses every thread of the pool. The output does not depend on it.
+	void SetMaxThreads(int threads)
+	{
+		m_max_threads = threads;
+	}
 
 	enum
 	{
@@ -36,7 +47,10 @@ public:
 	};
 
 private:
+	// Minimum amount of pixels per band handed to a thread
+	static const int MIN_BAND_PIXELS = 16 * 1024;
 
+	void ParallelLoop(const std::function<void(int, int)>& func, int lower, int upper, int row_width);
 	void ScaleXBRZ(int factor, u32* source, u32* dest, int width, int height);
 	void ScaleBilinear(int factor, u32* source, u32* dest, int width, int height);
 	void ScaleBicubicBSpline(int factor, u32* source, u32* dest, int width, int height);
@@ -57,4 +71,5 @@ private:
 	// maximum is (100 MB total for a 512 by 512 texture with scaling factor 5 and hybrid scaling)
 	// of course, scaling factor 5 is totally silly anyway
 	Common::SimpleBuf<u32> bufInput, bufDeposter, bufOutput, bufTmp1, bufTmp2, bufTmp3;
+	int m_max_threads = 0;
 };
@@ -20,8 +20,8 @@ public:
 		return true;
 	} // This vertex loader supports all formats
 private:
-	// Pipeline.
-	TPipelineFunction m_PipelineStages[32];
+	// Pipeline. A vertex with every attribute and matrix index takes 33 stages.
+	TPipelineFunction m_PipelineStages[33];
 	s32 m_numPipelineStages;
 
 	void CompileVertexTranslator();
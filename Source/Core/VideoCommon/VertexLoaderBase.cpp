@@ -2,6 +2,7 @@
 // Licensed under GPLv2+
 // Refer to the license.txt file included.
 
+#include <algorithm>
 #include <cinttypes>
 #include <memory>
 #include <vector>
@@ -11,7 +12,6 @@
 #include "Common/StringUtil.h"
 
 #include "VideoCommon/VertexLoader.h"
-#include "VideoCommon/VertexLoaderCompiled.h"
 #include "VideoCommon/VertexLoaderBase.h"
 #include "VideoCommon/VideoConfig.h"
 
@@ -57,6 +57,17 @@ VertexLoaderUID::VertexLoaderUID(const TVtxDesc& VtxDesc, const VAT& vat)
 	mask &= VtxDesc.Tex6Coord || VtxDesc.Tex6MatIdx ? fullmask : ~VAT_2_TEX6BITS;
 	mask &= VtxDesc.Tex7Coord || VtxDesc.Tex7MatIdx ? fullmask : ~VAT_2_TEX7BITS;
 	vid[3] = vat.g2.Hex & mask;
+	UpdateHashes();
+}
+
+VertexLoaderUID::VertexLoaderUID(const u32 elements[4])
+{
+	std::copy(elements, elements + 4, vid);
+	UpdateHashes();
+}
+
+void VertexLoaderUID::UpdateHashes()
+{
 	hash = CalculateHash();
 	if (sizeof(size_t) >= sizeof(u64))
 	{
@@ -111,6 +122,14 @@ u32 VertexLoaderUID::GetElement(u32 idx) const
 	return vid[idx];
 }
 
+void VertexLoaderUID::GetVertexFormat(TVtxDesc& VtxDesc, VAT& vat) const
+{
+	VtxDesc.Hex = ((u64)vid[0] << 1) | (vid[2] >> 31);
+	vat.g0.Hex = vid[1];
+	vat.g1.Hex = vid[2] & 0x7FFFFFFFu;
+	vat.g2.Hex = vid[3];
+}
+
 u64 VertexLoaderUID::CalculateHash()
 {
 	u64 h = -1;
@@ -323,6 +342,12 @@ private:
 };
 
 std::unique_ptr<VertexLoaderBase> VertexLoaderBase::CreateVertexLoader(const TVtxDesc& vtx_desc, const VAT& vtx_attr)
+{
+	return CreateVertexLoader(vtx_desc, vtx_attr, g_ActiveConfig.bAVX2VertexPairs);
+}
+
+std::unique_ptr<VertexLoaderBase> VertexLoaderBase::CreateVertexLoader(const TVtxDesc& vtx_desc, const VAT& vtx_attr,
+	bool avx2_vertex_pairs)
 {
 	std::unique_ptr<VertexLoaderBase> loader;
 
@@ -332,28 +357,20 @@ std::unique_ptr<VertexLoaderBase> VertexLoaderBase::CreateVertexLoader(const TVt
 	// first try: Any new VertexLoader vs the old one
 	loader = std::make_unique<VertexLoaderTester>(
 		std::make_unique<VertexLoader>(vtx_desc, vtx_attr), // the software one
-		std::make_unique<VertexLoaderX64>(vtx_desc, vtx_attr), // the new one to compare
+		std::make_unique<VertexLoaderX64>(vtx_desc, vtx_attr, avx2_vertex_pairs), // the new one to compare
 		vtx_desc, vtx_attr);
 	if (loader->IsInitialized())
 		return loader;
 	loader.reset();
 #elif defined(_M_X86_64)
-	loader = std::make_unique<VertexLoaderX64>(vtx_desc, vtx_attr);
+	loader = std::make_unique<VertexLoaderX64>(vtx_desc, vtx_attr, avx2_vertex_pairs);
 	if (!loader->IsInitialized())
 	{
 		loader.reset();
 	}
 #endif
-	std::unique_ptr<VertexLoaderBase> fallback = std::make_unique<VertexLoaderCompiled>(vtx_desc, vtx_attr);
-	if (!fallback->IsInitialized())
-	{
-		fallback.reset();
-	}
-	if (!fallback)
-	{
-		// last try: The old VertexLoader
-		fallback = std::make_unique<VertexLoader>(vtx_desc, vtx_attr);
-	}
+	// last try: The old VertexLoader
+	std::unique_ptr<VertexLoaderBase> fallback = std::make_unique<VertexLoader>(vtx_desc, vtx_attr);
 	if (!loader)
 	{
 		loader = std::move(fallback);
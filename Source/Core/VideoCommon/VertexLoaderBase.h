@@ -30,13 +30,18 @@ class VertexLoaderUID
 	size_t platformhash;
 public:
 	VertexLoaderUID(const TVtxDesc& VtxDesc, const VAT& vat);
+	// From the elements of another uid, e.g. one that was saved to disk
+	explicit VertexLoaderUID(const u32 elements[4]);
 	bool operator < (const VertexLoaderUID &other) const;
 	bool operator == (const VertexLoaderUID& rh) const;
 	u64 GetHash() const;
 	size_t GetplatformHash() const;
 	u32 GetElement(u32 idx) const;
+	// A vertex format with this uid, the parts the uid leaves out are zero
+	void GetVertexFormat(TVtxDesc& VtxDesc, VAT& vat) const;
 private:
 	u64 CalculateHash();
+	void UpdateHashes();
 };
 
 namespace std
@@ -56,6 +61,9 @@ class VertexLoaderBase
 {
 public:
 	static std::unique_ptr<VertexLoaderBase> CreateVertexLoader(const TVtxDesc &vtx_desc, const VAT &vtx_attr);
+	// Takes the settings instead of reading g_ActiveConfig, for threads other than the GPU thread
+	static std::unique_ptr<VertexLoaderBase> CreateVertexLoader(const TVtxDesc &vtx_desc, const VAT &vtx_attr,
+		bool avx2_vertex_pairs);
 	virtual ~VertexLoaderBase()
 	{
 		m_fallback.reset();
@@ -72,10 +80,6 @@ public:
 	{
 		return true;
 	}
-	virtual bool IsPrecompiled()
-	{
-		return false;
-	}
 	virtual s32 RunVertices(const VertexLoaderParameters &parameters) = 0;
 
 	virtual bool IsInitialized() = 0;
@@ -3,19 +3,31 @@
 // Refer to the license.txt file included.
 // Modified for Ishiiruka by Tino
 
+#include <algorithm>
+#include <cinttypes>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <unordered_map>
+#include <vector>
 
 
 #include "Core/ConfigManager.h"
 #include "Core/HW/Memmap.h"
 
+#include "Common/FileUtil.h"
+#include "Common/Flag.h"
+#include "Common/Thread.h"
 #include "Common/ThreadPool.h"
 #include "Common/StringUtil.h"
 
 #include "VideoCommon/IndexGenerator.h"
+#include "VideoCommon/StageTiming.h"
 #include "VideoCommon/Statistics.h"
+#include "VideoCommon/VertexLoader_Normal.h"
+#include "VideoCommon/VertexLoader_Position.h"
+#include "VideoCommon/VertexLoader_TextCoord.h"
 #include "VideoCommon/VertexLoaderManager.h"
 #include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/VideoConfig.h"
@@ -30,6 +42,9 @@ typedef std::unordered_map<VertexLoaderUID, std::unique_ptr<VertexLoaderBase>> V
 namespace VertexLoaderManager
 {
 static VertexLoaderMap s_vertex_loader_map;
+// The preprocessing of the deterministic GPU thread and the GPU parse thread looks up loaders
+// next to the GPU thread. The native formats are only used and created on the GPU thread.
+static std::mutex s_vertex_loader_map_mutex;
 static NativeVertexFormatMap s_native_vertex_map;
 static NativeVertexFormat* s_current_vtx_fmt;
 u32 g_current_components;
@@ -56,146 +71,178 @@ struct entry
 		return num_verts > other.num_verts;
 	}
 };
+}
 
-struct codeentry
+void AppendListToString(std::string *dest)
 {
-	std::string name;
-	std::string conf;
-	u64 num_verts;
-	std::string hash;
-	bool operator < (const codeentry &other) const
+	std::vector<entry> entries;
+
+	size_t total_size = 0;
+	std::unique_lock<std::mutex> lk(s_vertex_loader_map_mutex);
+	for (VertexLoaderMap::const_iterator iter = s_vertex_loader_map.begin(); iter != s_vertex_loader_map.end(); ++iter)
 	{
-		return num_verts > other.num_verts;
+		entry e;
+		iter->second->AppendToString(&e.text);
+		e.num_verts = iter->second->m_numLoadedVertices;
+		entries.push_back(e);
+		total_size += e.text.size() + 1;
+	}
+	lk.unlock();
+	sort(entries.begin(), entries.end());
+	dest->reserve(dest->size() + total_size);
+	for (std::vector<entry>::const_iterator iter = entries.begin(); iter != entries.end(); ++iter)
+	{
+		dest->append(iter->text);
 	}
-};
 }
 
-static std::string To_HexString(u32 in)
+// Vertex loaders used in the previous sessions of the game, most used first. The
+// top ones are built on a thread while the game boots, GetOrAddLoader takes them
+// from there instead of building them on the GPU thread when they are first drawn.
+static std::vector<std::pair<u64, VertexLoaderUID>> s_loader_usage;
+static VertexLoaderMap s_prebuilt_loaders;
+static std::mutex s_prebuilt_loaders_mutex;
+static std::thread s_prebuild_thread;
+static Common::Flag s_prebuild_abort;
+static const size_t MAX_PREBUILT_LOADERS = 256;
+static const size_t MAX_USAGE_ENTRIES = 1024;
+
+static std::string GetUsageFilename()
 {
-	char hexString[2 * sizeof(u32) + 8];
-	sprintf(hexString, "0x%08xu", in);
-	return std::string(hexString);
+	return File::GetUserPath(D_CACHE_IDX) + "VertexLoaders_" + last_game_code + ".usage";
 }
 
-static void DumpLoadersCode()
+static void LoadUsage()
 {
-	std::vector<codeentry> entries;
-	for (VertexLoaderMap::const_iterator iter = s_vertex_loader_map.begin(); iter != s_vertex_loader_map.end(); ++iter)
+	s_loader_usage.clear();
+	std::string data;
+	if (last_game_code.empty() || !File::ReadFileToString(GetUsageFilename(), data))
+		return;
+	std::vector<std::string> lines;
+	SplitString(data, '\n', lines);
+	for (const std::string& line : lines)
 	{
-		if (!iter->second->IsPrecompiled())
+		// <count> <uid elements>
+		u64 count;
+		u32 elements[4];
+		if (sscanf(line.c_str(), "%" SCNu64 " %x %x %x %x", &count, &elements[0], &elements[1],
+			&elements[2], &elements[3]) == 5)
 		{
-			codeentry e;
-			e.conf.append(To_HexString(iter->first.GetElement(0)));
-			e.conf.append(", ");
-			e.conf.append(To_HexString(iter->first.GetElement(1)));
-			e.conf.append(", ");
-			e.conf.append(To_HexString(iter->first.GetElement(2)));
-			e.conf.append(", ");
-			e.conf.append(To_HexString(iter->first.GetElement(3)));
-			e.name = iter->second->GetName();
-			e.num_verts = iter->second->m_numLoadedVertices;
-			e.hash = std::to_string(iter->first.GetHash());
-			entries.push_back(e);
+			s_loader_usage.emplace_back(count, VertexLoaderUID(elements));
 		}
 	}
-	if (entries.size() == 0)
-	{
+	std::stable_sort(s_loader_usage.begin(), s_loader_usage.end(),
+		[](const auto& a, const auto& b) { return a.first > b.first; });
+}
+
+static void SaveUsage()
+{
+	if (last_game_code.empty() || s_vertex_loader_map.empty())
 		return;
+	// Older counts fade out, so loaders the game stopped using eventually drop out of the list
+	std::unordered_map<VertexLoaderUID, u64> counts;
+	for (const auto& usage : s_loader_usage)
+		counts[usage.second] = usage.first / 2;
+	for (const auto& loader : s_vertex_loader_map)
+	{
+		VertexLoaderBase* fallback = loader.second->GetFallback();
+		const u64 vertices = loader.second->m_numLoadedVertices + (fallback ? fallback->m_numLoadedVertices : 0);
+		counts[loader.first] += std::max<u64>(vertices, 1);
 	}
-	std::string filename = StringFromFormat("%sG_%s_pvt.h", File::GetUserPath(D_DUMP_IDX).c_str(), last_game_code.c_str());
-	std::string header;
-	header.append("// Copyright 2013 Dolphin Emulator Project\n");
-	header.append("// Licensed under GPLv2+\n");
-	header.append("// Refer to the license.txt file included.\n");
-	header.append("// Added for Ishiiruka by Tino\n");
-	header.append("#pragma once\n");
-	header.append("#include <map>\n");
-	header.append("#include \"VideoCommon/NativeVertexFormat.h\"\n");
-	header.append("class G_");
-	header.append(last_game_code);
-	header.append("_pvt\n{\npublic:\n");
-	header.append("static void Initialize(std::map<u64, TCompiledLoaderFunction> &pvlmap);\n");
-	header.append("};\n");
-	std::ofstream headerfile(filename);
-	headerfile << header;
-	headerfile.close();
-	filename = StringFromFormat("%sG_%s_pvt.cpp", File::GetUserPath(D_DUMP_IDX).c_str(), last_game_code.c_str());
-	sort(entries.begin(), entries.end());
-	std::string sourcecode;
-	sourcecode.append("#include \"VideoCommon/G_");
-	sourcecode.append(last_game_code);
-	sourcecode.append("_pvt.h\"\n");
-	sourcecode.append("#include \"VideoCommon/VertexLoader_Template.h\"\n\n");
-	sourcecode.append("\n\nvoid G_");
-	sourcecode.append(last_game_code);
-	sourcecode.append("_pvt::Initialize(std::map<u64, TCompiledLoaderFunction> &pvlmap)\n{\n");
-	for (std::vector<codeentry>::const_iterator iter = entries.begin(); iter != entries.end(); ++iter)
+
+	std::vector<std::pair<u64, VertexLoaderUID>> usage;
+	for (const auto& count : counts)
+	{
+		if (count.second > 0)
+			usage.emplace_back(count.second, count.first);
+	}
+	std::sort(usage.begin(), usage.end(), [](const auto& a, const auto& b) { return a.first > b.first; });
+	if (usage.size() > MAX_USAGE_ENTRIES)
+		usage.erase(usage.begin() + MAX_USAGE_ENTRIES, usage.end());
+
+	std::string data;
+	for (const auto& entry : usage)
 	{
-		sourcecode.append("\t// ");
-		sourcecode.append(iter->name);
-		sourcecode.append("\n// num_verts= ");
-		sourcecode.append(std::to_string(iter->num_verts));
-		sourcecode.append("#if _M_SSE >= 0x301\n");
-		sourcecode.append("\tif (cpu_info.bSSSE3)\n");
-		sourcecode.append("\t{\n");
-		sourcecode.append("\t\tpvlmap[");
-		sourcecode.append(iter->hash);
-		sourcecode.append("] = ");
-		sourcecode.append("TemplatedLoader");
-		sourcecode.append("<0x301, ");
-		sourcecode.append(iter->conf);
-		sourcecode.append(">;\n");
-		sourcecode.append("\t}\n\telse\n");
-		sourcecode.append("#endif\n");
-		sourcecode.append("\t{\n");
-		sourcecode.append("\t\tpvlmap[");
-		sourcecode.append(iter->hash);
-		sourcecode.append("] = ");
-		sourcecode.append("TemplatedLoader");
-		sourcecode.append("<0, ");
-		sourcecode.append(iter->conf);
-		sourcecode.append(">;\n");
-		sourcecode.append("\t}\n");
+		data += StringFromFormat("%" PRIu64 " %08x %08x %08x %08x\n", entry.first, entry.second.GetElement(0),
+			entry.second.GetElement(1), entry.second.GetElement(2), entry.second.GetElement(3));
 	}
-	sourcecode.append("}\n");
-	std::ofstream out(filename);
-	out << sourcecode;
-	out.close();
+	File::CreateFullPath(File::GetUserPath(D_CACHE_IDX));
+	if (!File::WriteStringToFile(data, GetUsageFilename()))
+		ERROR_LOG(VIDEO, "Failed to save vertex loader usage to %s", GetUsageFilename().c_str());
 }
 
-void AppendListToString(std::string *dest)
+// Runs next to the GPU thread, so the settings the loaders depend on are passed in
+// instead of read from g_ActiveConfig while it may change
+static void PrebuildLoaders(std::vector<VertexLoaderUID> uids, bool avx2_vertex_pairs)
 {
-	std::vector<entry> entries;
+	Common::SetCurrentThreadName("Vertex loader prebuild");
 
-	size_t total_size = 0;
-	for (VertexLoaderMap::const_iterator iter = s_vertex_loader_map.begin(); iter != s_vertex_loader_map.end(); ++iter)
-	{
-		entry e;
-		iter->second->AppendToString(&e.text);
-		e.num_verts = iter->second->m_numLoadedVertices;
-		entries.push_back(e);
-		total_size += e.text.size() + 1;
-	}
-	sort(entries.begin(), entries.end());
-	dest->reserve(dest->size() + total_size);
-	for (std::vector<entry>::const_iterator iter = entries.begin(); iter != entries.end(); ++iter)
+	for (const VertexLoaderUID& uid : uids)
 	{
-		dest->append(iter->text);
+		if (s_prebuild_abort.IsSet())
+			break;
+		TVtxDesc vtx_desc;
+		VAT vtx_attr;
+		uid.GetVertexFormat(vtx_desc, vtx_attr);
+		std::unique_ptr<VertexLoaderBase> loader =
+			VertexLoaderBase::CreateVertexLoader(vtx_desc, vtx_attr, avx2_vertex_pairs);
+		std::lock_guard<std::mutex> lk(s_prebuilt_loaders_mutex);
+		s_prebuilt_loaders[uid] = std::move(loader);
 	}
 }
 
+static void StopPrebuild()
+{
+	s_prebuild_abort.Set();
+	if (s_prebuild_thread.joinable())
+		s_prebuild_thread.join();
+	s_prebuild_abort.Clear();
+	s_prebuilt_loaders.clear();
+}
+
+static void StartPrebuild()
+{
+	StopPrebuild();
+	if (s_loader_usage.empty())
+		return;
+	std::vector<VertexLoaderUID> uids;
+	for (size_t i = 0; i < std::min(s_loader_usage.size(), MAX_PREBUILT_LOADERS); i++)
+		uids.push_back(s_loader_usage[i].second);
+	INFO_LOG(VIDEO, "Building %zu vertex loaders used by %s before", uids.size(), last_game_code.c_str());
+	s_prebuild_thread = std::thread(PrebuildLoaders, std::move(uids), g_ActiveConfig.bAVX2VertexPairs);
+}
+
+static std::unique_ptr<VertexLoaderBase> TakePrebuiltLoader(const VertexLoaderUID& uid)
+{
+	std::lock_guard<std::mutex> lk(s_prebuilt_loaders_mutex);
+	auto iter = s_prebuilt_loaders.find(uid);
+	if (iter == s_prebuilt_loaders.end())
+		return nullptr;
+	std::unique_ptr<VertexLoaderBase> loader = std::move(iter->second);
+	s_prebuilt_loaders.erase(iter);
+	return loader;
+}
+
 void Init()
 {
 	MarkAllDirty();
 	for (VertexLoaderBase*& vertexLoader : g_main_cp_state.vertex_loaders)
 		vertexLoader = nullptr;
 	last_game_code = SConfig::GetInstance().m_strGameID;
+	// The function tables of the software loader are shared, fill them before loaders
+	// are built on two threads
+	VertexLoader_Normal::Init();
+	VertexLoader_Position::Init();
+	VertexLoader_TextCoord::Init();
+	LoadUsage();
+	StartPrebuild();
 }
 
 void Shutdown()
 {
-	if (s_vertex_loader_map.size() > 0 && g_ActiveConfig.bDumpVertexLoaders)
-		DumpLoadersCode();
+	StopPrebuild();
+	SaveUsage();
+	s_loader_usage.clear();
 	s_vertex_loader_map.clear();
 	s_native_vertex_map.clear();
 }
@@ -239,24 +286,41 @@ void MarkAllDirty()
 	g_preprocess_cp_state.bases_dirty = true;
 }
 
-inline VertexLoaderBase *GetOrAddLoader(const TVtxDesc &VtxDesc, const VAT &VtxAttr)
+// Only looks up or builds the loader, any thread
+static VertexLoaderBase* GetOrAddLoader(const TVtxDesc &VtxDesc, const VAT &VtxAttr)
 {
 	VertexLoaderUID uid(VtxDesc, VtxAttr);
-	VertexLoaderMap::iterator iter = s_vertex_loader_map.find(uid);
-	if (iter == s_vertex_loader_map.end())
 	{
-		s_vertex_loader_map[uid] = VertexLoaderBase::CreateVertexLoader(VtxDesc, VtxAttr);
-		VertexLoaderBase* loader = s_vertex_loader_map[uid].get();
+		std::lock_guard<std::mutex> lk(s_vertex_loader_map_mutex);
+		VertexLoaderMap::iterator iter = s_vertex_loader_map.find(uid);
+		if (iter != s_vertex_loader_map.end())
+			return iter->second.get();
+	}
+	std::unique_ptr<VertexLoaderBase> new_loader = TakePrebuiltLoader(uid);
+	if (!new_loader)
+		new_loader = VertexLoaderBase::CreateVertexLoader(VtxDesc, VtxAttr);
+	std::lock_guard<std::mutex> lk(s_vertex_loader_map_mutex);
+	// The other thread may have added it in the meantime
+	auto result = s_vertex_loader_map.emplace(uid, std::move(new_loader));
+	if (result.second)
+		INCSTAT(stats.numVertexLoaders);
+	return result.first->second.get();
+}
+
+// GPU thread only
+static VertexLoaderBase* GetOrAddLoaderWithFormat(const TVtxDesc &VtxDesc, const VAT &VtxAttr)
+{
+	VertexLoaderBase* loader = GetOrAddLoader(VtxDesc, VtxAttr);
+	if (!loader->m_native_vertex_format)
+	{
 		loader->m_native_vertex_format = GetNativeVertexFormat(loader->m_native_vtx_decl);
 		VertexLoaderBase * fallback = loader->GetFallback();
 		if (fallback)
 		{
 			fallback->m_native_vertex_format = GetNativeVertexFormat(fallback->m_native_vtx_decl);
 		}
-		INCSTAT(stats.numVertexLoaders);
-		return loader;
 	}
-	return iter->second.get();
+	return loader;
 }
 
 void GetVertexSizeAndComponents(const VertexLoaderParameters &parameters, u32 &vertexsize, u32 &components)
@@ -271,11 +335,11 @@ void GetVertexSizeAndComponents(const VertexLoaderParameters &parameters, u32 &v
 
 inline void UpdateLoader(const VertexLoaderParameters &parameters)
 {
-	g_main_cp_state.vertex_loaders[parameters.vtx_attr_group] = GetOrAddLoader(*parameters.VtxDesc, *parameters.VtxAttr);
+	g_main_cp_state.vertex_loaders[parameters.vtx_attr_group] = GetOrAddLoaderWithFormat(*parameters.VtxDesc, *parameters.VtxAttr);
 	g_main_cp_state.last_id = parameters.vtx_attr_group;
 }
 
-bool ConvertVertices(VertexLoaderParameters &parameters, u32 &readsize, u32 &writesize)
+VertexLoaderBase* GetActiveLoader(const VertexLoaderParameters &parameters)
 {
 	if (parameters.needloaderrefresh)
 	{
@@ -286,6 +350,31 @@ bool ConvertVertices(VertexLoaderParameters &parameters, u32 &readsize, u32 &wri
 	{
 		loader = loader->GetFallback();
 	}
+	return loader;
+}
+
+void AddConvertedVertices(const VertexLoaderBase* loader, int primitive, u32 count, const u8* data, u32 finalcount)
+{
+	NativeVertexFormat *nativefmt = loader->m_native_vertex_format;
+	if (s_current_vtx_fmt != nullptr && s_current_vtx_fmt != nativefmt)
+	{
+		g_vertex_manager->Flush();
+	}
+	s_current_vtx_fmt = nativefmt;
+	g_current_components = loader->m_native_components;
+	g_vertex_manager->PrepareForAdditionalData(primitive, count, loader->m_native_stride);
+	StageTiming::ScopedStage timing(StageTiming::STAGE_VERTEX_CONVERSION);
+	u32 writesize = loader->m_native_stride * finalcount;
+	memcpy(g_vertex_manager->GetCurrentBufferPointer(), data, writesize);
+	g_vertex_manager->IncCurrentBufferPointer(writesize);
+	IndexGenerator::AddIndices(primitive, finalcount);
+	ADDSTAT(stats.thisFrame.numPrims, finalcount);
+	INCSTAT(stats.thisFrame.numPrimitiveJoins);
+}
+
+bool ConvertVertices(VertexLoaderParameters &parameters, u32 &readsize, u32 &writesize)
+{
+	auto loader = GetActiveLoader(parameters);
 	readsize = parameters.count * loader->m_VertexSize;
 	if (parameters.buf_size < readsize)
 		return false;
@@ -304,6 +393,7 @@ bool ConvertVertices(VertexLoaderParameters &parameters, u32 &readsize, u32 &wri
 	s_current_vtx_fmt = nativefmt;
 	g_current_components = loader->m_native_components;
 	g_vertex_manager->PrepareForAdditionalData(parameters.primitive, parameters.count, loader->m_native_stride);
+	StageTiming::ScopedStage timing(StageTiming::STAGE_VERTEX_CONVERSION);
 	parameters.destination = g_vertex_manager->GetCurrentBufferPointer();
 	s32 finalcount = loader->RunVertices(parameters);
 	writesize = loader->m_native_stride * finalcount;
@@ -24,6 +24,12 @@ int GetVertexSize(const VertexLoaderParameters &parameters);
 
 bool ConvertVertices(VertexLoaderParameters &parameters, u32 &readsize, u32 &writesize);
 
+// Returns the loader ConvertVertices will use for the given parameters.
+VertexLoaderBase* GetActiveLoader(const VertexLoaderParameters &parameters);
+
+// Appends vertices that were already converted by the given loader (display list cache).
+void AddConvertedVertices(const VertexLoaderBase* loader, int primitive, u32 count, const u8* data, u32 finalcount);
+
 void GetVertexSizeAndComponents(const VertexLoaderParameters &parameters, u32 &vertexsize, u32 &components);
 
 // For debugging
@@ -2,11 +2,16 @@
 // Licensed under GPLv2+
 // Refer to the license.txt file included.
 
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
 #include "Common/BitSet.h"
 #include "Common/Common.h"
 #include "Common/CPUDetect.h"
 #include "Common/Intrinsics.h"
 #include "Common/JitRegister.h"
+#include "Common/ThreadPool.h"
 #include "Common/x64ABI.h"
 #include "VideoCommon/BoundingBox.h"
 #include "VideoCommon/VideoConfig.h"
@@ -25,9 +30,17 @@ static const X64Reg count_reg = R10;
 static const X64Reg skipped_reg = R11;
 static const u32 MASKINDEXED = INDEX8 & INDEX16;
 static const X64Reg base_reg = RBX;
+static const X64Reg texcoord_scale_regs[8] = {
+	XMM4, XMM5, XMM6, XMM7,
+	XMM8, XMM9, XMM10, XMM11,
+};
 
 static const u8* memory_base_ptr = (u8*)&g_main_cp_state.array_strides;
 
+// Draws with this many vertices are converted in ranges on the thread pool
+static const int PARALLEL_MIN_VERTICES = 8192;
+static const int PARALLEL_RANGE_VERTICES = 2048;
+
 static OpArg MPIC(const void* ptr)
 {
 	return MDisp(base_reg, PtrOffset(ptr, memory_base_ptr));
@@ -49,12 +62,25 @@ static __m128 scale_factors[13] = {
 	_mm_set_ps1(0.0f)
 };
 
-VertexLoaderX64::VertexLoaderX64(const TVtxDesc& vtx_desc, const VAT& vtx_att) : VertexLoaderBase(vtx_desc, vtx_att)
+// Pairs of vertices only pay off when the components are most of the work. Anything
+// next to the position, even a normal, costs more per vertex in GPRs than the pairs save.
+static bool PairsAreFaster(const TVtxDesc& vtx_desc)
+{
+	TVtxDesc position;
+	position.Hex = 0;
+	position.Position = DIRECT;
+	return vtx_desc.Hex == position.Hex;
+}
+
+VertexLoaderX64::VertexLoaderX64(const TVtxDesc& vtx_desc, const VAT& vtx_att, bool avx2_vertex_pairs)
+	: VertexLoaderBase(vtx_desc, vtx_att)
 {
 	if (!IsInitialized())
 		return;
 
-	AllocCodeSpace(1024, false);
+	m_avx2 = cpu_info.bAVX2 && (avx2_vertex_pairs || PairsAreFaster(vtx_desc));
+	// The AVX2 loader also has the single vertex loop
+	AllocCodeSpace(m_avx2 ? 4096 : 1024, false);
 	ClearCodeSpace();
 	GenerateVertexLoader();
 	WriteProtect();
@@ -63,23 +89,26 @@ VertexLoaderX64::VertexLoaderX64(const TVtxDesc& vtx_desc, const VAT& vtx_att) :
 	JitRegister::Register(region, GetCodePtr(), name.c_str());
 }
 
-OpArg VertexLoaderX64::GetVertexAddr(int array, u64 attribute)
+OpArg VertexLoaderX64::GetVertexAddr(int array, u64 attribute, int vertex)
 {
-	OpArg data = MDisp(src_reg, m_src_ofs);
+	OpArg data = MDisp(src_reg, m_src_ofs + vertex * m_VertexSize);
 	if (attribute & MASKINDEXED)
 	{
 		int bits = attribute == INDEX8 ? 8 : 16;
-		LoadAndSwap(bits, scratch1, data);
-		m_src_ofs += bits / 8;
+		// The second vertex of a pair keeps its address while the first one is read
+		X64Reg index = vertex ? scratch2 : scratch1;
+		LoadAndSwap(bits, index, data);
+		if (vertex == m_vertices - 1)
+			m_src_ofs += bits / 8;
 		if (array == ARRAY_POSITION)
 		{
-			CMP(bits, R(scratch1), Imm8(-1));
-			m_skip_vertex = J_CC(CC_E, true);
+			CMP(bits, R(index), Imm8(-1));
+			m_skip_vertex[vertex] = J_CC(CC_E, true);
 		}
 		// TODO: Move cached_arraybases into CPState and use MDisp() relative to a constant register loaded with &g_main_cp_state.
-		IMUL(32, scratch1, MPIC(&g_main_cp_state.array_strides[array]));
-		MOV(64, R(scratch2), MPIC(&cached_arraybases[array]));
-		return MRegSum(scratch1, scratch2);
+		IMUL(32, index, MPIC(&g_main_cp_state.array_strides[array]));
+		ADD(64, R(index), MPIC(&cached_arraybases[array]));
+		return MatR(index);
 	}
 	else
 	{
@@ -87,7 +116,45 @@ OpArg VertexLoaderX64::GetVertexAddr(int array, u64 attribute)
 	}
 }
 
-int VertexLoaderX64::ReadVertex(OpArg data, u64 attribute, int format, int count_in, int count_out, bool dequantize, AttributeFormat* native_format, X64Reg scaling_register)
+OpArg VertexLoaderX64::GetVertexDest(int vertex)
+{
+	return MDisp(dst_reg, m_dst_ofs + vertex * m_native_stride);
+}
+
+void VertexLoaderX64::LoadScaleFactors(bool broadcast)
+{
+	auto load = [&](X64Reg reg, const __m128* scale) {
+		if (broadcast)
+			VBROADCASTF128(reg, MPIC(scale));
+		else
+			MOVAPD(reg, MPIC(scale));
+	};
+	if (m_VtxAttr.PosFormat != FORMAT_FLOAT && m_VtxAttr.ByteDequant)
+	{
+		load(XMM2, &scale_factors[0]);
+	}
+	if (m_VtxDesc.Normal)
+	{
+		load(XMM3, &scale_factors[m_VtxAttr.NormalFormat + 1]);
+	}
+
+	const u64 tc[8] = {
+		m_VtxDesc.Tex0Coord, m_VtxDesc.Tex1Coord, m_VtxDesc.Tex2Coord, m_VtxDesc.Tex3Coord,
+		m_VtxDesc.Tex4Coord, m_VtxDesc.Tex5Coord, m_VtxDesc.Tex6Coord, m_VtxDesc.Tex7Coord,
+	};
+	if (m_VtxAttr.ByteDequant)
+	{
+		for (int i = 0; i < 8; i++)
+		{
+			if (tc[i] && m_VtxAttr.texCoord[i].Format != FORMAT_FLOAT)
+			{
+				load(texcoord_scale_regs[i], &scale_factors[5 + i]);
+			}
+		}
+	}
+}
+
+int VertexLoaderX64::ReadVertex(const OpArg* vertex_data, u64 attribute, int format, int count_in, int count_out, bool dequantize, AttributeFormat* native_format, X64Reg scaling_register)
 {
 	static const __m128i shuffle_lut[5][3] = {
 		{ _mm_set_epi32(0xFFFFFFFFL, 0xFFFFFFFFL, 0xFFFFFFFFL, 0xFFFFFF00L),  // 1x u8
@@ -110,7 +177,9 @@ int VertexLoaderX64::ReadVertex(OpArg data, u64 attribute, int format, int count
 	X64Reg coords = XMM0;
 	int elem_size = 1 << (format / 2);
 	int load_bytes = elem_size * count_in;
-	OpArg dest = MDisp(dst_reg, m_dst_ofs);
+	OpArg data = vertex_data[0];
+	OpArg dest = GetVertexDest(0);
+	OpArg pair_dest = GetVertexDest(1);
 
 	native_format->components = count_out;
 	native_format->enable = true;
@@ -122,6 +191,51 @@ int VertexLoaderX64::ReadVertex(OpArg data, u64 attribute, int format, int count
 	if (attribute == DIRECT)
 		m_src_ofs += load_bytes;
 
+	if (m_vertices == 2)
+	{
+		// One vertex in each 128-bit lane, none of the shuffles and conversions crosses lanes
+		if (load_bytes > 8)
+		{
+			VMOVDQU(128, coords, data);
+			VINSERTI128(YMM0, YMM0, vertex_data[1], 1);
+		}
+		else
+		{
+			if (load_bytes > 4)
+			{
+				VMOVQ_xmm(coords, data);
+				VMOVQ_xmm(XMM1, vertex_data[1]);
+			}
+			else
+			{
+				VMOVD_xmm(coords, data);
+				VMOVD_xmm(XMM1, vertex_data[1]);
+			}
+			VINSERTI128(YMM0, YMM0, R(XMM1), 1);
+		}
+		VBROADCASTF128(YMM1, MPIC(&shuffle_lut[format][count_in - 1]));
+		VPSHUFB(256, YMM0, YMM0, R(YMM1));
+
+		// Sign-extend.
+		if (format == FORMAT_BYTE)
+			VPSRAD(256, YMM0, YMM0, 24);
+		if (format == FORMAT_SHORT)
+			VPSRAD(256, YMM0, YMM0, 16);
+
+		if (format != FORMAT_FLOAT)
+		{
+			VCVTDQ2PS(256, YMM0, R(YMM0));
+
+			if (dequantize)
+				VMULPS(256, YMM0, YMM0, R(scaling_register));
+		}
+
+		StoreVertex(dest, coords, count_out, true);
+		VEXTRACTI128(R(XMM1), YMM0, 1);
+		StoreVertex(pair_dest, XMM1, count_out, true);
+		return load_bytes;
+	}
+
 	if (cpu_info.bSSSE3)
 	{
 		if (load_bytes > 8)
@@ -235,17 +349,22 @@ int VertexLoaderX64::ReadVertex(OpArg data, u64 attribute, int format, int count
 			MULPS(coords, R(scaling_register));
 	}
 
+	StoreVertex(dest, coords, count_out, false);
+
+	return load_bytes;
+}
+
+void VertexLoaderX64::StoreVertex(OpArg dest, X64Reg coords, int count_out, bool avx)
+{
 	switch (count_out)
 	{
-	case 1: MOVSS(dest, coords); break;
-	case 2: MOVLPS(dest, coords); break;
-	case 3: MOVUPS(dest, coords); break;
+	case 1: avx ? VMOVSS(dest, coords) : MOVSS(dest, coords); break;
+	case 2: avx ? VMOVLPS(dest, coords) : MOVLPS(dest, coords); break;
+	case 3: avx ? VMOVUPS(128, dest, coords) : MOVUPS(dest, coords); break;
 	}
-
-	return load_bytes;
 }
 
-void VertexLoaderX64::ReadColor(OpArg data, u64 attribute, int format)
+int VertexLoaderX64::ReadColor(OpArg data, OpArg dest, int format)
 {
 	int load_bytes = 0;
 	switch (format)
@@ -256,7 +375,7 @@ void VertexLoaderX64::ReadColor(OpArg data, u64 attribute, int format)
 		MOV(32, R(scratch1), data);
 		if (format != FORMAT_32B_8888)
 			OR(32, R(scratch1), Imm32(0xFF000000));
-		MOV(32, MDisp(dst_reg, m_dst_ofs), R(scratch1));
+		MOV(32, dest, R(scratch1));
 		load_bytes = 3 + (format != FORMAT_24B_888);
 		break;
 
@@ -297,7 +416,7 @@ void VertexLoaderX64::ReadColor(OpArg data, u64 attribute, int format)
 		}
 
 		OR(32, R(scratch1), Imm32(0x000000FF));
-		SwapAndStore(32, MDisp(dst_reg, m_dst_ofs), scratch1);
+		SwapAndStore(32, dest, scratch1);
 		load_bytes = 2;
 		break;
 
@@ -325,7 +444,7 @@ void VertexLoaderX64::ReadColor(OpArg data, u64 attribute, int format)
 		MOV(32, R(scratch2), R(scratch1));
 		SHL(32, R(scratch1), Imm8(4));
 		OR(32, R(scratch1), R(scratch2));
-		SwapAndStore(32, MDisp(dst_reg, m_dst_ofs), scratch1);
+		SwapAndStore(32, dest, scratch1);
 		load_bytes = 2;
 		break;
 
@@ -359,61 +478,17 @@ void VertexLoaderX64::ReadColor(OpArg data, u64 attribute, int format)
 		AND(32, R(scratch1), Imm32(0x03030303));
 		OR(32, R(scratch1), R(scratch2));
 
-		SwapAndStore(32, MDisp(dst_reg, m_dst_ofs), scratch1);
+		SwapAndStore(32, dest, scratch1);
 		load_bytes = 3;
 		break;
 	}
-	if (attribute == DIRECT)
-		m_src_ofs += load_bytes;
+	return load_bytes;
 }
 
-void VertexLoaderX64::GenerateVertexLoader()
+void VertexLoaderX64::GenerateVertexBody()
 {
-	BitSet32 regs = { src_reg, dst_reg, scratch1, scratch2, scratch3, count_reg, skipped_reg, base_reg };
-	regs &= ABI_ALL_CALLEE_SAVED;
-	ABI_PushRegistersAndAdjustStack(regs, 0);
-
-	// Backup count since we're going to count it down.
-	PUSH(32, R(ABI_PARAM3));
-
-	// ABI_PARAM3 is one of the lower registers, so free it for scratch2.
-	MOV(32, R(count_reg), R(ABI_PARAM3));
-
-	MOV(64, R(base_reg), R(ABI_PARAM4));
-	// Load Contants into registers outside the main loop to reduce memory overhead
-	if (m_VtxAttr.PosFormat != FORMAT_FLOAT && m_VtxAttr.ByteDequant)
-	{
-		MOVAPD(XMM2, MPIC(&scale_factors[0]));
-	}
-	if (m_VtxDesc.Normal)
-	{
-		MOVAPD(XMM3, MPIC(&scale_factors[m_VtxAttr.NormalFormat + 1]));
-	}
-
-	const u64 tc[8] = {
-		m_VtxDesc.Tex0Coord, m_VtxDesc.Tex1Coord, m_VtxDesc.Tex2Coord, m_VtxDesc.Tex3Coord,
-		m_VtxDesc.Tex4Coord, m_VtxDesc.Tex5Coord, m_VtxDesc.Tex6Coord, m_VtxDesc.Tex7Coord,
-	};
-	const X64Reg treg[8] = {
-		XMM4, XMM5, XMM6, XMM7,
-		XMM8, XMM9, XMM10, XMM11,
-	};
-
-	if (m_VtxAttr.ByteDequant)
-	{
-		for (int i = 0; i < 8; i++)
-		{
-			if (tc[i] && m_VtxAttr.texCoord[i].Format != FORMAT_FLOAT)
-			{
-				MOVAPD(treg[i], MPIC(&scale_factors[5 + i]));
-			}
-		}
-	}
-
-	if (m_VtxDesc.Position & MASKINDEXED)
-		XOR(32, R(skipped_reg), R(skipped_reg));
-
-	const u8* loop_start = GetCodePtr();
+	m_src_ofs = 0;
+	m_dst_ofs = 0;
 
 	if (m_VtxDesc.PosMatIdx)
 	{
@@ -431,7 +506,9 @@ void VertexLoaderX64::GenerateVertexLoader()
 			texmatidx_ofs[i] = m_src_ofs++;
 	}
 
-	OpArg data = GetVertexAddr(ARRAY_POSITION, m_VtxDesc.Position);
+	OpArg data[2];
+	for (int v = 0; v < m_vertices; v++)
+		data[v] = GetVertexAddr(ARRAY_POSITION, m_VtxDesc.Position, v);
 	ReadVertex(data, m_VtxDesc.Position, m_VtxAttr.PosFormat, m_VtxAttr.PosElements + 2, 3,
 		m_VtxAttr.ByteDequant, &m_native_vtx_decl.position, XMM2);
 
@@ -441,12 +518,17 @@ void VertexLoaderX64::GenerateVertexLoader()
 		{
 			if (!i || m_VtxAttr.NormalIndex3)
 			{
-				data = GetVertexAddr(ARRAY_NORMAL, m_VtxDesc.Normal);
 				int elem_size = 1 << (m_VtxAttr.NormalFormat / 2);
-				data.AddMemOffset(i * elem_size * 3);
+				for (int v = 0; v < m_vertices; v++)
+				{
+					data[v] = GetVertexAddr(ARRAY_NORMAL, m_VtxDesc.Normal, v);
+					data[v].AddMemOffset(i * elem_size * 3);
+				}
 			}
-			data.AddMemOffset(ReadVertex(data, m_VtxDesc.Normal, m_VtxAttr.NormalFormat, 3, 3,
-				true, &m_native_vtx_decl.normals[i], XMM3));
+			int load_bytes = ReadVertex(data, m_VtxDesc.Normal, m_VtxAttr.NormalFormat, 3, 3,
+				true, &m_native_vtx_decl.normals[i], XMM3);
+			for (int v = 0; v < m_vertices; v++)
+				data[v].AddMemOffset(load_bytes);
 		}
 
 		m_native_components |= VB_HAS_NRM0;
@@ -459,8 +541,12 @@ void VertexLoaderX64::GenerateVertexLoader()
 	{
 		if (col[i])
 		{
-			data = GetVertexAddr(ARRAY_COLOR + i, col[i]);
-			ReadColor(data, col[i], m_VtxAttr.color[i].Comp);
+			// Colors are converted in GPRs, one vertex after the other
+			int load_bytes = 0;
+			for (int v = 0; v < m_vertices; v++)
+				load_bytes = ReadColor(GetVertexAddr(ARRAY_COLOR + i, col[i], v), GetVertexDest(v), m_VtxAttr.color[i].Comp);
+			if (col[i] == DIRECT)
+				m_src_ofs += load_bytes;
 			m_native_components |= VB_HAS_COL0 << i;
 			m_native_vtx_decl.colors[i].components = 4;
 			m_native_vtx_decl.colors[i].enable = true;
@@ -470,14 +556,19 @@ void VertexLoaderX64::GenerateVertexLoader()
 		}
 	}
 
+	const u64 tc[8] = {
+		m_VtxDesc.Tex0Coord, m_VtxDesc.Tex1Coord, m_VtxDesc.Tex2Coord, m_VtxDesc.Tex3Coord,
+		m_VtxDesc.Tex4Coord, m_VtxDesc.Tex5Coord, m_VtxDesc.Tex6Coord, m_VtxDesc.Tex7Coord,
+	};
 	for (int i = 0; i < 8; i++)
 	{
 		int elements = m_VtxAttr.texCoord[i].Elements + 1;
 		if (tc[i])
 		{
-			data = GetVertexAddr(ARRAY_TEXCOORD0 + i, tc[i]);
+			for (int v = 0; v < m_vertices; v++)
+				data[v] = GetVertexAddr(ARRAY_TEXCOORD0 + i, tc[i], v);
 			ReadVertex(data, tc[i], m_VtxAttr.texCoord[i].Format, elements, tm[i] ? 2 : elements,
-				m_VtxAttr.ByteDequant, &m_native_vtx_decl.texcoords[i], treg[i]);
+				m_VtxAttr.ByteDequant, &m_native_vtx_decl.texcoords[i], texcoord_scale_regs[i]);
 			m_native_components |= VB_HAS_UV0 << i;
 		}
 		if (tm[i])
@@ -486,39 +577,86 @@ void VertexLoaderX64::GenerateVertexLoader()
 			m_native_vtx_decl.texcoords[i].components = 3;
 			m_native_vtx_decl.texcoords[i].enable = true;
 			m_native_vtx_decl.texcoords[i].type = FORMAT_FLOAT;
-			MOVZX(64, 8, scratch1, MDisp(src_reg, texmatidx_ofs[i]));
-			if (tc[i])
-			{
-				CVTSI2SS(XMM0, R(scratch1));
-				MOVSS(MDisp(dst_reg, m_dst_ofs), XMM0);
-				m_dst_ofs += sizeof(float);
-			}
-			else
-			{
+			if (!tc[i])
 				m_native_vtx_decl.texcoords[i].offset = m_dst_ofs;
-				PXOR(XMM0, R(XMM0));
-				CVTSI2SS(XMM0, R(scratch1));
-				SHUFPS(XMM0, R(XMM0), 0x45); // 000X -> 0X00
-				MOVUPS(MDisp(dst_reg, m_dst_ofs), XMM0);
-				m_dst_ofs += sizeof(float) * 3;
+			for (int v = 0; v < m_vertices; v++)
+			{
+				OpArg dest = GetVertexDest(v);
+				MOVZX(64, 8, scratch1, MDisp(src_reg, texmatidx_ofs[i] + v * m_VertexSize));
+				if (m_vertices == 2)
+				{
+					VCVTSI2SS(XMM0, XMM0, R(scratch1));
+					if (!tc[i])
+					{
+						MOV(64, dest, Imm32(0));
+						dest.AddMemOffset(2 * sizeof(float));
+					}
+					VMOVSS(dest, XMM0);
+				}
+				else if (tc[i])
+				{
+					CVTSI2SS(XMM0, R(scratch1));
+					MOVSS(dest, XMM0);
+				}
+				else
+				{
+					PXOR(XMM0, R(XMM0));
+					CVTSI2SS(XMM0, R(scratch1));
+					SHUFPS(XMM0, R(XMM0), 0x45); // 000X -> 0X00
+					MOVUPS(dest, XMM0);
+				}
 			}
+			m_dst_ofs += sizeof(float) * (tc[i] ? 1 : 3);
 		}
 	}
-	if (m_VtxDesc.PosMatIdx)
-	{
-		MOVZX(32, 8, scratch1, MDisp(src_reg, 0));
-	}
-	else
+	for (int v = 0; v < m_vertices; v++)
 	{
-		MOV(32, R(scratch1), MPIC(&g_main_cp_state.matrix_index_a));
+		if (m_VtxDesc.PosMatIdx)
+		{
+			MOVZX(32, 8, scratch1, MDisp(src_reg, v * m_VertexSize));
+		}
+		else
+		{
+			MOV(32, R(scratch1), MPIC(&g_main_cp_state.matrix_index_a));
+		}
+		AND(32, R(scratch1), Imm8(0x3F));
+		MOV(32, GetVertexDest(v), R(scratch1));
 	}
-	AND(32, R(scratch1), Imm8(0x3F));
-	MOV(32, MDisp(dst_reg, m_dst_ofs), R(scratch1));
 	m_native_vtx_decl.posmtx.components = 4;
 	m_native_vtx_decl.posmtx.enable = true;
 	m_native_vtx_decl.posmtx.offset = m_dst_ofs;
 	m_native_vtx_decl.posmtx.type = FORMAT_UBYTE;
 	m_dst_ofs += sizeof(u32);
+}
+
+void VertexLoaderX64::GenerateVertexLoader()
+{
+	BitSet32 regs = { src_reg, dst_reg, scratch1, scratch2, scratch3, count_reg, skipped_reg, base_reg };
+	regs &= ABI_ALL_CALLEE_SAVED;
+	ABI_PushRegistersAndAdjustStack(regs, 0);
+
+	// Backup count since we're going to count it down.
+	PUSH(32, R(ABI_PARAM3));
+
+	// ABI_PARAM3 is one of the lower registers, so free it for scratch2.
+	MOV(32, R(count_reg), R(ABI_PARAM3));
+
+	MOV(64, R(base_reg), R(ABI_PARAM4));
+	// Load Contants into registers outside the main loop to reduce memory overhead
+	LoadScaleFactors(false);
+
+	if (m_VtxDesc.Position & MASKINDEXED)
+		XOR(32, R(skipped_reg), R(skipped_reg));
+
+	// With AVX2, pairs of vertices are loaded by a second loop. This one is left for
+	// an odd last vertex and for pairs with a skipped vertex.
+	FixupBranch to_pairs;
+	if (m_avx2)
+		to_pairs = J(true);
+
+	const u8* loop_start = GetCodePtr();
+	m_vertices = 1;
+	GenerateVertexBody();
 
 	// Prepare for the next vertex.
 
@@ -527,8 +665,13 @@ void VertexLoaderX64::GenerateVertexLoader()
 	ADD(64, R(src_reg), Imm32(m_src_ofs));
 
 	SUB(32, R(count_reg), Imm8(1));
-	J_CC(CC_NZ, loop_start);
+	FixupBranch next_pair;
+	if (m_avx2)
+		next_pair = J_CC(CC_NZ, true);
+	else
+		J_CC(CC_NZ, loop_start);
 
+	const u8* loop_end = GetCodePtr();
 	// Get the original count.
 	POP(32, R(ABI_RETURN));
 
@@ -539,7 +682,7 @@ void VertexLoaderX64::GenerateVertexLoader()
 		SUB(32, R(ABI_RETURN), R(skipped_reg));
 		RET();
 
-		SetJumpTarget(m_skip_vertex);
+		SetJumpTarget(m_skip_vertex[0]);
 		ADD(32, R(skipped_reg), Imm8(1));
 		JMP(cont);
 	}
@@ -550,6 +693,40 @@ void VertexLoaderX64::GenerateVertexLoader()
 	m_native_stride = m_dst_ofs;
 	m_VertexSize = m_src_ofs;
 	m_native_vtx_decl.stride = m_native_stride;
+
+	if (!m_avx2)
+		return;
+
+	// Fill the upper lanes of the scale factors again, the single vertex loop cleared them
+	SetJumpTarget(to_pairs);
+	SetJumpTarget(next_pair);
+	LoadScaleFactors(true);
+
+	const u8* pair_start = GetCodePtr();
+	CMP(32, R(count_reg), Imm8(2));
+	FixupBranch single = J_CC(CC_B, true);
+
+	// Nothing is written before both position indices are checked, a pair with a
+	// skipped vertex goes through the single vertex loop instead.
+	m_vertices = 2;
+	GenerateVertexBody();
+
+	ADD(64, R(dst_reg), Imm32(2 * m_native_stride));
+	ADD(64, R(src_reg), Imm32(2 * m_VertexSize));
+	SUB(32, R(count_reg), Imm8(2));
+	JMP(pair_start, true);
+
+	SetJumpTarget(single);
+	if (m_VtxDesc.Position & MASKINDEXED)
+	{
+		SetJumpTarget(m_skip_vertex[0]);
+		SetJumpTarget(m_skip_vertex[1]);
+	}
+	// Dirty upper lanes would slow down the SSE code of the single vertex loop and the caller
+	VZEROUPPER();
+	TEST(32, R(count_reg), R(count_reg));
+	J_CC(CC_NZ, loop_start);
+	JMP(loop_end, true);
 }
 
 bool VertexLoaderX64::EnvironmentIsSupported()
@@ -573,5 +750,49 @@ int VertexLoaderX64::RunVertices(const VertexLoaderParameters &parameters)
 		scale_factors[12] = _mm_set_ps1(fractionTable[vat.g2.Tex7Frac]);
 	}
 	m_numLoadedVertices += parameters.count;
-	return ((int(*)(const u8* src, u8* dst, int count, const void*))region)(parameters.source, parameters.destination, parameters.count, memory_base_ptr);
+	if (parameters.count >= PARALLEL_MIN_VERTICES && g_ActiveConfig.bParallelVertexLoading)
+		return RunVerticesParallel(parameters);
+	return RunRange(parameters.source, parameters.destination, parameters.count);
+}
+
+int VertexLoaderX64::RunRange(const u8* src, u8* dst, int count)
+{
+	return ((int(*)(const u8* src, u8* dst, int count, const void*))region)(src, dst, count, memory_base_ptr);
+}
+
+// The generated code keeps nothing from one vertex to the next. It reads the source,
+// the vertex arrays and the scale factors, which don't change during a draw, and writes
+// the output of its own vertices only: the 16 byte stores of three components are
+// overwritten by the next component, and the last one of every vertex, the posmtx, is
+// a 4 byte store. So the vertices of a draw can be converted in ranges, in any order.
+// Unlike the software loader, which keeps the vertex being converted in
+// g_PipelineState and updates the bounding box as it goes.
+int VertexLoaderX64::RunVerticesParallel(const VertexLoaderParameters &parameters)
+{
+	const int ranges = (parameters.count + PARALLEL_RANGE_VERTICES - 1) / PARALLEL_RANGE_VERTICES;
+	std::vector<int> written(ranges);
+	Common::ThreadPool::Loop([&](int lower, int upper) {
+		for (int range = lower; range < upper; range++)
+		{
+			const int first = range * PARALLEL_RANGE_VERTICES;
+			written[range] = RunRange(parameters.source + first * m_VertexSize,
+				parameters.destination + first * m_native_stride,
+				std::min(PARALLEL_RANGE_VERTICES, parameters.count - first));
+		}
+	}, 0, ranges);
+
+	// Vertices with a position index of -1 are skipped, the ranges after one of them
+	// move down to close the gap like the vertices of a single call would
+	u8* dst = parameters.destination;
+	int count = 0;
+	for (int range = 0; range < ranges; range++)
+	{
+		const u8* range_dst = parameters.destination + range * PARALLEL_RANGE_VERTICES * m_native_stride;
+		const size_t size = written[range] * m_native_stride;
+		if (dst != range_dst)
+			memmove(dst, range_dst, size);
+		dst += size;
+		count += written[range];
+	}
+	return count;
 }
@@ -4,7 +4,7 @@
 class VertexLoaderX64 : public VertexLoaderBase, public Gen::X64CodeBlock
 {
 public:
-	VertexLoaderX64(const TVtxDesc& vtx_desc, const VAT& vtx_att);
+	VertexLoaderX64(const TVtxDesc& vtx_desc, const VAT& vtx_att, bool avx2_vertex_pairs);
 
 protected:
 	bool IsInitialized() override
@@ -16,9 +16,18 @@ protected:
 private:
 	u32 m_src_ofs = 0;
 	u32 m_dst_ofs = 0;
-	Gen::FixupBranch m_skip_vertex;
-	Gen::OpArg GetVertexAddr(int array, u64 attribute);
-	int ReadVertex(Gen::OpArg data, u64 attribute, int format, int count_in, int count_out, bool dequantize, AttributeFormat* native_format, Gen::X64Reg scaling_register);
-	void ReadColor(Gen::OpArg data, u64 attribute, int format);
+	// Vertices converted by the code being generated, 2 in the AVX2 loop
+	int m_vertices = 1;
+	bool m_avx2 = false;
+	Gen::FixupBranch m_skip_vertex[2];
+	Gen::OpArg GetVertexAddr(int array, u64 attribute, int vertex);
+	Gen::OpArg GetVertexDest(int vertex);
+	void LoadScaleFactors(bool broadcast);
+	int ReadVertex(const Gen::OpArg* data, u64 attribute, int format, int count_in, int count_out, bool dequantize, AttributeFormat* native_format, Gen::X64Reg scaling_register);
+	void StoreVertex(Gen::OpArg dest, Gen::X64Reg coords, int count_out, bool avx);
+	int ReadColor(Gen::OpArg data, Gen::OpArg dest, int format);
+	void GenerateVertexBody();
 	void GenerateVertexLoader();
+	int RunRange(const u8* src, u8* dst, int count);
+	int RunVerticesParallel(const VertexLoaderParameters &parameters);
 };
@@ -10,6 +10,7 @@
 #include "VideoBackends/DX11/VideoBackend.h"
 #include "VideoBackends/D3D12/VideoBackend.h"
 #endif
+#include "VideoBackends/Null/VideoBackend.h"
 #include "VideoBackends/OGL/VideoBackend.h"
 #include "VideoBackends/Software/VideoBackend.h"
 #ifndef __APPLE__
@@ -28,7 +29,7 @@ static VideoBackendBase* s_default_backend = nullptr;
 
 void VideoBackendBase::PopulateList()
 {
-	// D3D11 > D3D12 > D3D9 > OGL > VULKAN > SW
+	// D3D11 > D3D12 > D3D9 > OGL > VULKAN > SW > NULL
 #ifdef _WIN32
 	if (IsWindowsVistaOrGreater())
 	{
@@ -48,8 +49,11 @@ void VideoBackendBase::PopulateList()
 #ifndef __APPLE__
 	g_available_video_backends.push_back(std::make_unique<Vulkan::VideoBackend>());
 #endif
-	// Disable software video backend as is currently not working
+	// The software backend stays out of the list, VideoSoftware::Initialize uses g_renderer before
+	// Video_Prepare creates it. Until that is fixed its rasterizer, tiles included, is only
+	// used as a library by the unit tests.
 	//g_available_video_backends.push_back(std::make_unique<SW::VideoSoftware>());
+	g_available_video_backends.push_back(std::make_unique<Null::VideoBackend>());
 
 	for (auto& backend : g_available_video_backends)
 	{
@@ -51,6 +51,7 @@ VideoConfig::VideoConfig()
 	bTexDeposterize = false;
 	iTexScalingType = 0;
 	iTexScalingFactor = 2;
+	bTexScalingAsync = false;
 	backend_info.bSupportsMultithreading = false;
 	backend_info.bSupportsInternalResolutionFrameDumps = false;
 	bEnableValidationLayer = false;
@@ -83,6 +84,7 @@ void VideoConfig::Load(const std::string& ini_file)
 	settings->Get("BlackFrameInsertion", &iBlackFrameInsertion, BFI_OFF);
 	settings->Get("BlackFrameInsertionBIR", &iBlackFrameInsertionBIR, BFIR_30);
 	settings->Get("SafeTextureCacheColorSamples", &iSafeTextureCache_ColorSamples, 128);
+	settings->Get("TextureWriteWatch", &bTextureWriteWatch, false);
 	settings->Get("ShowFPS", &bShowFPS, false);
 	settings->Get("ShowNetPlayPing", &bShowNetPlayPing, false);
 	settings->Get("ShowNetPlayMessages", &bShowNetPlayMessages, false);
@@ -93,7 +95,6 @@ void VideoConfig::Load(const std::string& ini_file)
 	settings->Get("OverlayStats", &bOverlayStats, false);
 	settings->Get("OverlayProjStats", &bOverlayProjStats, false);
 	settings->Get("DumpTextures", &bDumpTextures, 0);
-	settings->Get("DumpVertexLoader", &bDumpVertexLoaders, 0);
 	settings->Get("HiresTextures", &bHiresTextures, 0);
 	settings->Get("HiresMaterialMaps", &bHiresMaterialMaps, 0);
 	settings->Get("HiresMaterialMapsBuild", &bHiresMaterialMapsBuild, false);
@@ -132,10 +133,15 @@ void VideoConfig::Load(const std::string& ini_file)
 	settings->Get("DisableFog", &bDisableFog, 0);
 	settings->Get("SSAA", &bSSAA, false);
 	settings->Get("EnableOpenCL", &bEnableOpenCL, false);
+	settings->Get("OMPDecoder", &bOMPDecoder, true);
+	settings->Get("ParallelVertexLoading", &bParallelVertexLoading, true);
+	settings->Get("AVX2VertexPairs", &bAVX2VertexPairs, false);
+	settings->Get("GPUParseThread", &bGPUParseThread, false);
 	settings->Get("BorderlessFullscreen", &bBorderlessFullscreen, true);
 
 	settings->Get("SWZComploc", &bZComploc, true);
 	settings->Get("SWZFreeze", &bZFreeze, true);
+	settings->Get("SWParallelRasterization", &bParallelRasterization, true);
 	settings->Get("SWDumpObjects", &bDumpObjects, false);
 	settings->Get("SWDumpTevStages", &bDumpTevStages, false);
 	settings->Get("SWDumpTevTexFetches", &bDumpTevTextureFetches, false);
@@ -158,6 +164,7 @@ void VideoConfig::Load(const std::string& ini_file)
 	enhancements->Get("TextureScalingType", &iTexScalingType, 0);
 	enhancements->Get("TextureScalingFactor", &iTexScalingFactor, 2);
 	enhancements->Get("UseDePosterize", &bTexDeposterize, true);
+	enhancements->Get("TextureScalingAsync", &bTexScalingAsync, false);
 	enhancements->Get("Tessellation", &bTessellation, 0);
 	enhancements->Get("TessellationEarlyCulling", &bTessellationEarlyCulling, 0);
 	enhancements->Get("TessellationDistance", &iTessellationDistance, 0);
@@ -186,6 +193,7 @@ void VideoConfig::Load(const std::string& ini_file)
 	hacks->Get("EnableGPUTextureDecoding", &bEnableGPUTextureDecoding, false);
 	hacks->Get("EnableComputeTextureEncoding", &bEnableComputeTextureEncoding, false);
 	hacks->Get("PredictiveFifo", &bPredictiveFifo, false);
+	hacks->Get("DisplayListCache", &bDisplayListCache, false);
 	hacks->Get("BoundingBoxMode", &iBBoxMode, (int)BBoxMode::BBoxNone);
 	hacks->Get("LastStoryEFBToRam", &bLastStoryEFBToRam, false);
 	hacks->Get("ForceLogicOpBlend", &bForceLogicOpBlend, false);
@@ -241,6 +249,7 @@ void VideoConfig::GameIniLoad()
 	CHECK_SETTING("Video_Settings", "UseRealXFB", bUseRealXFB);
 	
 	CHECK_SETTING("Video_Settings", "SafeTextureCacheColorSamples", iSafeTextureCache_ColorSamples);
+	CHECK_SETTING("Video_Settings", "TextureWriteWatch", bTextureWriteWatch);
 	CHECK_SETTING("Video_Settings", "HiresTextures", bHiresTextures);
 	CHECK_SETTING("Video_Settings", "HiresMaterialMaps", bHiresMaterialMaps);
 
@@ -291,6 +300,10 @@ void VideoConfig::GameIniLoad()
 
 	CHECK_SETTING("Video_Settings", "DisableFog", bDisableFog);
 	CHECK_SETTING("Video_Settings", "EnableOpenCL", bEnableOpenCL);
+	CHECK_SETTING("Video_Settings", "OMPDecoder", bOMPDecoder);
+	CHECK_SETTING("Video_Settings", "ParallelVertexLoading", bParallelVertexLoading);
+	CHECK_SETTING("Video_Settings", "AVX2VertexPairs", bAVX2VertexPairs);
+	CHECK_SETTING("Video_Settings", "GPUParseThread", bGPUParseThread);
 	CHECK_SETTING("Video_Settings", "BackendMultithreading", bBackendMultithreading);
 	CHECK_SETTING("Video_Settings", "CommandBufferExecuteInterval", iCommandBufferExecuteInterval);
 
@@ -306,6 +319,7 @@ void VideoConfig::GameIniLoad()
 	CHECK_SETTING("Video_Enhancements", "TextureScalingType", iTexScalingType);
 	CHECK_SETTING("Video_Enhancements", "TextureScalingFactor", iTexScalingFactor);
 	CHECK_SETTING("Video_Enhancements", "UseDePosterize", bTexDeposterize);
+	CHECK_SETTING("Video_Enhancements", "TextureScalingAsync", bTexScalingAsync);
 	CHECK_SETTING("Video_Enhancements", "Tessellation", bTessellation);
 	CHECK_SETTING("Video_Enhancements", "TessellationEarlyCulling", bTessellationEarlyCulling);
 	CHECK_SETTING("Video_Enhancements", "TessellationDistance", iTessellationDistance);
@@ -345,6 +359,7 @@ void VideoConfig::GameIniLoad()
 	CHECK_SETTING("Video", "EnableGPUTextureDecoding", bEnableGPUTextureDecoding);
 	CHECK_SETTING("Video", "EnableComputeTextureEncoding", bEnableComputeTextureEncoding);
 	CHECK_SETTING("Video", "PredictiveFifo", bPredictiveFifo);
+	CHECK_SETTING("Video_Hacks", "DisplayListCache", bDisplayListCache);
 	if (gfx_override_exists)
 		OSD::AddMessage("Warning: Opening the graphics configuration will reset settings and might cause issues!", 10000);
 }
@@ -385,8 +400,7 @@ void VideoConfig::VerifyValidity()
 			iStereoMode = 0;
 		}
 	}
-	// Disable while reimplementing predictive fifo
-	bPredictiveFifo = false;
+	// Disable while reimplementing shader prediction
 	bWaitForShaderCompilation = false;
 	if (iBBoxMode > BBoxGPU || iBBoxMode < BBoxNone)
 	{
@@ -434,6 +448,7 @@ void VideoConfig::Save(const std::string& ini_file)
 	settings->Set("BlackFrameInsertion", iBlackFrameInsertion);
 	settings->Set("BlackFrameInsertionBIR", iBlackFrameInsertionBIR);
 	settings->Set("SafeTextureCacheColorSamples", iSafeTextureCache_ColorSamples);
+	settings->Set("TextureWriteWatch", bTextureWriteWatch);
 	settings->Set("ShowFPS", bShowFPS);
 	settings->Set("ShowNetPlayPing", bShowNetPlayPing);
 	settings->Set("ShowNetPlayMessages", bShowNetPlayMessages);
@@ -444,7 +459,6 @@ void VideoConfig::Save(const std::string& ini_file)
 	settings->Set("OverlayStats", bOverlayStats);
 	settings->Set("OverlayProjStats", bOverlayProjStats);
 	settings->Set("DumpTextures", bDumpTextures);
-	settings->Set("DumpVertexLoader", bDumpVertexLoaders);
 	settings->Set("HiresTextures", bHiresTextures);
 	settings->Set("HiresMaterialMaps", bHiresMaterialMaps);
 	settings->Set("HiresMaterialMapsBuild", bHiresMaterialMapsBuild);
@@ -484,10 +498,15 @@ void VideoConfig::Save(const std::string& ini_file)
 	settings->Set("DisableFog", bDisableFog);
 
 	settings->Set("EnableOpenCL", bEnableOpenCL);
+	settings->Set("OMPDecoder", bOMPDecoder);
+	settings->Set("ParallelVertexLoading", bParallelVertexLoading);
+	settings->Set("AVX2VertexPairs", bAVX2VertexPairs);
+	settings->Set("GPUParseThread", bGPUParseThread);
 	settings->Set("BorderlessFullscreen", bBorderlessFullscreen);
 
 	settings->Set("SWZComploc", bZComploc);
 	settings->Set("SWZFreeze", bZFreeze);
+	settings->Set("SWParallelRasterization", bParallelRasterization);
 	settings->Set("SWDumpObjects", bDumpObjects);
 	settings->Set("SWDumpTevStages", bDumpTevStages);
 	settings->Set("SWDumpTevTexFetches", bDumpTevTextureFetches);
@@ -510,6 +529,7 @@ void VideoConfig::Save(const std::string& ini_file)
 	enhancements->Set("TextureScalingType", iTexScalingType);
 	enhancements->Set("TextureScalingFactor", iTexScalingFactor);
 	enhancements->Set("UseDePosterize", bTexDeposterize);
+	enhancements->Set("TextureScalingAsync", bTexScalingAsync);
 	enhancements->Set("Tessellation", bTessellation);
 	enhancements->Set("TessellationEarlyCulling", bTessellationEarlyCulling);
 	enhancements->Set("TessellationDistance", iTessellationDistance);
@@ -538,6 +558,7 @@ void VideoConfig::Save(const std::string& ini_file)
 	hacks->Set("EnableGPUTextureDecoding", bEnableGPUTextureDecoding);
 	hacks->Set("EnableComputeTextureEncoding", bEnableComputeTextureEncoding);
 	hacks->Set("PredictiveFifo", bPredictiveFifo);
+	hacks->Set("DisplayListCache", bDisplayListCache);
 	hacks->Set("BoundingBoxMode", iBBoxMode);
 	hacks->Set("LastStoryEFBToRam", bLastStoryEFBToRam);
 	hacks->Set("ForceLogicOpBlend", bForceLogicOpBlend);
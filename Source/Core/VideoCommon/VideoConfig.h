@@ -120,7 +120,14 @@ struct VideoConfig final
 
 	// OpenCL/OpenMP
 	bool bEnableOpenCL;
+	// Decode large textures and mip chains on the thread pool
 	bool bOMPDecoder;
+	// Convert the vertices of large draws on the thread pool
+	bool bParallelVertexLoading;
+	// Convert pairs of vertices with AVX2 for every vertex format, not only the ones it is faster for
+	bool bAVX2VertexPairs;
+	// Parse the FIFO on its own thread, ahead of the GPU thread running the commands
+	bool bGPUParseThread;
 
 	// Enhancements
 	int iMultisamples;
@@ -138,6 +145,7 @@ struct VideoConfig final
 	bool bTexDeposterize;
 	int iTexScalingType;
 	int iTexScalingFactor;
+	bool bTexScalingAsync;
 	bool bTessellation;
 	bool bTessellationEarlyCulling;
 	int iTessellationDistance;
@@ -165,7 +173,6 @@ struct VideoConfig final
 
 	// Utility
 	bool bDumpTextures;
-	bool bDumpVertexLoaders;
 	bool bHiresTextures;
 	bool bHiresMaterialMaps;
 	bool bHiresMaterialMapsBuild;
@@ -191,6 +198,7 @@ struct VideoConfig final
 	bool bPerfQueriesEnable;
 	bool bFullAsyncShaderCompilation;
 	bool bPredictiveFifo;
+	bool bDisplayListCache;
 	bool bWaitForShaderCompilation;
 	bool bEnableGPUTextureDecoding;
 	bool bEnableComputeTextureEncoding;
@@ -198,6 +206,8 @@ struct VideoConfig final
 	bool bSkipEFBCopyToRam;
 	bool bCopyEFBScaled;
 	int iSafeTextureCache_ColorSamples;
+	// Only rehash textures in RAM after a write to their pages (needs fastmem)
+	bool bTextureWriteWatch;
 	int iPhackvalue[4];
 	std::string sPhackvalue[2];
 	float fAspectRatioHackW, fAspectRatioHackH;
@@ -242,6 +252,9 @@ struct VideoConfig final
 	int drawEnd;
 	bool bZComploc;
 	bool bZFreeze;
+	// Draw the tiles of the EFB on the thread pool. Only the unit tests reach it for now, the
+	// software backend isn't registered, see VideoBackendBase::PopulateList.
+	bool bParallelRasterization;
 	bool bDumpObjects;
 	bool bDumpTevStages;
 	bool bDumpTevTextureFetches;
@@ -254,7 +254,7 @@ void LoadIndexedXF(u32 val, int refarray)
 
 	u32* currData = (u32*)(&xfmem) + address;
 	u32* newData;
-	if (Fifo::UseDeterministicGPUThread())
+	if (Fifo::UsePreprocessedFifo())
 	{
 		newData = (u32*)Fifo::PopFifoAuxBuffer(size * sizeof(u32));
 	}
@@ -9,8 +9,10 @@
 
 #include "Common/CPUDetect.h"
 #include "Common/Intrinsics.h"
+#include "Common/ThreadPool.h"
 
 #include "VideoCommon/TextureDecoder.h"
+#include "VideoCommon/TextureUtil.h"
 #ifdef _WIN32
 #include "OpenCL.h"
 #include "OpenCL/OCLTextureDecoder.h"
@@ -1065,11 +1067,357 @@ static PC_TexFormat TexDecoder_Decode_real(u8 *dst, const u8 *src, u32 width, u3
 // TODO: complete SSE2 optimization of less often used texture formats.
 // TODO: refactor algorithms using _mm_loadl_epi64 unaligned loads to prefer 128-bit aligned loads.
 
+// AVX2 versions of the RGBA decoders for the formats games use the most. Like the
+// SSSE3 ones they are picked at runtime, the rest of the build does not assume AVX2.
+
+// Converts the first count TLUT entries once, so decoding C4 and C8 becomes a table lookup.
+static void DecodePaletteRGBA(u32* palette, u32 count, u32 tlutaddr, TlutFormat tlutfmt)
+{
+	const u16* tlut = (const u16*)(texMem + tlutaddr);
+	for (u32 i = 0; i < count; i++)
+	{
+		if (tlutfmt == GX_TL_RGB5A3)
+			palette[i] = decode5A3RGBA(Common::swap16(tlut[i]));
+		else if (tlutfmt == GX_TL_IA8)
+			palette[i] = decodeIA8Swapped(tlut[i]);
+		else
+			palette[i] = decode565RGBA(Common::swap16(tlut[i]));
+	}
+}
+
+// Replicates each of the 8 bytes of the low qword of a lane 4 times, lane 0 gets bytes 0-3
+// and lane 1 bytes 4-7. Combined with a broadcast of a row this expands 8 intensities to 8 texels.
+AVX2_TARGET static inline __m256i ExpandRowAVX2(__m256i row)
+{
+	const __m256i mask = _mm256_setr_epi8(
+		0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3,
+		4, 4, 4, 4, 5, 5, 5, 5, 6, 6, 6, 6, 7, 7, 7, 7);
+	return _mm256_shuffle_epi8(row, mask);
+}
+
+AVX2_TARGET static void DecodeI4AVX2(u32* dst, const u8* src, u32 width, u32 height)
+{
+	const __m256i kMask_x0f = _mm256_set1_epi8(0x0f);
+	const __m256i kMask_xf0 = _mm256_set1_epi8((char)0xf0);
+	for (u32 y = 0; y < height; y += 8)
+		for (u32 x = 0; x < width; x += 8, src += 32)
+		{
+			const __m256i block = _mm256_loadu_si256((const __m256i*)src);
+			// Convert4To8 on both nibbles of every byte
+			const __m256i hi = _mm256_and_si256(block, kMask_xf0);
+			const __m256i lo = _mm256_and_si256(block, kMask_x0f);
+			const __m256i i_hi = _mm256_or_si256(hi, _mm256_srli_epi16(hi, 4));
+			const __m256i i_lo = _mm256_or_si256(lo, _mm256_slli_epi16(lo, 4));
+			// A row is 4 bytes, high nibble first. Interleaving leaves rows 0, 1, 4 and 5 in the
+			// qwords of rows0145 and the others in rows2367.
+			const __m256i rows0145 = _mm256_unpacklo_epi8(i_hi, i_lo);
+			const __m256i rows2367 = _mm256_unpackhi_epi8(i_hi, i_lo);
+
+			u32* row = dst + y * width + x;
+			_mm256_storeu_si256((__m256i*)(row + 0 * width), ExpandRowAVX2(_mm256_permute4x64_epi64(rows0145, 0x00)));
+			_mm256_storeu_si256((__m256i*)(row + 1 * width), ExpandRowAVX2(_mm256_permute4x64_epi64(rows0145, 0x55)));
+			_mm256_storeu_si256((__m256i*)(row + 2 * width), ExpandRowAVX2(_mm256_permute4x64_epi64(rows2367, 0x00)));
+			_mm256_storeu_si256((__m256i*)(row + 3 * width), ExpandRowAVX2(_mm256_permute4x64_epi64(rows2367, 0x55)));
+			_mm256_storeu_si256((__m256i*)(row + 4 * width), ExpandRowAVX2(_mm256_permute4x64_epi64(rows0145, 0xAA)));
+			_mm256_storeu_si256((__m256i*)(row + 5 * width), ExpandRowAVX2(_mm256_permute4x64_epi64(rows0145, 0xFF)));
+			_mm256_storeu_si256((__m256i*)(row + 6 * width), ExpandRowAVX2(_mm256_permute4x64_epi64(rows2367, 0xAA)));
+			_mm256_storeu_si256((__m256i*)(row + 7 * width), ExpandRowAVX2(_mm256_permute4x64_epi64(rows2367, 0xFF)));
+		}
+}
+
+AVX2_TARGET static void DecodeI8AVX2(u32* dst, const u8* src, u32 width, u32 height)
+{
+	for (u32 y = 0; y < height; y += 4)
+		for (u32 x = 0; x < width; x += 8, src += 32)
+		{
+			const __m256i block = _mm256_loadu_si256((const __m256i*)src);
+			u32* row = dst + y * width + x;
+			_mm256_storeu_si256((__m256i*)(row + 0 * width), ExpandRowAVX2(_mm256_permute4x64_epi64(block, 0x00)));
+			_mm256_storeu_si256((__m256i*)(row + 1 * width), ExpandRowAVX2(_mm256_permute4x64_epi64(block, 0x55)));
+			_mm256_storeu_si256((__m256i*)(row + 2 * width), ExpandRowAVX2(_mm256_permute4x64_epi64(block, 0xAA)));
+			_mm256_storeu_si256((__m256i*)(row + 3 * width), ExpandRowAVX2(_mm256_permute4x64_epi64(block, 0xFF)));
+		}
+}
+
+// Looks up 8 indices (bytes) in a 16 entry palette held in two registers
+AVX2_TARGET static inline __m256i LookupPalette16AVX2(__m256i palette_lo, __m256i palette_hi, __m128i indices)
+{
+	const __m256i index = _mm256_cvtepu8_epi32(indices);
+	const __m256i upper = _mm256_cmpgt_epi32(index, _mm256_set1_epi32(7));
+	return _mm256_blendv_epi8(_mm256_permutevar8x32_epi32(palette_lo, index),
+		_mm256_permutevar8x32_epi32(palette_hi, index), upper);
+}
+
+AVX2_TARGET static void DecodeC4AVX2(u32* dst, const u8* src, u32 width, u32 height, const u32* palette)
+{
+	const __m256i kMask_x0f = _mm256_set1_epi8(0x0f);
+	const __m256i palette_lo = _mm256_loadu_si256((const __m256i*)palette);
+	const __m256i palette_hi = _mm256_loadu_si256((const __m256i*)(palette + 8));
+	for (u32 y = 0; y < height; y += 8)
+		for (u32 x = 0; x < width; x += 8, src += 32)
+		{
+			const __m256i block = _mm256_loadu_si256((const __m256i*)src);
+			// Same layout as for I4
+			const __m256i hi = _mm256_and_si256(_mm256_srli_epi16(block, 4), kMask_x0f);
+			const __m256i lo = _mm256_and_si256(block, kMask_x0f);
+			const __m256i rows0145 = _mm256_unpacklo_epi8(hi, lo);
+			const __m256i rows2367 = _mm256_unpackhi_epi8(hi, lo);
+			const __m128i rows01 = _mm256_castsi256_si128(rows0145);
+			const __m128i rows23 = _mm256_castsi256_si128(rows2367);
+			const __m128i rows45 = _mm256_extracti128_si256(rows0145, 1);
+			const __m128i rows67 = _mm256_extracti128_si256(rows2367, 1);
+
+			u32* row = dst + y * width + x;
+			_mm256_storeu_si256((__m256i*)(row + 0 * width), LookupPalette16AVX2(palette_lo, palette_hi, rows01));
+			_mm256_storeu_si256((__m256i*)(row + 1 * width), LookupPalette16AVX2(palette_lo, palette_hi, _mm_srli_si128(rows01, 8)));
+			_mm256_storeu_si256((__m256i*)(row + 2 * width), LookupPalette16AVX2(palette_lo, palette_hi, rows23));
+			_mm256_storeu_si256((__m256i*)(row + 3 * width), LookupPalette16AVX2(palette_lo, palette_hi, _mm_srli_si128(rows23, 8)));
+			_mm256_storeu_si256((__m256i*)(row + 4 * width), LookupPalette16AVX2(palette_lo, palette_hi, rows45));
+			_mm256_storeu_si256((__m256i*)(row + 5 * width), LookupPalette16AVX2(palette_lo, palette_hi, _mm_srli_si128(rows45, 8)));
+			_mm256_storeu_si256((__m256i*)(row + 6 * width), LookupPalette16AVX2(palette_lo, palette_hi, rows67));
+			_mm256_storeu_si256((__m256i*)(row + 7 * width), LookupPalette16AVX2(palette_lo, palette_hi, _mm_srli_si128(rows67, 8)));
+		}
+}
+
+AVX2_TARGET static void DecodeC8AVX2(u32* dst, const u8* src, u32 width, u32 height, const u32* palette)
+{
+	for (u32 y = 0; y < height; y += 4)
+		for (u32 x = 0; x < width; x += 8, src += 32)
+			for (u32 iy = 0; iy < 4; iy++)
+			{
+				const __m256i index = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(src + 8 * iy)));
+				_mm256_storeu_si256((__m256i*)(dst + (y + iy) * width + x),
+					_mm256_i32gather_epi32((const int*)palette, index, 4));
+			}
+}
+
+// The 4x4 formats decode a block to rows 0 and 2 (low and high lane) and rows 1 and 3.
+struct BlockIA8AVX2
+{
+	static const u32 BLOCK_SIZE = 32;
+	AVX2_TARGET static inline void Decode(const u8* src, __m256i* rows02, __m256i* rows13)
+	{
+		// IA8 to IIIA, the lanes hold rows 0-1 and 2-3
+		const __m256i mask_lo = _mm256_setr_epi8(
+			1, 1, 1, 0, 3, 3, 3, 2, 5, 5, 5, 4, 7, 7, 7, 6,
+			1, 1, 1, 0, 3, 3, 3, 2, 5, 5, 5, 4, 7, 7, 7, 6);
+		const __m256i mask_hi = _mm256_setr_epi8(
+			9, 9, 9, 8, 11, 11, 11, 10, 13, 13, 13, 12, 15, 15, 15, 14,
+			9, 9, 9, 8, 11, 11, 11, 10, 13, 13, 13, 12, 15, 15, 15, 14);
+		const __m256i block = _mm256_loadu_si256((const __m256i*)src);
+		*rows02 = _mm256_shuffle_epi8(block, mask_lo);
+		*rows13 = _mm256_shuffle_epi8(block, mask_hi);
+	}
+};
+
+struct BlockRGB5A3AVX2
+{
+	static const u32 BLOCK_SIZE = 32;
+	AVX2_TARGET static inline void Decode(const u8* src, __m256i* rows02, __m256i* rows13)
+	{
+		const __m256i kMaskSwap16 = _mm256_setr_epi8(
+			1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+			1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+		const __m256i kMask_x1f = _mm256_set1_epi16(0x1f);
+		const __m256i kMask_x0f = _mm256_set1_epi16(0x0f);
+		const __m256i val = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i*)src), kMaskSwap16);
+		const __m256i rgb555 = _mm256_srai_epi16(val, 15);
+
+		// RGB555, alpha = 0xFF
+		const __m256i r5 = _mm256_and_si256(_mm256_srli_epi16(val, 10), kMask_x1f);
+		const __m256i g5 = _mm256_and_si256(_mm256_srli_epi16(val, 5), kMask_x1f);
+		const __m256i b5 = _mm256_and_si256(val, kMask_x1f);
+		// RGB4A3
+		const __m256i a3 = _mm256_and_si256(_mm256_srli_epi16(val, 12), _mm256_set1_epi16(0x7));
+		const __m256i r4 = _mm256_and_si256(_mm256_srli_epi16(val, 8), kMask_x0f);
+		const __m256i g4 = _mm256_and_si256(_mm256_srli_epi16(val, 4), kMask_x0f);
+		const __m256i b4 = _mm256_and_si256(val, kMask_x0f);
+
+		const __m256i r = _mm256_blendv_epi8(_mm256_or_si256(_mm256_slli_epi16(r4, 4), r4),
+			_mm256_or_si256(_mm256_slli_epi16(r5, 3), _mm256_srli_epi16(r5, 2)), rgb555);
+		const __m256i g = _mm256_blendv_epi8(_mm256_or_si256(_mm256_slli_epi16(g4, 4), g4),
+			_mm256_or_si256(_mm256_slli_epi16(g5, 3), _mm256_srli_epi16(g5, 2)), rgb555);
+		const __m256i b = _mm256_blendv_epi8(_mm256_or_si256(_mm256_slli_epi16(b4, 4), b4),
+			_mm256_or_si256(_mm256_slli_epi16(b5, 3), _mm256_srli_epi16(b5, 2)), rgb555);
+		const __m256i a = _mm256_or_si256(rgb555, _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi16(a3, 5),
+			_mm256_slli_epi16(a3, 2)), _mm256_srli_epi16(a3, 1)));
+
+		const __m256i rg = _mm256_or_si256(r, _mm256_slli_epi16(g, 8));
+		const __m256i ba = _mm256_or_si256(b, _mm256_slli_epi16(a, 8));
+		*rows02 = _mm256_unpacklo_epi16(rg, ba);
+		*rows13 = _mm256_unpackhi_epi16(rg, ba);
+	}
+};
+
+struct BlockRGBA8AVX2
+{
+	static const u32 BLOCK_SIZE = 64;
+	AVX2_TARGET static inline void Decode(const u8* src, __m256i* rows02, __m256i* rows13)
+	{
+		// 32 bytes of AR followed by 32 bytes of GB, unpacking gives AGRB
+		const __m256i mask0312 = _mm256_setr_epi8(
+			2, 1, 3, 0, 6, 5, 7, 4, 10, 9, 11, 8, 14, 13, 15, 12,
+			2, 1, 3, 0, 6, 5, 7, 4, 10, 9, 11, 8, 14, 13, 15, 12);
+		const __m256i ar = _mm256_loadu_si256((const __m256i*)src);
+		const __m256i gb = _mm256_loadu_si256((const __m256i*)(src + 32));
+		*rows02 = _mm256_shuffle_epi8(_mm256_unpacklo_epi8(ar, gb), mask0312);
+		*rows13 = _mm256_shuffle_epi8(_mm256_unpackhi_epi8(ar, gb), mask0312);
+	}
+};
+
+// Two horizontally adjacent blocks are decoded at once so every row is a single 256-bit store.
+template <typename Block>
+AVX2_TARGET static void Decode4x4AVX2(u32* dst, const u8* src, u32 width, u32 height)
+{
+	for (u32 y = 0; y < height; y += 4)
+	{
+		u32 x = 0;
+		for (; x + 8 <= width; x += 8, src += 2 * Block::BLOCK_SIZE)
+		{
+			__m256i a02, a13, b02, b13;
+			Block::Decode(src, &a02, &a13);
+			Block::Decode(src + Block::BLOCK_SIZE, &b02, &b13);
+			u32* row = dst + y * width + x;
+			_mm256_storeu_si256((__m256i*)(row + 0 * width), _mm256_permute2x128_si256(a02, b02, 0x20));
+			_mm256_storeu_si256((__m256i*)(row + 1 * width), _mm256_permute2x128_si256(a13, b13, 0x20));
+			_mm256_storeu_si256((__m256i*)(row + 2 * width), _mm256_permute2x128_si256(a02, b02, 0x31));
+			_mm256_storeu_si256((__m256i*)(row + 3 * width), _mm256_permute2x128_si256(a13, b13, 0x31));
+		}
+		if (x < width)
+		{
+			__m256i rows02, rows13;
+			Block::Decode(src, &rows02, &rows13);
+			u32* row = dst + y * width + x;
+			_mm_storeu_si128((__m128i*)(row + 0 * width), _mm256_castsi256_si128(rows02));
+			_mm_storeu_si128((__m128i*)(row + 1 * width), _mm256_castsi256_si128(rows13));
+			_mm_storeu_si128((__m128i*)(row + 2 * width), _mm256_extracti128_si256(rows02, 1));
+			_mm_storeu_si128((__m128i*)(row + 3 * width), _mm256_extracti128_si256(rows13, 1));
+			src += Block::BLOCK_SIZE;
+		}
+	}
+}
+
+// Decodes the four DXT1 blocks of an 8x8 CMPR block together: each 128-bit lane computes
+// the palettes of two blocks, the texels are then looked up in registers.
+// Gives the same results as the SSE2 decoder, including its rounding.
+AVX2_TARGET static void DecodeCMPRAVX2(u32* dst, const u8* src, u32 width, u32 height)
+{
+	// Big endian colors to 32-bit: block a color 0, block a color 1, block b color 0, block b color 1
+	const __m256i kColorShuffle = _mm256_setr_epi8(
+		1, 0, -1, -1, 3, 2, -1, -1, 9, 8, -1, -1, 11, 10, -1, -1,
+		1, 0, -1, -1, 3, 2, -1, -1, 9, 8, -1, -1, 11, 10, -1, -1);
+	const __m256i kMask_x1f = _mm256_set1_epi32(0x1f);
+	const __m256i kMask_x3f = _mm256_set1_epi32(0x3f);
+	const __m256i kAlpha = _mm256_set1_epi32(0xFF000000);
+	const __m256i kTopSelectors = _mm256_setr_epi32(1, 1, 1, 1, 3, 3, 3, 3);
+	const __m256i kBottomSelectors = _mm256_setr_epi32(5, 5, 5, 5, 7, 7, 7, 7);
+	// The first texel of a row is in the top bits of the selector byte
+	const __m256i kSelectorShifts = _mm256_setr_epi32(6, 4, 2, 0, 6, 4, 2, 0);
+	const __m256i kSecondBlock = _mm256_setr_epi32(0, 0, 0, 0, 4, 4, 4, 4);
+	for (u32 y = 0; y < height; y += 8)
+		for (u32 x = 0; x < width; x += 8, src += 32)
+		{
+			const __m256i blocks = _mm256_loadu_si256((const __m256i*)src);
+			const __m256i c565 = _mm256_shuffle_epi8(blocks, kColorShuffle);
+
+			const __m256i r5 = _mm256_and_si256(_mm256_srli_epi32(c565, 11), kMask_x1f);
+			const __m256i g6 = _mm256_and_si256(_mm256_srli_epi32(c565, 5), kMask_x3f);
+			const __m256i b5 = _mm256_and_si256(c565, kMask_x1f);
+			const __m256i r = _mm256_or_si256(_mm256_slli_epi32(r5, 3), _mm256_srli_epi32(r5, 2));
+			const __m256i g = _mm256_or_si256(_mm256_slli_epi32(g6, 2), _mm256_srli_epi32(g6, 4));
+			const __m256i b = _mm256_or_si256(_mm256_slli_epi32(b5, 3), _mm256_srli_epi32(b5, 2));
+			const __m256i rgba = _mm256_or_si256(_mm256_or_si256(r, _mm256_slli_epi32(g, 8)),
+				_mm256_or_si256(_mm256_slli_epi32(b, 16), kAlpha));
+
+			// Both colors of both blocks in the lane, as 16-bit channels
+			const __m256i color0 = _mm256_shuffle_epi32(rgba, _MM_SHUFFLE(2, 0, 2, 0));
+			const __m256i color1 = _mm256_shuffle_epi32(rgba, _MM_SHUFFLE(3, 1, 3, 1));
+			const __m256i color0_16 = _mm256_unpacklo_epi8(color0, _mm256_setzero_si256());
+			const __m256i color1_16 = _mm256_unpacklo_epi8(color1, _mm256_setzero_si256());
+
+			// color0 > color1: RGB2 = RGB0 + delta, RGB3 = RGB1 - delta, delta = (diff >> 1) - (diff >> 3)
+			const __m256i diff = _mm256_sub_epi16(color1_16, color0_16);
+			const __m256i delta = _mm256_sub_epi16(_mm256_srai_epi16(diff, 1), _mm256_srai_epi16(diff, 3));
+			const __m256i color2_4 = _mm256_packus_epi16(_mm256_add_epi16(color0_16, delta), _mm256_add_epi16(color0_16, delta));
+			const __m256i color3_4 = _mm256_packus_epi16(_mm256_sub_epi16(color1_16, delta), _mm256_sub_epi16(color1_16, delta));
+			// Otherwise RGB2 = avg(RGB0, RGB1), RGB3 = RGB1 but transparent
+			const __m256i average = _mm256_avg_epu16(color0_16, color1_16);
+			const __m256i color2_3 = _mm256_packus_epi16(average, average);
+			const __m256i color3_3 = _mm256_and_si256(color1, _mm256_set1_epi32(0x00FFFFFF));
+
+			const __m256i four_colors = _mm256_cmpgt_epi32(_mm256_shuffle_epi32(c565, _MM_SHUFFLE(2, 0, 2, 0)),
+				_mm256_shuffle_epi32(c565, _MM_SHUFFLE(3, 1, 3, 1)));
+			const __m256i color2 = _mm256_blendv_epi8(color2_3, color2_4, four_colors);
+			const __m256i color3 = _mm256_blendv_epi8(color3_3, color3_4, four_colors);
+
+			// Palettes of the blocks: lane 0 holds blocks 0 and 1 (top), lane 1 blocks 2 and 3
+			const __m256i color23 = _mm256_unpacklo_epi32(color2, color3);
+			const __m256i palette_a = _mm256_unpacklo_epi64(rgba, color23);
+			const __m256i palette_b = _mm256_unpackhi_epi64(rgba, color23);
+			const __m256i top = _mm256_permute2x128_si256(palette_a, palette_b, 0x20);
+			const __m256i bottom = _mm256_permute2x128_si256(palette_a, palette_b, 0x31);
+
+			const __m256i top_selectors = _mm256_permutevar8x32_epi32(blocks, kTopSelectors);
+			const __m256i bottom_selectors = _mm256_permutevar8x32_epi32(blocks, kBottomSelectors);
+			u32* row = dst + y * width + x;
+			for (u32 iy = 0; iy < 4; iy++)
+			{
+				const __m256i shifts = _mm256_add_epi32(kSelectorShifts, _mm256_set1_epi32(8 * iy));
+				const __m256i top_index = _mm256_or_si256(_mm256_and_si256(
+					_mm256_srlv_epi32(top_selectors, shifts), _mm256_set1_epi32(3)), kSecondBlock);
+				const __m256i bottom_index = _mm256_or_si256(_mm256_and_si256(
+					_mm256_srlv_epi32(bottom_selectors, shifts), _mm256_set1_epi32(3)), kSecondBlock);
+				_mm256_storeu_si256((__m256i*)(row + iy * width), _mm256_permutevar8x32_epi32(top, top_index));
+				_mm256_storeu_si256((__m256i*)(row + (iy + 4) * width), _mm256_permutevar8x32_epi32(bottom, bottom_index));
+			}
+		}
+}
+
+// Returns false if there is no AVX2 decoder for the format.
+AVX2_TARGET static bool TexDecoder_Decode_RGBA_AVX2(u32* dst, const u8* src, u32 width, u32 height, u32 texformat, u32 tlutaddr, TlutFormat tlutfmt)
+{
+	alignas(32) u32 palette[256];
+	switch (texformat)
+	{
+	case GX_TF_I4:
+		DecodeI4AVX2(dst, src, width, height);
+		return true;
+	case GX_TF_I8:
+		DecodeI8AVX2(dst, src, width, height);
+		return true;
+	case GX_TF_IA8:
+		Decode4x4AVX2<BlockIA8AVX2>(dst, src, width, height);
+		return true;
+	case GX_TF_RGB5A3:
+		Decode4x4AVX2<BlockRGB5A3AVX2>(dst, src, width, height);
+		return true;
+	case GX_TF_RGBA8:
+		Decode4x4AVX2<BlockRGBA8AVX2>(dst, src, width, height);
+		return true;
+	case GX_TF_C4:
+		DecodePaletteRGBA(palette, 16, tlutaddr, tlutfmt);
+		DecodeC4AVX2(dst, src, width, height, palette);
+		return true;
+	case GX_TF_C8:
+		DecodePaletteRGBA(palette, 256, tlutaddr, tlutfmt);
+		DecodeC8AVX2(dst, src, width, height, palette);
+		return true;
+	case GX_TF_CMPR:
+		DecodeCMPRAVX2(dst, src, width, height);
+		return true;
+	default:
+		return false;
+	}
+}
+
 static PC_TexFormat TexDecoder_Decode_RGBA(u32 * dst, const u8 * src, u32 width, u32 height, u32 texformat, u32 tlutaddr, TlutFormat tlutfmt)
 {
 	const u32 Wsteps4 = (width + 3) / 4;
 	const u32 Wsteps8 = (width + 7) / 8;
 
+	if (cpu_info.bAVX2 && TexDecoder_Decode_RGBA_AVX2(dst, src, width, height, texformat, tlutaddr, tlutfmt))
+		return PC_TEX_FMT_RGBA32;
+
 	switch (texformat)
 	{
 	case GX_TF_C4:
@@ -2119,30 +2467,15 @@ void TexDecoder_SetTexFmtOverlayOptions(bool enable, bool center)
 	TexFmt_Overlay_Center = center;
 }
 
-PC_TexFormat TexDecoder_Decode(u8 *dst, const u8 *src, u32 width, u32 height, u32 texformat, u32 tlutaddr, TlutFormat tlutfmt, bool rgbaOnly, bool compressed_supported)
+static PC_TexFormat TexDecoder_Decode_CPU(u8 *dst, const u8 *src, u32 width, u32 height, u32 texformat, u32 tlutaddr, TlutFormat tlutfmt, bool rgbaOnly, bool compressed_supported)
 {
-	PC_TexFormat retval = PC_TEX_FMT_NONE;
-#ifdef _WIN32
-	retval = TexDecoder_Decode_OpenCL(dst, src,
-		width, height, texformat, tlutaddr, tlutfmt, rgbaOnly);
-
-	if (retval == PC_TEX_FMT_NONE)
-	{
-#endif
-		if (rgbaOnly)
-		{
-			retval = TexDecoder_Decode_RGBA((u32*)dst, src, width, height, texformat, tlutaddr, tlutfmt);
-		}
-		else
-		{
-			retval = TexDecoder_Decode_real(dst, src, width, height, texformat, tlutaddr, tlutfmt, compressed_supported);
-		}
-#ifdef _WIN32
-	}
-#endif
-	if ((!TexFmt_Overlay_Enable) || (retval == PC_TEX_FMT_NONE))
-		return retval;
+	if (rgbaOnly)
+		return TexDecoder_Decode_RGBA((u32*)dst, src, width, height, texformat, tlutaddr, tlutfmt);
+	return TexDecoder_Decode_real(dst, src, width, height, texformat, tlutaddr, tlutfmt, compressed_supported);
+}
 
+static void DrawTexFmtOverlay(u8 *dst, u32 width, u32 height, u32 texformat, PC_TexFormat retval)
+{
 	u32 w = std::min(width, 40u);
 	u32 h = std::min(height, 10u);
 
@@ -2210,7 +2543,91 @@ PC_TexFormat TexDecoder_Decode(u8 *dst, const u8 *src, u32 width, u32 height, u3
 		xoff += xcnt;
 		fmt++;
 	}
+}
+
+PC_TexFormat TexDecoder_Decode(u8 *dst, const u8 *src, u32 width, u32 height, u32 texformat, u32 tlutaddr, TlutFormat tlutfmt, bool rgbaOnly, bool compressed_supported)
+{
+	PC_TexFormat retval = PC_TEX_FMT_NONE;
+#ifdef _WIN32
+	retval = TexDecoder_Decode_OpenCL(dst, src,
+		width, height, texformat, tlutaddr, tlutfmt, rgbaOnly);
+
+	if (retval == PC_TEX_FMT_NONE)
+#endif
+		retval = TexDecoder_Decode_CPU(dst, src, width, height, texformat, tlutaddr, tlutfmt, rgbaOnly, compressed_supported);
+
+	if (TexFmt_Overlay_Enable && retval != PC_TEX_FMT_NONE)
+		DrawTexFmtOverlay(dst, width, height, texformat, retval);
+	return retval;
+}
+
+// Below this many texels in total the levels are decoded on the calling thread,
+// waking up the workers would cost more than it saves.
+static const u32 PARALLEL_DECODE_MIN_TEXELS = 256 * 256;
+// Minimum amount of texels of the first level a thread decodes in one go
+static const u32 PARALLEL_DECODE_BAND_TEXELS = 16 * 1024;
+
+PC_TexFormat TexDecoder_DecodeLevels(const TexDecoderLevel *levels, u32 count, u32 texformat, u32 tlutaddr, TlutFormat tlutfmt, bool rgbaOnly, bool compressed_supported)
+{
+	if (count == 0)
+		return PC_TEX_FMT_NONE;
+#ifdef _WIN32
+	// The OpenCL decoder only takes whole textures
+	if (g_ActiveConfig.bEnableOpenCL)
+	{
+		PC_TexFormat retval = PC_TEX_FMT_NONE;
+		for (u32 i = 0; i < count; i++)
+			retval = TexDecoder_Decode(levels[i].dst, levels[i].src, levels[i].width, levels[i].height, texformat, tlutaddr, tlutfmt, rgbaOnly, compressed_supported);
+		return retval;
+	}
+#endif
+	const PC_TexFormat retval = rgbaOnly ? PC_TEX_FMT_RGBA32 : GetPC_TexFormat(texformat, tlutfmt, compressed_supported);
+	const u32 block_height = TexDecoder_GetBlockHeightInTexels(texformat);
+	u32 texels = 0;
+	int block_rows = 0;
+	for (u32 i = 0; i < count; i++)
+	{
+		texels += levels[i].width * levels[i].height;
+		block_rows += (int)((levels[i].height + block_height - 1) / block_height);
+	}
 
+	// The block rows of all the levels are numbered one after the other, so a band
+	// covers a part of a large level or several small levels at once.
+	auto decode_rows = [&](int lower, int upper)
+	{
+		int first_row = 0;
+		for (u32 i = 0; i < count && first_row < upper; i++)
+		{
+			const TexDecoderLevel& level = levels[i];
+			const int rows = (int)((level.height + block_height - 1) / block_height);
+			const int begin = std::max(lower, first_row);
+			const int end = std::min(upper, first_row + rows);
+			if (begin < end)
+			{
+				const u32 y = (u32)(begin - first_row) * block_height;
+				const u32 height = std::min((u32)(end - first_row) * block_height, level.height) - y;
+				TexDecoder_Decode_CPU(level.dst + TextureUtil::GetTextureSizeInBytes(level.width, y, retval),
+					level.src + TexDecoder_GetTextureSizeInBytes(level.width, y, texformat),
+					level.width, height, texformat, tlutaddr, tlutfmt, rgbaOnly, compressed_supported);
+			}
+			first_row += rows;
+		}
+	};
+	if (texels < PARALLEL_DECODE_MIN_TEXELS)
+	{
+		decode_rows(0, block_rows);
+	}
+	else
+	{
+		const int min_band = std::max(1, (int)(PARALLEL_DECODE_BAND_TEXELS / (levels[0].width * block_height)));
+		Common::ThreadPool::Loop(decode_rows, 0, block_rows, min_band);
+	}
+
+	if (TexFmt_Overlay_Enable)
+	{
+		for (u32 i = 0; i < count; i++)
+			DrawTexFmtOverlay(levels[i].dst, levels[i].width, levels[i].height, texformat, retval);
+	}
 	return retval;
 }
 
@@ -0,0 +1,171 @@
+// Copyright 2013 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <chrono>
+#include <cstdio>
+#include <set>
+#include <vector>
+
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CPUDetect.h"
+#include "Common/CommonTypes.h"
+#include "Common/Hash.h"
+
+namespace
+{
+std::vector<u8> MakeData(size_t size, u32 seed)
+{
+  std::vector<u8> data(size);
+  for (u8& byte : data)
+  {
+    seed = seed * 1103515245 + 12345;
+    byte = static_cast<u8>(seed >> 24);
+  }
+  return data;
+}
+
+class HashTest : public testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    m_sse2 = cpu_info.bSSE2;
+    m_avx2 = cpu_info.bAVX2;
+  }
+  void TearDown() override
+  {
+    cpu_info.bSSE2 = m_sse2;
+    cpu_info.bAVX2 = m_avx2;
+  }
+
+  bool m_sse2;
+  bool m_avx2;
+};
+}
+
+TEST_F(HashTest, StripeHashVariantsMatch)
+{
+  const std::vector<u8> data = MakeData(70000, 1);
+  const u32 lengths[] = {0, 1, 7, 8, 63, 64, 65, 127, 128, 129, 1023, 1024, 1025, 4096, 65536, 70000};
+  const u32 sample_counts[] = {0, 1, 3, 128};
+  for (u32 length : lengths)
+  {
+    for (u32 samples : sample_counts)
+    {
+      cpu_info.bSSE2 = false;
+      cpu_info.bAVX2 = false;
+      const u64 generic = GetStripeHash64(data.data(), length, samples);
+      if (m_sse2)
+      {
+        cpu_info.bSSE2 = true;
+        EXPECT_EQ(generic, GetStripeHash64(data.data(), length, samples))
+            << "SSE2 " << length << " bytes, " << samples << " samples";
+      }
+      if (m_avx2)
+      {
+        cpu_info.bAVX2 = true;
+        EXPECT_EQ(generic, GetStripeHash64(data.data(), length, samples))
+            << "AVX2 " << length << " bytes, " << samples << " samples";
+      }
+    }
+  }
+}
+
+TEST_F(HashTest, StripeHashSeesEveryBit)
+{
+  // Covers a few stripes, the overlapping last stripe and a scramble
+  for (u32 length : {5u, 64u, 100u, 1100u})
+  {
+    std::vector<u8> data = MakeData(length, length);
+    std::set<u64> hashes = {GetStripeHash64(data.data(), length, 0)};
+    for (u32 bit = 0; bit < length * 8; ++bit)
+    {
+      data[bit / 8] ^= 1 << (bit % 8);
+      hashes.insert(GetStripeHash64(data.data(), length, 0));
+      data[bit / 8] ^= 1 << (bit % 8);
+    }
+    EXPECT_EQ(length * 8 + 1, hashes.size()) << length << " bytes";
+    // The length is part of the hash too
+    EXPECT_NE(GetStripeHash64(data.data(), length, 0), GetStripeHash64(data.data(), length - 1, 0));
+  }
+}
+
+TEST_F(HashTest, SampledStripeHashCoversMoreThanCRC)
+{
+  // A 64x64 RGBA8 texture with the default SafeTextureCacheColorSamples
+  const u32 length = 16384;
+  const u32 samples = 128;
+  std::vector<u8> data = MakeData(length, 2);
+  const u64 stripe_base = GetStripeHash64(data.data(), length, samples);
+  const u64 crc_base = GetCRC32(data.data(), length, samples);
+  u32 stripe_seen = 0;
+  u32 crc_seen = 0;
+  u32 first_missed = length;
+  u32 last_seen = 0;
+  for (u32 i = 0; i < length; ++i)
+  {
+    data[i] ^= 0x10;
+    if (GetStripeHash64(data.data(), length, samples) != stripe_base)
+    {
+      ++stripe_seen;
+      last_seen = i;
+    }
+    else if (first_missed == length)
+    {
+      first_missed = i;
+    }
+    if (GetCRC32(data.data(), length, samples) != crc_base)
+      ++crc_seen;
+    data[i] ^= 0x10;
+  }
+  // CRC32 reads 8 bytes per sample, or nothing at all without SSE4.2
+  EXPECT_GE(stripe_seen, 8 * samples);
+  EXPECT_GE(stripe_seen, crc_seen);
+  // The samples are spread over the whole texture
+  EXPECT_LT(first_missed, length / 2);
+  EXPECT_EQ(length - 1, last_seen);
+}
+
+TEST_F(HashTest, Throughput)
+{
+  struct Function
+  {
+    const char* name;
+    u64 (*hash)(const u8* src, u32 len, u32 samples);
+    bool sse2;
+    bool avx2;
+  };
+  const Function functions[] = {
+      {"Murmur3", &GetMurmurHash3, m_sse2, m_avx2},   {"CRC32", &GetCRC32, m_sse2, m_avx2},
+      {"Stripe", &GetStripeHash64, false, false},      {"Stripe SSE2", &GetStripeHash64, true, false},
+      {"Stripe AVX2", &GetStripeHash64, m_sse2, true},
+  };
+  const std::vector<u8> data = MakeData(4 * 1024 * 1024, 3);
+  for (u32 length : {1024u, 64u * 1024, 4u * 1024 * 1024})
+  {
+    for (u32 samples : {0u, 128u})
+    {
+      for (const Function& function : functions)
+      {
+        if ((function.sse2 && !m_sse2) || (function.avx2 && !m_avx2))
+          continue;
+        // Without SSE4.2 in the build, CRC32 returns 0 without looking at the data
+        if (!function.hash(data.data(), length, samples))
+          continue;
+        cpu_info.bSSE2 = function.sse2;
+        cpu_info.bAVX2 = function.avx2;
+        const u32 iterations = 256 * 1024 * 1024 / length;
+        u64 sum = 0;
+        const auto start = std::chrono::steady_clock::now();
+        for (u32 i = 0; i < iterations; ++i)
+          sum += function.hash(data.data(), length, samples);
+        const std::chrono::duration<double> time = std::chrono::steady_clock::now() - start;
+        printf("%-12s %8u bytes %4u samples %10.1f ns %8.2f GB/s (%016llx)\n", function.name,
+               length, samples, time.count() * 1e9 / iterations,
+               (double)length * iterations / time.count() / 1e9, (unsigned long long)sum);
+      }
+    }
+  }
+}
@@ -1018,6 +1018,51 @@ AVX_RRM_TEST(VPANDN, "dqword")
 AVX_RRM_TEST(VPOR, "dqword")
 AVX_RRM_TEST(VPXOR, "dqword")
 
+TEST_F(x64EmitterTest, AVX_VectorSize)
+{
+  emitter->VMOVDQU(256, YMM1, MatR(R12));
+  emitter->VPSHUFB(256, YMM0, YMM0, MatR(RAX));
+  emitter->VPSHUFB(128, XMM9, XMM2, R(XMM10));
+  emitter->VPSRAD(256, YMM3, YMM11, 24);
+  emitter->VCVTDQ2PS(256, YMM0, R(YMM8));
+  emitter->VMULPS(256, YMM0, YMM0, R(YMM2));
+  emitter->VMULPS(128, XMM0, XMM0, R(XMM12));
+  emitter->VMOVUPS(256, MatR(RDI), YMM5);
+  emitter->VMOVUPS(128, MatR(RDI), XMM13);
+  emitter->VBROADCASTF128(YMM10, MatR(RBX));
+  emitter->VINSERTI128(YMM0, YMM0, R(XMM1), 1);
+  emitter->VEXTRACTI128(R(XMM9), YMM0, 1);
+  emitter->VZEROUPPER();
+  // Bochs names all operands of the lane instructions ymm
+  ExpectDisassembly("vmovdqu ymm1, qqword ptr ds:[r12] "
+                    "vpshufb ymm0, ymm0, qqword ptr ds:[rax] "
+                    "vpshufb xmm9, xmm2, xmm10 "
+                    "vpsrad ymm3, ymm11, 0x18 "
+                    "vcvtdq2ps ymm0, ymm8 "
+                    "vmulps ymm0, ymm0, ymm2 "
+                    "vmulps xmm0, xmm0, xmm12 "
+                    "vmovups qqword ptr ds:[rdi], ymm5 "
+                    "vmovups dqword ptr ds:[rdi], xmm13 "
+                    "vbroadcastf128 ymm10, qqword ptr ds:[rbx] "
+                    "vinserti128 ymm0, ymm0, ymm1, 0x01 "
+                    "vextracti128 ymm9, ymm0, 0x01 "
+                    "vzeroupper ");
+}
+
+TEST_F(x64EmitterTest, AVX_ScalarMoves)
+{
+  emitter->VMOVD_xmm(XMM1, MatR(R12));
+  emitter->VMOVQ_xmm(XMM9, MatR(RAX));
+  emitter->VMOVSS(MDisp(RDI, 8), XMM10);
+  emitter->VMOVLPS(MatR(RDI), XMM0);
+  emitter->VCVTSI2SS(XMM0, XMM0, R(RAX));
+  ExpectDisassembly("vmovd xmm1, dword ptr ds:[r12] "
+                    "vmovq xmm9, qword ptr ds:[rax] "
+                    "vmovss dword ptr ds:[rdi+8], xmm10 "
+                    "vmovlps qword ptr ds:[rdi], xmm0 "
+                    "vcvtsi2ss xmm0, xmm0, eax ");
+}
+
 #define FMA3_TEST(Name, P, packed)                                                                 \
   AVX_RRM_TEST(Name##132##P##S, packed ? "dqword" : "dword")                                       \
   AVX_RRM_TEST(Name##213##P##S, packed ? "dqword" : "dword")                                       \
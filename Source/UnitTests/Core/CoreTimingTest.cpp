@@ -6,7 +6,9 @@
 
 #include <array>
 #include <bitset>
+#include <vector>
 
+#include "Common/ChunkFile.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
@@ -318,3 +320,72 @@ TEST(CoreTiming, Overclocking)
   SConfig::GetInstance().m_OCFactor = 1.0;
   AdvanceAndCheck(4, MAX_SLICE_LENGTH);
 }
+
+namespace SliceEndTest
+{
+static CoreTiming::EventType* s_cb_vi = nullptr;
+static int s_vi_count = 0;
+static std::vector<u8> s_state;
+static int s_state_downcount = 0;
+
+static void SaveState()
+{
+  u8* ptr = nullptr;
+  PointerWrap p(&ptr, PointerWrap::MODE_MEASURE);
+  CoreTiming::DoState(p);
+  s_state.resize(reinterpret_cast<size_t>(ptr));
+  ptr = s_state.data();
+  p.SetMode(PointerWrap::MODE_WRITE);
+  CoreTiming::DoState(p);
+  s_state_downcount = PowerPC::ppcState.downcount;
+}
+
+static void VICallback(u64 userdata, s64 lateness)
+{
+  EXPECT_EQ(0, lateness);
+  // Like State::UpdateRewind, which is called by the VI before it reschedules itself
+  if (++s_vi_count == 1)
+    CoreTiming::RunAtSliceEnd(SaveState);
+  CoreTiming::ScheduleEvent(1000 - lateness, s_cb_vi);
+}
+}
+
+TEST(CoreTiming, SnapshotAtSliceEnd)
+{
+  using namespace SliceEndTest;
+
+  ScopeInit guard;
+
+  s_cb_vi = CoreTiming::RegisterEvent("VICallback", VICallback);
+  s_vi_count = 0;
+  s_state.clear();
+
+  // Enter slice 0
+  CoreTiming::Advance();
+  CoreTiming::ScheduleEvent(1000, s_cb_vi);
+
+  PowerPC::ppcState.downcount = 0;
+  CoreTiming::Advance();
+  EXPECT_EQ(1, s_vi_count);
+  ASSERT_FALSE(s_state.empty());
+  EXPECT_EQ(1000, s_state_downcount);
+
+  PowerPC::ppcState.downcount = 0;
+  CoreTiming::Advance();
+  EXPECT_EQ(2, s_vi_count);
+  EXPECT_EQ(2000u, CoreTiming::GetTicks());
+
+  // Load the snapshot, the VI is still scheduled and fires where it did after the snapshot
+  u8* ptr = s_state.data();
+  PointerWrap p(&ptr, PointerWrap::MODE_READ);
+  CoreTiming::DoState(p);
+  PowerPC::ppcState.downcount = s_state_downcount;
+  EXPECT_EQ(1000u, CoreTiming::GetTicks());
+  EXPECT_NE(std::string::npos, CoreTiming::GetScheduledEventsSummary().find("VICallback"));
+
+  PowerPC::ppcState.downcount = 0;
+  CoreTiming::Advance();
+  EXPECT_EQ(3, s_vi_count);
+  EXPECT_EQ(2000u, CoreTiming::GetTicks());
+  EXPECT_EQ(1000, PowerPC::ppcState.downcount);
+}
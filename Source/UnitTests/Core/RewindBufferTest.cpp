@@ -0,0 +1,150 @@
+// Copyright 2013 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <chrono>
+#include <cstdio>
+#include <lzo/lzo1x.h>
+#include <vector>
+
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CommonTypes.h"
+#include "Core/RewindBuffer.h"
+
+namespace
+{
+// Looks like a savestate: a few small registers up front and a large memory
+// area of which only a few pages change between two snapshots.
+std::vector<u8> MakeState(size_t size)
+{
+  std::vector<u8> state(size);
+  u32 seed = 0x12345678;
+  for (size_t i = 0; i < state.size(); ++i)
+  {
+    seed = seed * 1103515245 + 12345;
+    state[i] = static_cast<u8>(seed >> 24);
+  }
+  return state;
+}
+
+void Mutate(std::vector<u8>& state, u32 seed)
+{
+  for (int i = 0; i < 20; ++i)
+  {
+    seed = seed * 1103515245 + 12345;
+    const size_t offset = seed % state.size();
+    for (size_t j = offset; j < std::min(offset + 512, state.size()); ++j)
+      state[j] ^= static_cast<u8>(seed >> 16) | 1;
+  }
+}
+
+class RewindBufferTest : public testing::Test
+{
+protected:
+  void SetUp() override { ASSERT_EQ(LZO_E_OK, lzo_init()); }
+};
+}
+
+TEST_F(RewindBufferTest, PopRestoresEverySnapshot)
+{
+  State::RewindBuffer buffer(1024 * 1024 * 1024);
+  std::vector<std::vector<u8>> history;
+  std::vector<u8> state = MakeState(3 * 1024 * 1024 + 123);
+  for (u32 i = 0; i < 12; ++i)
+  {
+    Mutate(state, i);
+    // The size changes now and then, like states with variable length sections
+    if (i % 4 == 1)
+      state.resize(state.size() + 70000, static_cast<u8>(i));
+    else if (i % 4 == 3)
+      state.resize(state.size() - 100000);
+    history.push_back(state);
+    std::vector<u8> snapshot(state);
+    buffer.Push(snapshot);
+  }
+
+  EXPECT_EQ(history.size(), buffer.GetSnapshotCount());
+  for (size_t i = history.size(); i-- > 0;)
+  {
+    EXPECT_TRUE(buffer.GetNewest() == history[i]) << "snapshot " << i;
+    EXPECT_EQ(i > 0, buffer.Pop());
+  }
+  EXPECT_EQ(1u, buffer.GetSnapshotCount());
+}
+
+TEST_F(RewindBufferTest, DeltasAreSmall)
+{
+  const size_t size = 24 * 1024 * 1024;
+  State::RewindBuffer buffer(1024 * 1024 * 1024);
+  std::vector<u8> state = MakeState(size);
+  for (u32 i = 0; i < 10; ++i)
+  {
+    Mutate(state, i);
+    std::vector<u8> snapshot(state);
+    buffer.Push(snapshot);
+  }
+  // 20 changed areas of 512 bytes touch at most 40 blocks per delta
+  EXPECT_LT(buffer.GetMemoryUsage(), size + 9 * 40 * 64 * 1024);
+  EXPECT_EQ(10 * size, buffer.GetUncompressedSize());
+}
+
+TEST_F(RewindBufferTest, BudgetDropsOldestSnapshots)
+{
+  const size_t size = 1024 * 1024;
+  State::RewindBuffer buffer(size + 64 * 1024);
+  std::vector<std::vector<u8>> history;
+  std::vector<u8> state = MakeState(size);
+  for (u32 i = 0; i < 50; ++i)
+  {
+    // Every snapshot changes half of the state, which doesn't compress
+    for (size_t j = (i % 2) * size / 2; j < (i % 2 + 1) * size / 2; ++j)
+      state[j] = static_cast<u8>(state[j] * 13 + i);
+    history.push_back(state);
+    std::vector<u8> snapshot(state);
+    buffer.Push(snapshot);
+    EXPECT_LE(buffer.GetMemoryUsage(), size + 64 * 1024);
+  }
+
+  const size_t count = buffer.GetSnapshotCount();
+  EXPECT_LT(count, history.size());
+  for (size_t i = 0; i < count; ++i)
+  {
+    EXPECT_TRUE(buffer.GetNewest() == history[history.size() - 1 - i]);
+    buffer.Pop();
+  }
+
+  buffer.SetMemoryBudget(0);
+  EXPECT_EQ(1u, buffer.GetSnapshotCount());
+  buffer.Clear();
+  EXPECT_TRUE(buffer.IsEmpty());
+  EXPECT_EQ(0u, buffer.GetMemoryUsage());
+}
+
+TEST_F(RewindBufferTest, Speed)
+{
+  // About the size of a Wii savestate
+  const size_t size = 96 * 1024 * 1024;
+  State::RewindBuffer buffer(1024 * 1024 * 1024);
+  std::vector<u8> state = MakeState(size);
+  std::vector<u8> snapshot;
+  const int iterations = 8;
+
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; ++i)
+  {
+    Mutate(state, i);
+    snapshot = state;
+    buffer.Push(snapshot);
+  }
+  std::chrono::duration<double, std::milli> push_time = std::chrono::steady_clock::now() - start;
+  const double ratio = (double)buffer.GetUncompressedSize() / buffer.GetMemoryUsage();
+
+  start = std::chrono::steady_clock::now();
+  for (int i = 1; i < iterations; ++i)
+    buffer.Pop();
+  std::chrono::duration<double, std::milli> pop_time = std::chrono::steady_clock::now() - start;
+
+  printf("Rewind snapshot: %8.2f ms push, %8.2f ms pop, %.1fx smaller\n",
+         push_time.count() / iterations, pop_time.count() / (iterations - 1), ratio);
+}
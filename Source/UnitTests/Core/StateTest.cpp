@@ -0,0 +1,91 @@
+// Copyright 2013 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <cstring>
+#include <lzo/lzo1x.h>
+#include <vector>
+
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CommonTypes.h"
+#include "Core/State.h"
+
+namespace
+{
+// The chunk size of the LZO stream states
+constexpr u32 IN_LEN = 128 * 1024;
+
+std::vector<u8> MakeState(size_t size)
+{
+  std::vector<u8> state(size);
+  for (size_t i = 0; i < state.size(); ++i)
+    state[i] = static_cast<u8>((i / 3) ^ (i >> 11));
+  return state;
+}
+
+// Writes the state like the LZO stream writer before the chunk table: (u32 size, LZO data)
+// chunks of IN_LEN bytes, the last chunk is written after a full one even when it is empty
+std::vector<u8> CompressLegacy(const std::vector<u8>& state)
+{
+  std::vector<u8> wrkmem(LZO1X_1_MEM_COMPRESS);
+  std::vector<u8> out(IN_LEN + IN_LEN / 16 + 64 + 3);
+  std::vector<u8> data;
+  size_t i = 0;
+  while (true)
+  {
+    const lzo_uint cur_len = std::min<size_t>(IN_LEN, state.size() - i);
+    lzo_uint out_len = 0;
+    EXPECT_EQ(LZO_E_OK, lzo1x_1_compress(state.data() + i, cur_len, out.data(), &out_len,
+                                         wrkmem.data()));
+    const u32 size = static_cast<u32>(out_len);
+    const u8* size_bytes = reinterpret_cast<const u8*>(&size);
+    data.insert(data.end(), size_bytes, size_bytes + sizeof(size));
+    data.insert(data.end(), out.begin(), out.begin() + out_len);
+    if (cur_len != IN_LEN)
+      break;
+    i += cur_len;
+  }
+  return data;
+}
+
+class StateTest : public testing::Test
+{
+protected:
+  void SetUp() override { ASSERT_EQ(LZO_E_OK, lzo_init()); }
+};
+}
+
+TEST_F(StateTest, LoadsLegacyStates)
+{
+  for (size_t size : {size_t(1), size_t(IN_LEN - 1), size_t(IN_LEN), size_t(3 * IN_LEN),
+                      size_t(3 * IN_LEN + 1000)})
+  {
+    const std::vector<u8> state = MakeState(size);
+    const std::vector<u8> data = CompressLegacy(state);
+    State::StateHeader header = {};
+    header.size = static_cast<u32>(size);
+
+    std::vector<u8> buffer(size);
+    EXPECT_TRUE(State::DecompressState(header, data, buffer)) << size;
+    EXPECT_TRUE(buffer == state) << size;
+  }
+}
+
+TEST_F(StateTest, RejectsTruncatedLegacyStates)
+{
+  const std::vector<u8> state = MakeState(3 * IN_LEN);
+  State::StateHeader header = {};
+  header.size = static_cast<u32>(state.size());
+  std::vector<u8> buffer(state.size());
+
+  // A cut off empty chunk, and a state that is larger than its chunks
+  std::vector<u8> data = CompressLegacy(state);
+  EXPECT_TRUE(State::DecompressState(header, data, buffer));
+  data.resize(data.size() - 1);
+  EXPECT_FALSE(State::DecompressState(header, data, buffer));
+
+  header.size = static_cast<u32>(4 * IN_LEN);
+  buffer.resize(header.size);
+  EXPECT_FALSE(State::DecompressState(header, CompressLegacy(state), buffer));
+}
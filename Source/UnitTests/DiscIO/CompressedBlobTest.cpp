@@ -0,0 +1,167 @@
+// Copyright 2013 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "DiscIO/Blob.h"
+
+namespace
+{
+const u32 BLOCK_SIZE = 16 * 1024;
+const u32 IMAGE_SIZE = 48 * 1024 * 1024 + 12345;
+
+bool IgnoreProgress(const std::string& text, float percent, void* arg)
+{
+  return true;
+}
+
+// Text-like data that compresses about as well as game files, with some noise
+// blocks that end up stored uncompressed and a zeroed area like scrubbed images
+std::vector<u8> MakeImage()
+{
+  std::vector<u8> image(IMAGE_SIZE);
+  u32 seed = 0x12345678;
+  for (size_t i = 0; i < image.size(); ++i)
+  {
+    seed = seed * 1103515245 + 12345;
+    const size_t block = i / BLOCK_SIZE;
+    if (block % 7 == 3)
+      image[i] = static_cast<u8>(seed >> 24);
+    else if (block % 11 == 5)
+      image[i] = 0;
+    else
+      image[i] = static_cast<u8>('a' + (seed >> 16) % 4 + (i / 64) % 8);
+  }
+  return image;
+}
+
+class CompressedBlobTest : public testing::Test
+{
+protected:
+  static void SetUpTestCase()
+  {
+    s_directory = File::CreateTempDir();
+    const std::string iso_path = s_directory + "/test.iso";
+    s_gcz_path = s_directory + "/test.gcz";
+    s_image = MakeImage();
+    ASSERT_TRUE(File::IOFile(iso_path, "wb").WriteBytes(s_image.data(), s_image.size()));
+    ASSERT_TRUE(DiscIO::CompressFileToBlob(iso_path, s_gcz_path, 0, BLOCK_SIZE, IgnoreProgress,
+                                           nullptr));
+  }
+
+  static void TearDownTestCase()
+  {
+    File::DeleteDirRecursively(s_directory);
+    std::vector<u8>().swap(s_image);
+  }
+
+  static std::unique_ptr<DiscIO::IBlobReader> OpenReader()
+  {
+    std::unique_ptr<DiscIO::IBlobReader> reader = DiscIO::CreateBlobReader(s_gcz_path);
+    EXPECT_TRUE(reader != nullptr);
+    if (reader)
+      EXPECT_EQ(DiscIO::BlobType::GCZ, reader->GetBlobType());
+    return reader;
+  }
+
+  static std::string s_directory;
+  static std::string s_gcz_path;
+  static std::vector<u8> s_image;
+};
+
+std::string CompressedBlobTest::s_directory;
+std::string CompressedBlobTest::s_gcz_path;
+std::vector<u8> CompressedBlobTest::s_image;
+}
+
+TEST_F(CompressedBlobTest, SequentialReadMatches)
+{
+  std::unique_ptr<DiscIO::IBlobReader> reader = OpenReader();
+  ASSERT_TRUE(reader != nullptr);
+  ASSERT_EQ(s_image.size(), reader->GetDataSize());
+  // Reads that do not line up with the blocks, like streamed audio does
+  const u64 read_size = 0x8000 + 0x20;
+  std::vector<u8> buffer(read_size);
+  for (u64 offset = 0; offset < s_image.size(); offset += read_size)
+  {
+    const u64 size = std::min<u64>(read_size, s_image.size() - offset);
+    ASSERT_TRUE(reader->Read(offset, size, buffer.data())) << "offset " << offset;
+    ASSERT_TRUE(std::equal(buffer.begin(), buffer.begin() + size, s_image.begin() + offset))
+        << "offset " << offset;
+  }
+}
+
+TEST_F(CompressedBlobTest, RandomReadMatches)
+{
+  std::unique_ptr<DiscIO::IBlobReader> reader = OpenReader();
+  ASSERT_TRUE(reader != nullptr);
+  std::vector<u8> buffer;
+  u32 seed = 0x87654321;
+  for (int i = 0; i < 2000; ++i)
+  {
+    seed = seed * 1103515245 + 12345;
+    const u64 offset = seed % s_image.size();
+    seed = seed * 1103515245 + 12345;
+    // Mostly short seeks so the read-ahead starts and gets cut off again
+    const u64 size = std::min<u64>((seed >> 8) % (BLOCK_SIZE * 6) + 1, s_image.size() - offset);
+    buffer.resize(size);
+    ASSERT_TRUE(reader->Read(offset, size, buffer.data())) << "offset " << offset;
+    ASSERT_TRUE(std::equal(buffer.begin(), buffer.end(), s_image.begin() + offset))
+        << "offset " << offset << " size " << size;
+  }
+}
+
+TEST_F(CompressedBlobTest, ParallelCompressionMatchesSerial)
+{
+  // Blocks finish out of order with more workers than hardware threads
+  const std::string iso_path = s_directory + "/test.iso";
+  const std::string serial_path = s_directory + "/serial.gcz";
+  const std::string parallel_path = s_directory + "/parallel.gcz";
+  ASSERT_TRUE(DiscIO::CompressFileToBlob(iso_path, serial_path, 0, BLOCK_SIZE, IgnoreProgress,
+                                         nullptr, 1));
+  ASSERT_TRUE(DiscIO::CompressFileToBlob(iso_path, parallel_path, 0, BLOCK_SIZE, IgnoreProgress,
+                                         nullptr, 8));
+
+  std::string serial, parallel, default_workers;
+  ASSERT_TRUE(File::ReadFileToString(serial_path, serial));
+  ASSERT_TRUE(File::ReadFileToString(parallel_path, parallel));
+  ASSERT_TRUE(File::ReadFileToString(s_gcz_path, default_workers));
+  ASSERT_EQ(serial.size(), parallel.size());
+  EXPECT_TRUE(serial == parallel);
+  EXPECT_TRUE(serial == default_workers);
+  File::Delete(serial_path);
+  File::Delete(parallel_path);
+}
+
+TEST_F(CompressedBlobTest, SequentialSpeed)
+{
+  // DVD thread sized reads over a fresh reader each pass, so nothing is cached
+  const u64 read_size = 0x8000;
+  const int passes = 3;
+  std::vector<u8> buffer(read_size);
+  double best = 0;
+  for (int pass = 0; pass < passes; ++pass)
+  {
+    std::unique_ptr<DiscIO::IBlobReader> reader = OpenReader();
+    ASSERT_TRUE(reader != nullptr);
+    auto start = std::chrono::steady_clock::now();
+    for (u64 offset = 0; offset < s_image.size(); offset += read_size)
+    {
+      const u64 size = std::min<u64>(read_size, s_image.size() - offset);
+      ASSERT_TRUE(reader->Read(offset, size, buffer.data()));
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    best = std::max(best, s_image.size() / (elapsed.count() * 1024 * 1024));
+  }
+  printf("GCZ sequential read: %8.2f MB/s\n", best);
+}
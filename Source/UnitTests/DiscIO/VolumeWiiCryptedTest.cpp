@@ -0,0 +1,177 @@
+// Copyright 2013 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <mbedtls/aes.h>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CommonTypes.h"
+#include "DiscIO/Blob.h"
+#include "DiscIO/VolumeWiiCrypted.h"
+
+namespace
+{
+const u64 DATA_OFFSET = 0x20000;
+const u32 CLUSTER_SIZE = 0x8000;
+const u32 CLUSTER_DATA_SIZE = 0x7C00;
+const u32 CLUSTERS = 256;
+const u8 s_key[16] = {0x0f, 0x1e, 0x2d, 0x3c, 0x4b, 0x5a, 0x69, 0x78,
+                      0x87, 0x96, 0xa5, 0xb4, 0xc3, 0xd2, 0xe1, 0xf0};
+
+class MemoryBlobReader : public DiscIO::IBlobReader
+{
+public:
+  explicit MemoryBlobReader(const std::vector<u8>& data) : m_data(data) {}
+  DiscIO::BlobType GetBlobType() const override { return DiscIO::BlobType::PLAIN; }
+  u64 GetRawSize() const override { return m_data.size(); }
+  u64 GetDataSize() const override { return m_data.size(); }
+  bool Read(u64 offset, u64 size, u8* out_ptr) override
+  {
+    if (offset + size > m_data.size())
+      return false;
+    m_bytes_read += size;
+    std::copy(m_data.begin() + offset, m_data.begin() + offset + size, out_ptr);
+    return true;
+  }
+  u64 BytesRead() const { return m_bytes_read; }
+
+private:
+  const std::vector<u8>& m_data;
+  u64 m_bytes_read = 0;
+};
+
+u32 Random(u32* seed)
+{
+  *seed = *seed * 1103515245 + 12345;
+  return *seed >> 8;
+}
+
+// A partition with random clusters, each encrypted with its own IV
+class VolumeWiiCryptedTest : public testing::Test
+{
+protected:
+  static void SetUpTestCase()
+  {
+    s_plain.resize(CLUSTERS * CLUSTER_DATA_SIZE);
+    s_image.resize(DATA_OFFSET + CLUSTERS * CLUSTER_SIZE);
+    u32 seed = 0xCAFE;
+    for (u8& byte : s_plain)
+      byte = static_cast<u8>(Random(&seed));
+    for (u64 i = DATA_OFFSET; i < s_image.size(); i++)
+      s_image[i] = static_cast<u8>(Random(&seed));
+
+    mbedtls_aes_context aes;
+    mbedtls_aes_setkey_enc(&aes, s_key, 128);
+    for (u32 cluster = 0; cluster < CLUSTERS; cluster++)
+    {
+      u8* raw = &s_image[DATA_OFFSET + cluster * CLUSTER_SIZE];
+      u8 iv[16];
+      memcpy(iv, raw + 0x3D0, sizeof(iv));
+      mbedtls_aes_crypt_cbc(&aes, MBEDTLS_AES_ENCRYPT, CLUSTER_DATA_SIZE, iv,
+                            &s_plain[cluster * CLUSTER_DATA_SIZE], raw + 0x400);
+    }
+  }
+
+  static void TearDownTestCase()
+  {
+    std::vector<u8>().swap(s_plain);
+    std::vector<u8>().swap(s_image);
+  }
+
+  void SetUp() override
+  {
+    auto reader = std::make_unique<MemoryBlobReader>(s_image);
+    m_reader = reader.get();
+    m_volume = std::make_unique<DiscIO::CVolumeWiiCrypted>(std::move(reader), 0, s_key);
+  }
+
+  void ExpectRead(u64 offset, u64 size)
+  {
+    std::vector<u8> buffer(size);
+    ASSERT_TRUE(m_volume->Read(offset, size, buffer.data(), true)) << "offset " << offset;
+    ASSERT_TRUE(std::equal(buffer.begin(), buffer.end(), s_plain.begin() + offset))
+        << "offset " << offset << " size " << size;
+  }
+
+  static std::vector<u8> s_plain;
+  static std::vector<u8> s_image;
+  MemoryBlobReader* m_reader = nullptr;
+  std::unique_ptr<DiscIO::CVolumeWiiCrypted> m_volume;
+};
+
+std::vector<u8> VolumeWiiCryptedTest::s_plain;
+std::vector<u8> VolumeWiiCryptedTest::s_image;
+}
+
+TEST_F(VolumeWiiCryptedTest, SequentialReadMatches)
+{
+  for (u64 offset = 0; offset < s_plain.size(); offset += 0x9000)
+    ExpectRead(offset, std::min<u64>(0x9000, s_plain.size() - offset));
+}
+
+TEST_F(VolumeWiiCryptedTest, RandomReadMatches)
+{
+  u32 seed = 1234;
+  for (int i = 0; i < 2000; i++)
+  {
+    const u64 offset = Random(&seed) % s_plain.size();
+    const u64 size = std::min<u64>(Random(&seed) % (CLUSTER_DATA_SIZE * 5) + 1,
+                                   s_plain.size() - offset);
+    ExpectRead(offset, size);
+  }
+}
+
+TEST_F(VolumeWiiCryptedTest, InterleavedReadsDecryptEachClusterOnce)
+{
+  // Two files streaming at the same time used to decrypt every cluster again on each switch
+  const u64 first = 0, second = s_plain.size() / 2, chunk = 0x800, length = 16 * CLUSTER_DATA_SIZE;
+  for (u64 pos = 0; pos < length; pos += chunk)
+  {
+    ExpectRead(first + pos, chunk);
+    ExpectRead(second + pos, chunk);
+  }
+  EXPECT_EQ(2 * 16 * CLUSTER_SIZE, m_reader->BytesRead());
+}
+
+TEST_F(VolumeWiiCryptedTest, Speed)
+{
+  const int passes = 4;
+  std::vector<u8> buffer(0x8000);
+  auto start = std::chrono::steady_clock::now();
+  for (int pass = 0; pass < passes; pass++)
+  {
+    // A fresh volume each pass so nothing comes from the cache
+    SetUp();
+    for (u64 offset = 0; offset < s_plain.size(); offset += buffer.size())
+    {
+      const u64 size = std::min<u64>(buffer.size(), s_plain.size() - offset);
+      ASSERT_TRUE(m_volume->Read(offset, size, buffer.data(), true));
+    }
+  }
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+  printf("Sequential decrypted read:  %8.2f MB/s\n",
+         passes * s_plain.size() / (elapsed.count() * 1024 * 1024));
+
+  // Small reads alternating between two files
+  const u64 second = s_plain.size() / 2, chunk = 0x800;
+  start = std::chrono::steady_clock::now();
+  for (int pass = 0; pass < passes; pass++)
+  {
+    SetUp();
+    for (u64 pos = 0; pos < second; pos += chunk)
+    {
+      ASSERT_TRUE(m_volume->Read(pos, chunk, buffer.data(), true));
+      ASSERT_TRUE(m_volume->Read(second + pos, chunk, buffer.data(), true));
+    }
+  }
+  elapsed = std::chrono::steady_clock::now() - start;
+  printf("Interleaved decrypted read: %8.2f MB/s\n",
+         passes * 2 * second / (elapsed.count() * 1024 * 1024));
+}
@@ -0,0 +1,312 @@
+// Copyright 2013 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <atomic>
+#include <cstring>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CommonTypes.h"
+#include "VideoBackends/Software/EfbInterface.h"
+#include "VideoBackends/Software/NativeVertexFormat.h"
+#include "VideoBackends/Software/Rasterizer.h"
+#include "VideoBackends/Software/Tev.h"
+#include "VideoCommon/BPMemory.h"
+#include "VideoCommon/VideoCommon.h"
+#include "VideoCommon/VideoConfig.h"
+
+namespace
+{
+class SWRasterizerTest : public testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    memset(&bpmem, 0, sizeof(bpmem));
+    // One stage passing the interpolated color through, blended over the EFB
+    bpmem.genMode.numcolchans = 1;
+    bpmem.tevksel[0].swap1 = 0;
+    bpmem.tevksel[0].swap2 = 1;
+    bpmem.tevksel[1].swap1 = 2;
+    bpmem.tevksel[1].swap2 = 3;
+    bpmem.combiners[0].colorC.a = TEVCOLORARG_ZERO;
+    bpmem.combiners[0].colorC.b = TEVCOLORARG_ZERO;
+    bpmem.combiners[0].colorC.c = TEVCOLORARG_ZERO;
+    bpmem.combiners[0].colorC.d = TEVCOLORARG_RASC;
+    bpmem.combiners[0].alphaC.a = TEVALPHAARG_ZERO;
+    bpmem.combiners[0].alphaC.b = TEVALPHAARG_ZERO;
+    bpmem.combiners[0].alphaC.c = TEVALPHAARG_ZERO;
+    bpmem.combiners[0].alphaC.d = TEVALPHAARG_RASA;
+    bpmem.alpha_test.comp0 = AlphaTest::ALWAYS;
+    bpmem.alpha_test.comp1 = AlphaTest::ALWAYS;
+    bpmem.zmode.testenable = 1;
+    bpmem.zmode.func = ZMode::LEQUAL;
+    bpmem.zmode.updateenable = 1;
+    bpmem.blendmode.blendenable = 1;
+    bpmem.blendmode.colorupdate = 1;
+    bpmem.blendmode.alphaupdate = 1;
+    bpmem.blendmode.srcfactor = BlendMode::SRCALPHA;
+    bpmem.blendmode.dstfactor = BlendMode::INVSRCALPHA;
+    bpmem.scissorOffset.x = 342 / 2;
+    bpmem.scissorOffset.y = 342 / 2;
+    bpmem.scissorTL.x = 342;
+    bpmem.scissorTL.y = 342;
+    bpmem.scissorBR.x = 342 + EFB_WIDTH - 1;
+    bpmem.scissorBR.y = 342 + EFB_HEIGHT - 1;
+
+    m_config = g_ActiveConfig;
+    g_ActiveConfig.bZFreeze = false;
+    g_ActiveConfig.bDumpTevStages = false;
+    g_ActiveConfig.bDumpTevTextureFetches = false;
+  }
+  void TearDown() override { g_ActiveConfig = m_config; }
+
+  void Clear()
+  {
+    u8 clear[4] = {0x40, 0x30, 0x20, 0x10};
+    for (u16 y = 0; y < EFB_HEIGHT; y++)
+    {
+      for (u16 x = 0; x < EFB_WIDTH; x++)
+      {
+        EfbInterface::SetColor(x, y, clear);
+        EfbInterface::SetDepth(x, y, 0xFFFFFF);
+      }
+    }
+  }
+
+  void Start(bool parallel)
+  {
+    g_ActiveConfig.bParallelRasterization = parallel;
+    Rasterizer::Init();
+    Rasterizer::SetScissor();
+    Clear();
+  }
+
+  // Draws overlapping triangles with random colors over the whole EFB
+  void DrawTriangles(std::mt19937& random, int count)
+  {
+    std::uniform_real_distribution<float> position(-32.0f, EFB_WIDTH + 32.0f);
+    std::uniform_real_distribution<float> depth(0.0f, 16777215.0f);
+    for (int i = 0; i < count; i++)
+    {
+      OutputVertexData v[3];
+      for (OutputVertexData& vertex : v)
+      {
+        vertex.screenPosition.x = position(random);
+        vertex.screenPosition.y = position(random) * EFB_HEIGHT / EFB_WIDTH;
+        vertex.screenPosition.z = depth(random);
+        vertex.projectedPosition.w = 1.0f;
+        for (u8& component : vertex.color[0])
+          component = (u8)random();
+      }
+      Rasterizer::DrawTriangleFrontFace(&v[0], &v[1], &v[2]);
+    }
+  }
+
+  // Draws the same overlapping triangles on a cleared EFB and reads it back
+  std::vector<u32> Draw(bool parallel)
+  {
+    Start(parallel);
+    std::mt19937 random(1234);
+    DrawTriangles(random, 300);
+    Rasterizer::Flush();
+    return ReadEfb();
+  }
+
+  std::vector<u32> ReadEfb()
+  {
+    std::vector<u32> pixels;
+    pixels.reserve(EFB_WIDTH * EFB_HEIGHT * 2);
+    for (u16 y = 0; y < EFB_HEIGHT; y++)
+    {
+      for (u16 x = 0; x < EFB_WIDTH; x++)
+      {
+        u32 color;
+        EfbInterface::GetColor(x, y, reinterpret_cast<u8*>(&color));
+        pixels.push_back(color);
+        pixels.push_back(EfbInterface::GetDepth(x, y));
+      }
+    }
+    return pixels;
+  }
+
+  VideoConfig m_config;
+};
+}
+
+static void ExpectSameEfb(const std::vector<u32>& serial, const std::vector<u32>& tiled)
+{
+  ASSERT_EQ(serial.size(), tiled.size());
+  for (size_t i = 0; i < serial.size(); i += 2)
+  {
+    ASSERT_EQ(serial[i], tiled[i]) << "color at " << i / 2 % EFB_WIDTH << "," << i / 2 / EFB_WIDTH;
+    ASSERT_EQ(serial[i + 1], tiled[i + 1])
+        << "depth at " << i / 2 % EFB_WIDTH << "," << i / 2 / EFB_WIDTH;
+  }
+}
+
+TEST_F(SWRasterizerTest, TilesMatchSerialDrawing)
+{
+  const std::vector<u32> serial = Draw(false);
+  const std::vector<u32> tiled = Draw(true);
+  ExpectSameEfb(serial, tiled);
+  size_t drawn = 0;
+  for (size_t i = 0; i < serial.size(); i += 2)
+    drawn += serial[i + 1] != 0xFFFFFF;
+  // Most of the EFB is covered, by several triangles
+  EXPECT_GT(drawn, serial.size() / 4);
+}
+
+TEST_F(SWRasterizerTest, TileSeamsAreNotShared)
+{
+  // Pixels on either side of a seam between tiles, the last pixel of a row is followed by
+  // the first of the next row, which is in the next row of tiles
+  const u16 pixels[][2][2] = {{{63, 10}, {64, 10}},
+                              {{127, 100}, {128, 100}},
+                              {{EFB_WIDTH - 1, 63}, {0, 64}}};
+  const u32 iterations = 1000000;
+  Clear();
+
+  // Two threads drawing the two sides at once, like two bands of Rasterizer::Flush. Each
+  // checks that its pixels still hold what it wrote last before writing them again.
+  std::atomic<u32> errors{0};
+  std::vector<std::thread> threads;
+  for (int side = 0; side < 2; side++)
+  {
+    threads.emplace_back([&pixels, &errors, side] {
+      for (u32 i = 1; i <= iterations; i++)
+      {
+        for (const auto& seam : pixels)
+        {
+          const u16 x = seam[side][0];
+          const u16 y = seam[side][1];
+          u8 color[4] = {0xFF, (u8)i, (u8)(i >> 8), (u8)(side + 1)};
+          if (i > 1)
+          {
+            u8 last[4];
+            EfbInterface::GetColor(x, y, last);
+            if (last[1] != (u8)(i - 1) || last[2] != (u8)((i - 1) >> 8) || last[3] != color[3] ||
+                EfbInterface::GetDepth(x, y) != ((i - 1) | (side + 1) << 20))
+            {
+              errors++;
+            }
+          }
+          EfbInterface::SetColor(x, y, color);
+          EfbInterface::SetDepth(x, y, i | (side + 1) << 20);
+        }
+      }
+    });
+  }
+  for (std::thread& thread : threads)
+    thread.join();
+  EXPECT_EQ(0u, errors.load());
+
+  for (const auto& seam : pixels)
+  {
+    for (int side = 0; side < 2; side++)
+    {
+      const u16 x = seam[side][0];
+      const u16 y = seam[side][1];
+      u8 color[4];
+      EfbInterface::GetColor(x, y, color);
+      EXPECT_EQ((u8)iterations, color[1]) << x << "," << y;
+      EXPECT_EQ((u8)(iterations >> 8), color[2]) << x << "," << y;
+      EXPECT_EQ(side + 1, color[3]) << x << "," << y;
+      EXPECT_EQ(iterations | (side + 1) << 20, EfbInterface::GetDepth(x, y)) << x << "," << y;
+    }
+  }
+}
+
+TEST_F(SWRasterizerTest, PreviousPixelReadsAreDrawnSerially)
+{
+  // Stage 0 outputs c1.a, which stage 1 only writes afterwards, so pixels see what the
+  // previous pixel left in it. Only the first pixel drawn sees the value set.
+  bpmem.genMode.numtevstages = 1;
+  bpmem.combiners[0].colorC.d = TEVCOLORARG_A1;
+  bpmem.combiners[0].alphaC.d = TEVALPHAARG_ZERO;
+  bpmem.combiners[1].colorC.a = TEVCOLORARG_ZERO;
+  bpmem.combiners[1].colorC.b = TEVCOLORARG_ZERO;
+  bpmem.combiners[1].colorC.c = TEVCOLORARG_ZERO;
+  bpmem.combiners[1].colorC.d = TEVCOLORARG_CPREV;
+  bpmem.combiners[1].alphaC.a = TEVALPHAARG_ZERO;
+  bpmem.combiners[1].alphaC.b = TEVALPHAARG_ZERO;
+  bpmem.combiners[1].alphaC.c = TEVALPHAARG_ZERO;
+  bpmem.combiners[1].alphaC.d = TEVALPHAARG_RASA;
+  bpmem.combiners[1].alphaC.dest = 2;
+  bpmem.zmode.testenable = 0;
+  bpmem.blendmode.blendenable = 0;
+
+  for (bool parallel : {false, true})
+  {
+    Start(parallel);
+    Rasterizer::SetTevReg(2, Tev::ALP_C, false, 0x55);
+
+    // Covers the left quarter of the EFB, and more
+    OutputVertexData v[3];
+    v[1].screenPosition.y = EFB_HEIGHT * 2;
+    v[2].screenPosition.x = EFB_WIDTH / 2;
+    for (OutputVertexData& vertex : v)
+    {
+      vertex.projectedPosition.w = 1.0f;
+      memset(vertex.color[0], 0x80, sizeof(vertex.color[0]));
+    }
+    Rasterizer::DrawTriangleFrontFace(&v[0], &v[1], &v[2]);
+    Rasterizer::Flush();
+
+    u32 inherited = 0;
+    for (u16 y = 0; y < EFB_HEIGHT; y++)
+    {
+      for (u16 x = 8; x < EFB_WIDTH / 8; x++)
+      {
+        u8 color[4];
+        EfbInterface::GetColor(x, y, color);
+        inherited += color[1] == 0x80;
+      }
+    }
+    EXPECT_EQ((u32)EFB_HEIGHT * (EFB_WIDTH / 8 - 8), inherited) << "parallel " << parallel;
+  }
+}
+
+TEST_F(SWRasterizerTest, TevStateCarriesOverTiledDraws)
+{
+  std::vector<u32> efbs[2];
+  for (bool parallel : {false, true})
+  {
+    Start(parallel);
+
+    // Tiled, the pixels only write c1
+    bpmem.combiners[0].colorC.dest = 2;
+    bpmem.combiners[0].alphaC.dest = 2;
+    std::mt19937 random(5678);
+    DrawTriangles(random, 100);
+    Rasterizer::Flush();
+
+    // Outputs what the last pixel of the previous draw left in c1
+    bpmem.combiners[0].colorC.d = TEVCOLORARG_C1;
+    bpmem.combiners[0].alphaC.d = TEVALPHAARG_A1;
+    bpmem.combiners[0].colorC.dest = 0;
+    bpmem.combiners[0].alphaC.dest = 0;
+    bpmem.zmode.testenable = 0;
+    bpmem.blendmode.blendenable = 0;
+    OutputVertexData v[3];
+    v[1].screenPosition.y = EFB_HEIGHT;
+    v[2].screenPosition.x = EFB_WIDTH;
+    for (OutputVertexData& vertex : v)
+      vertex.projectedPosition.w = 1.0f;
+    Rasterizer::DrawTriangleFrontFace(&v[0], &v[1], &v[2]);
+    Rasterizer::Flush();
+
+    efbs[parallel] = ReadEfb();
+    SetUp();
+  }
+  ExpectSameEfb(efbs[0], efbs[1]);
+
+  // Not the value set for c1
+  u8 color[4];
+  EfbInterface::GetColor(0, 0, color);
+  EXPECT_NE(0u, (u32)(color[1] | color[2] | color[3]));
+}
@@ -0,0 +1,315 @@
+// Copyright 2013 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "VideoCommon/HiresTexturePack.h"
+#include "VideoCommon/HiresTextures.h"
+#include "VideoCommon/ImageWrite.h"
+#include "VideoCommon/TextureDecoder.h"
+#include "VideoCommon/TextureUtil.h"
+
+namespace
+{
+struct Texture
+{
+  std::string name;
+  std::vector<u8> data;
+  HiresTexturePack::Entry entry;
+};
+
+std::vector<Texture> MakeTextures()
+{
+  // Sizes and name lengths that leave every following part of the file unaligned
+  struct Size
+  {
+    u32 width, height, levels, nrm_levels, format, data_size;
+  };
+  const Size sizes[] = {{1, 1, 1, 0, PC_TEX_FMT_I8, 1},
+                        {17, 1, 1, 0, PC_TEX_FMT_I8, 17},
+                        {4096 + 5, 1, 1, 0, PC_TEX_FMT_I8, 4096 + 5},
+                        {8, 8, 4, 4, PC_TEX_FMT_RGBA32, (64 + 16 + 4 + 1) * 4 * 2},
+                        {3, 1, 1, 0, PC_TEX_FMT_I8, 3}};
+  std::vector<Texture> textures;
+  for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+  {
+    Texture texture;
+    texture.name = "tex1_" + std::to_string(i * 37 + 1) + std::string(i, 'x');
+    texture.entry = {};
+    texture.entry.width = sizes[i].width;
+    texture.entry.height = sizes[i].height;
+    texture.entry.levels = sizes[i].levels;
+    texture.entry.nrm_levels = sizes[i].nrm_levels;
+    texture.entry.format = sizes[i].format;
+    texture.entry.data_size = HiresTexturePack::GetDataSize(texture.entry);
+    EXPECT_EQ(sizes[i].data_size, texture.entry.data_size);
+    texture.data.resize(sizes[i].data_size);
+    for (size_t j = 0; j < texture.data.size(); j++)
+      texture.data[j] = static_cast<u8>(j * 7 + i);
+    textures.push_back(texture);
+  }
+  return textures;
+}
+
+bool WritePack(const std::string& path, const std::vector<Texture>& textures)
+{
+  HiresTexturePack::Writer writer;
+  if (!writer.Open(path))
+    return false;
+  for (const Texture& texture : textures)
+  {
+    if (!writer.AddTexture(texture.name, texture.entry, texture.data.data()))
+      return false;
+  }
+  return writer.Finish(HiresTexturePack::PACK_FLAG_NEW_NAMES);
+}
+
+// A custom texture stored as one PNG per level, data is what the pack should hold for it
+struct SourceTexture
+{
+  std::string name;
+  u32 width, height, levels;
+  bool material_map;
+  std::vector<u8> data;
+};
+
+std::vector<u8> MakeLevel(u32 width, u32 height, u32 seed)
+{
+  std::vector<u8> level(width * height * 4);
+  for (size_t i = 0; i < level.size(); i++)
+    level[i] = static_cast<u8>(i * 13 + seed);
+  return level;
+}
+
+bool WriteSourceTextures(const std::string& directory, std::vector<SourceTexture>* textures)
+{
+  *textures = {{"tex1_8x8_0123456789abcdef_5", 8, 8, 4, true, {}},
+               {"tex1_2x2_fedcba9876543210_1", 2, 2, 1, false, {}},
+               {"GTSE01_00c0ffee_5", 4, 4, 1, false, {}}};
+  for (size_t i = 0; i < textures->size(); i++)
+  {
+    SourceTexture& texture = (*textures)[i];
+    std::vector<u8> material;
+    for (u32 level = 0; level < texture.levels; level++)
+    {
+      const u32 width = TextureUtil::CalculateLevelSize(texture.width, level);
+      const u32 height = TextureUtil::CalculateLevelSize(texture.height, level);
+      const std::string path =
+          directory + "/" + texture.name + (level ? "_mip" + std::to_string(level) : "");
+      const std::vector<u8> color = MakeLevel(width, height, static_cast<u32>(i * 16 + level));
+      if (!TextureToPng(color.data(), width * 4, path + ".png", width, height, true))
+        return false;
+      texture.data.insert(texture.data.end(), color.begin(), color.end());
+      if (texture.material_map)
+      {
+        const std::vector<u8> map = MakeLevel(width, height, static_cast<u32>(i * 16 + level + 8));
+        if (!TextureToPng(map.data(), width * 4, path + ".mat.png", width, height, true))
+          return false;
+        material.insert(material.end(), map.begin(), map.end());
+      }
+    }
+    // The material maps follow the whole color mip chain
+    texture.data.insert(texture.data.end(), material.begin(), material.end());
+  }
+  // Files that aren't named like a custom texture are left out
+  const std::vector<u8> other = MakeLevel(1, 1, 0);
+  return TextureToPng(other.data(), 4, directory + "/notes.png", 1, 1, true);
+}
+}
+
+TEST(HiresTexturePack, RoundTrip)
+{
+  const std::string directory = File::CreateTempDir();
+  ASSERT_FALSE(directory.empty());
+  const std::string path = directory + "/textures.htp";
+  const std::vector<Texture> textures = MakeTextures();
+
+  ASSERT_TRUE(WritePack(path, textures));
+
+  HiresTexturePack::Header header;
+  {
+    File::IOFile file(path, "rb");
+    ASSERT_TRUE(file.ReadBytes(&header, sizeof(header)));
+  }
+  EXPECT_EQ(textures.size(), header.entry_count);
+  EXPECT_EQ(0u, header.names_offset % HiresTexturePack::PACK_DATA_ALIGNMENT);
+  EXPECT_EQ(0u, header.toc_offset % HiresTexturePack::PACK_DATA_ALIGNMENT);
+
+  HiresTexturePack::Reader reader;
+  ASSERT_TRUE(reader.Open(path));
+  EXPECT_EQ(static_cast<u32>(HiresTexturePack::PACK_FLAG_NEW_NAMES), reader.GetFlags());
+  for (const Texture& texture : textures)
+  {
+    const HiresTexturePack::Entry* entry = reader.Find(texture.name);
+    ASSERT_NE(nullptr, entry) << texture.name;
+    EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(entry) % alignof(HiresTexturePack::Entry));
+    EXPECT_EQ(texture.entry.width, entry->width);
+    EXPECT_EQ(texture.entry.height, entry->height);
+    EXPECT_EQ(texture.entry.levels, entry->levels);
+    EXPECT_EQ(texture.entry.nrm_levels, entry->nrm_levels);
+    EXPECT_EQ(texture.entry.format, entry->format);
+    ASSERT_EQ(texture.data.size(), entry->data_size);
+    EXPECT_EQ(0u, entry->data_offset % HiresTexturePack::PACK_DATA_ALIGNMENT);
+    const u8* data = reader.GetData(*entry);
+    EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(data) % HiresTexturePack::PACK_DATA_ALIGNMENT);
+    EXPECT_TRUE(std::equal(texture.data.begin(), texture.data.end(), data)) << texture.name;
+  }
+  EXPECT_EQ(nullptr, reader.Find("tex1_missing"));
+  EXPECT_EQ(nullptr, reader.Find(textures[1].name + "x"));
+  reader.Close();
+
+  File::DeleteDirRecursively(directory);
+}
+
+TEST(HiresTexturePack, DamagedEntries)
+{
+  const std::string directory = File::CreateTempDir();
+  ASSERT_FALSE(directory.empty());
+  const std::string path = directory + "/textures.htp";
+  const std::vector<Texture> textures = MakeTextures();
+
+  // Each damage is done to the mip-mapped entry, the pack loads only without it
+  const std::function<void(HiresTexturePack::Entry&)> damages[] = {
+      [](HiresTexturePack::Entry& entry) {},
+      // Stale sizes, the texture cache would read past the entry
+      [](HiresTexturePack::Entry& entry) { entry.width = 16; },
+      [](HiresTexturePack::Entry& entry) { entry.nrm_levels = 0; },
+      [](HiresTexturePack::Entry& entry) { entry.data_size -= 4; },
+      [](HiresTexturePack::Entry& entry) { entry.data_size += 4; },
+      [](HiresTexturePack::Entry& entry) { entry.format = PC_TEX_FMT_I8; },
+      // Not a format, or one that isn't loaded from files
+      [](HiresTexturePack::Entry& entry) { entry.format = PC_TEX_FMT_NONE; },
+      [](HiresTexturePack::Entry& entry) { entry.format = PC_TEX_FMT_RGBA_FLOAT; },
+      [](HiresTexturePack::Entry& entry) { entry.format = 0x1234; },
+      // Levels the texture doesn't have
+      [](HiresTexturePack::Entry& entry) { entry.levels = 5; },
+      [](HiresTexturePack::Entry& entry) { entry.levels = 0; },
+      [](HiresTexturePack::Entry& entry) { entry.nrm_levels = 2; },
+      [](HiresTexturePack::Entry& entry) { entry.height = 0; },
+      [](HiresTexturePack::Entry& entry) { entry.data_offset = 1ull << 40; },
+  };
+  for (size_t i = 0; i < sizeof(damages) / sizeof(damages[0]); i++)
+  {
+    ASSERT_TRUE(WritePack(path, textures));
+    HiresTexturePack::Header header;
+    std::vector<HiresTexturePack::Entry> entries;
+    {
+      File::IOFile file(path, "r+b");
+      ASSERT_TRUE(file.ReadBytes(&header, sizeof(header)));
+      entries.resize(header.entry_count);
+      ASSERT_TRUE(file.Seek(header.toc_offset, SEEK_SET));
+      ASSERT_TRUE(file.ReadArray(entries.data(), entries.size()));
+      const u64 hash = HiresTexturePack::HashName(textures[3].name);
+      auto entry = std::find_if(entries.begin(), entries.end(), [hash](const auto& e) {
+        return e.name_hash == hash;
+      });
+      ASSERT_NE(entries.end(), entry);
+      damages[i](*entry);
+      ASSERT_TRUE(file.Seek(header.toc_offset, SEEK_SET));
+      ASSERT_TRUE(file.WriteArray(entries.data(), entries.size()));
+    }
+
+    HiresTexturePack::Reader reader;
+    EXPECT_EQ(i == 0, reader.Open(path)) << "damage " << i;
+    reader.Close();
+  }
+
+  File::DeleteDirRecursively(directory);
+}
+
+TEST(HiresTexturePack, BuildPackRoundTrip)
+{
+  const std::string temp_directory = File::CreateTempDir();
+  ASSERT_FALSE(temp_directory.empty());
+  const std::string directory = temp_directory + "/GTSE01";
+  ASSERT_TRUE(File::CreateDir(directory));
+  std::vector<SourceTexture> textures;
+  ASSERT_TRUE(WriteSourceTextures(directory, &textures));
+
+  size_t progress_calls = 0;
+  float last_progress = 0.0f;
+  ASSERT_TRUE(HiresTexture::BuildPack("GTSE01", directory, true, false,
+                                      [&](const std::string& name, float progress) {
+                                        EXPECT_LE(last_progress, progress) << name;
+                                        last_progress = progress;
+                                        progress_calls++;
+                                        return true;
+                                      }));
+  EXPECT_EQ(textures.size() + 1, progress_calls);
+  EXPECT_EQ(1.0f, last_progress);
+  EXPECT_FALSE(File::Exists(directory + ".htp.tmp"));
+
+  HiresTexturePack::Reader reader;
+  ASSERT_TRUE(reader.Open(directory + ".htp"));
+  EXPECT_EQ(static_cast<u32>(HiresTexturePack::PACK_FLAG_NATIVE_NAMES |
+                             HiresTexturePack::PACK_FLAG_NEW_NAMES),
+            reader.GetFlags());
+  for (const SourceTexture& texture : textures)
+  {
+    const HiresTexturePack::Entry* entry = reader.Find(texture.name);
+    ASSERT_NE(nullptr, entry) << texture.name;
+    EXPECT_EQ(texture.width, entry->width);
+    EXPECT_EQ(texture.height, entry->height);
+    EXPECT_EQ(texture.levels, entry->levels);
+    EXPECT_EQ(texture.material_map ? texture.levels : 0u, entry->nrm_levels);
+    EXPECT_EQ(static_cast<u32>(PC_TEX_FMT_RGBA32), entry->format);
+    ASSERT_EQ(texture.data.size(), entry->data_size);
+    const u8* data = reader.GetData(*entry);
+    EXPECT_TRUE(std::equal(texture.data.begin(), texture.data.end(), data)) << texture.name;
+  }
+  EXPECT_EQ(nullptr, reader.Find("notes"));
+  reader.Close();
+
+  // Without material maps the same directory packs only the color mip chains
+  ASSERT_TRUE(HiresTexture::BuildPack("GTSE01", directory, false, false,
+                                      [](const std::string&, float) { return true; }));
+  ASSERT_TRUE(reader.Open(directory + ".htp"));
+  const HiresTexturePack::Entry* entry = reader.Find(textures[0].name);
+  ASSERT_NE(nullptr, entry);
+  EXPECT_EQ(0u, entry->nrm_levels);
+  ASSERT_EQ(textures[0].data.size() / 2, entry->data_size);
+  EXPECT_TRUE(std::equal(textures[0].data.begin(),
+                         textures[0].data.begin() + textures[0].data.size() / 2,
+                         reader.GetData(*entry)));
+  reader.Close();
+
+  File::DeleteDirRecursively(temp_directory);
+}
+
+TEST(HiresTexturePack, BuildPackAbort)
+{
+  const std::string temp_directory = File::CreateTempDir();
+  ASSERT_FALSE(temp_directory.empty());
+  const std::string directory = temp_directory + "/GTSE01";
+  ASSERT_TRUE(File::CreateDir(directory));
+  std::vector<SourceTexture> textures;
+  ASSERT_TRUE(WriteSourceTextures(directory, &textures));
+
+  // Aborting after the first texture leaves no pack behind
+  size_t progress_calls = 0;
+  EXPECT_FALSE(HiresTexture::BuildPack("GTSE01", directory, true, false,
+                                       [&](const std::string&, float) {
+                                         return progress_calls++ == 0;
+                                       }));
+  EXPECT_EQ(2u, progress_calls);
+  EXPECT_FALSE(File::Exists(directory + ".htp"));
+  EXPECT_FALSE(File::Exists(directory + ".htp.tmp"));
+
+  // A directory without custom textures doesn't make an empty pack
+  const std::string empty_directory = temp_directory + "/GEMP01";
+  ASSERT_TRUE(File::CreateDir(empty_directory));
+  EXPECT_FALSE(HiresTexture::BuildPack("GEMP01", empty_directory, true, false,
+                                       [](const std::string&, float) { return true; }));
+  EXPECT_FALSE(File::Exists(empty_directory + ".htp"));
+
+  File::DeleteDirRecursively(temp_directory);
+}
@@ -0,0 +1,188 @@
+// Copyright 2013 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CPUDetect.h"
+#include "Common/CommonTypes.h"
+#include "VideoCommon/IndexGenerator.h"
+#include "VideoCommon/OpcodeDecoding.h"
+
+namespace
+{
+// The index loops IndexGenerator had before it wrote long runs in blocks
+u16* ReferenceIndices(int primitive, u16* ptr, u32 base, u32 count)
+{
+  const u32 top = base + count;
+  switch (primitive)
+  {
+  case GX_DRAW_QUADS:
+  case GX_DRAW_QUADS_2:
+  {
+    u32 i = base + 3;
+    for (; i < top; i += 4)
+    {
+      *ptr++ = i - 3, *ptr++ = i - 2, *ptr++ = i - 1;
+      *ptr++ = i - 3, *ptr++ = i - 1, *ptr++ = i;
+    }
+    if (i == top)
+      *ptr++ = top - 3, *ptr++ = top - 2, *ptr++ = top - 1;
+    break;
+  }
+  case GX_DRAW_TRIANGLES:
+    for (u32 i = base + 2; i < top; i += 3)
+      *ptr++ = i - 2, *ptr++ = i - 1, *ptr++ = i;
+    break;
+  case GX_DRAW_TRIANGLE_STRIP:
+  {
+    u32 wind = 1;
+    for (u32 a = base, i = base + 2; i < top; ++i, ++a)
+    {
+      *ptr++ = a;
+      *ptr++ = i - wind;
+      wind ^= 1;
+      *ptr++ = i - wind;
+    }
+    break;
+  }
+  case GX_DRAW_TRIANGLE_FAN:
+    for (u32 i = base + 2; i < top; ++i)
+      *ptr++ = base, *ptr++ = i - 1, *ptr++ = i;
+    break;
+  case GX_DRAW_LINES:
+    for (u32 i = base + 1; i < top; i += 2)
+      *ptr++ = i - 1, *ptr++ = i;
+    break;
+  case GX_DRAW_LINE_STRIP:
+    for (u32 i = base + 1; i < top; ++i)
+      *ptr++ = i - 1, *ptr++ = i;
+    break;
+  case GX_DRAW_POINTS:
+    for (u32 i = base; i < top; ++i)
+      *ptr++ = i;
+    break;
+  }
+  return ptr;
+}
+
+struct Primitive
+{
+  const char* name;
+  int primitive;
+};
+
+const Primitive s_primitives[] = {
+    {"quads", GX_DRAW_QUADS},
+    {"quads2", GX_DRAW_QUADS_2},
+    {"triangles", GX_DRAW_TRIANGLES},
+    {"strip", GX_DRAW_TRIANGLE_STRIP},
+    {"fan", GX_DRAW_TRIANGLE_FAN},
+    {"lines", GX_DRAW_LINES},
+    {"linestrip", GX_DRAW_LINE_STRIP},
+    {"points", GX_DRAW_POINTS},
+};
+
+// Enough for 65534 vertices of any primitive, plus a guard
+const size_t BUFFER_SIZE = 65536 * 3 + 64;
+
+class IndexGeneratorTest : public testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    m_avx2 = cpu_info.bAVX2;
+    IndexGenerator::Init();
+  }
+  void TearDown() override { cpu_info.bAVX2 = m_avx2; }
+
+  bool m_avx2;
+};
+}
+
+TEST_F(IndexGeneratorTest, MatchesScalarLoops)
+{
+  std::vector<u16> expected(BUFFER_SIZE);
+  std::vector<u16> result(BUFFER_SIZE);
+  for (bool avx2 : {false, true})
+  {
+    if (avx2 && !m_avx2)
+      continue;
+    cpu_info.bAVX2 = avx2;
+    for (const Primitive& primitive : s_primitives)
+    {
+      // Every count up to a few blocks, at bases that do not line up with a block
+      std::fill(result.begin(), result.end(), 0xCDCD);
+      std::fill(expected.begin(), expected.end(), 0xCDCD);
+      IndexGenerator::Start(result.data());
+      u16* expected_end = expected.data();
+      for (u32 count = 0; count < 120; ++count)
+      {
+        expected_end = ReferenceIndices(primitive.primitive, expected_end,
+                                        IndexGenerator::GetNumVerts(), count);
+        IndexGenerator::AddIndices(primitive.primitive, count);
+      }
+      // A run up to the highest index a buffer can hold
+      const u32 last = IndexGenerator::GetRemainingIndices();
+      expected_end = ReferenceIndices(primitive.primitive, expected_end,
+                                      IndexGenerator::GetNumVerts(), last);
+      IndexGenerator::AddIndices(primitive.primitive, last);
+
+      ASSERT_EQ(expected_end - expected.data(), IndexGenerator::GetIndexLen())
+          << primitive.name << (avx2 ? " AVX2" : "");
+      for (size_t i = 0; i < BUFFER_SIZE; ++i)
+      {
+        ASSERT_EQ(expected[i], result[i])
+            << primitive.name << (avx2 ? " AVX2" : "") << " index " << i;
+      }
+    }
+  }
+}
+
+TEST_F(IndexGeneratorTest, Speed)
+{
+  std::vector<u16> buffer(BUFFER_SIZE);
+  const u32 total_vertices = 60000;
+  const int iterations = 20;
+  for (const Primitive& primitive : s_primitives)
+  {
+    if (primitive.primitive == GX_DRAW_QUADS_2)
+      continue;
+    for (u32 run : {4u, 16u, 64u, 256u, 1024u})
+    {
+      const u32 runs = total_vertices / run;
+      auto start = std::chrono::steady_clock::now();
+      for (int i = 0; i < iterations; ++i)
+      {
+        u16* ptr = buffer.data();
+        for (u32 j = 0; j < runs; ++j)
+          ptr = ReferenceIndices(primitive.primitive, ptr, j * run, run);
+      }
+      const std::chrono::duration<double> scalar = std::chrono::steady_clock::now() - start;
+
+      double blocks[2] = {};
+      for (bool avx2 : {false, true})
+      {
+        if (avx2 && !m_avx2)
+          continue;
+        cpu_info.bAVX2 = avx2;
+        start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i)
+        {
+          IndexGenerator::Start(buffer.data());
+          for (u32 j = 0; j < runs; ++j)
+            IndexGenerator::AddIndices(primitive.primitive, run);
+        }
+        const std::chrono::duration<double> time = std::chrono::steady_clock::now() - start;
+        blocks[avx2] = (double)runs * run * iterations / time.count() / 1000000.0;
+      }
+      printf("%-10s run %5u: %8.1f scalar, %8.1f SSE2, %8.1f AVX2 Mvertices/s\n", primitive.name,
+             run, (double)runs * run * iterations / scalar.count() / 1000000.0, blocks[0],
+             blocks[1]);
+    }
+  }
+}
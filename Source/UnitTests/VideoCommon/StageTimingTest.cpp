@@ -0,0 +1,102 @@
+// Copyright 2013 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/StageTiming.h"
+
+namespace
+{
+void Sleep(int ms)
+{
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+size_t CountLines(const std::string& text)
+{
+  size_t lines = 0;
+  for (char c : text)
+    lines += c == '\n';
+  return lines;
+}
+}
+
+TEST(StageTiming, DisabledRecordsNothing)
+{
+  StageTiming::SetEnabled(false);
+  StageTiming::TakeFrames();
+  {
+    StageTiming::ScopedStage timing(StageTiming::STAGE_FLUSH);
+  }
+  StageTiming::EndFrame();
+  EXPECT_TRUE(StageTiming::TakeFrames().empty());
+}
+
+TEST(StageTiming, NestedStagesAreExclusive)
+{
+  StageTiming::SetEnabled(true);
+  {
+    StageTiming::ScopedStage flush(StageTiming::STAGE_FLUSH);
+    Sleep(20);
+    {
+      StageTiming::ScopedStage texture(StageTiming::STAGE_TEXTURE);
+      Sleep(40);
+    }
+    {
+      // Inactive scopes, like the preprocessing decoder's, leave the current stage alone
+      StageTiming::ScopedStage decode(StageTiming::STAGE_OPCODE_DECODE, false);
+      Sleep(10);
+    }
+  }
+  StageTiming::EndFrame();
+  StageTiming::EndFrame();
+  StageTiming::SetEnabled(false);
+
+  const std::vector<StageTiming::Frame> frames = StageTiming::TakeFrames();
+  ASSERT_EQ(2u, frames.size());
+  EXPECT_EQ(0u, frames[0].number);
+  EXPECT_EQ(1u, frames[1].number);
+
+  const StageTiming::Frame& frame = frames[0];
+  const u64 ms = 1000000;
+  EXPECT_GE(frame.stage_ns[StageTiming::STAGE_FLUSH], 30 * ms);
+  EXPECT_LT(frame.stage_ns[StageTiming::STAGE_FLUSH], 40 * ms + 30 * ms);
+  EXPECT_GE(frame.stage_ns[StageTiming::STAGE_TEXTURE], 40 * ms);
+  EXPECT_EQ(0u, frame.stage_ns[StageTiming::STAGE_OPCODE_DECODE]);
+  u64 stages = 0;
+  for (u64 ns : frame.stage_ns)
+    stages += ns;
+  EXPECT_LE(stages, frame.total_ns);
+
+  for (u64 ns : frames[1].stage_ns)
+    EXPECT_EQ(0u, ns);
+}
+
+TEST(StageTiming, Formats)
+{
+  StageTiming::Frame frame = {};
+  frame.number = 3;
+  frame.total_ns = 16500000;
+  frame.stage_ns[StageTiming::STAGE_TEXTURE] = 2000000;
+  frame.stage_ns[StageTiming::STAGE_FLUSH] = 4250000;
+  const std::vector<StageTiming::Frame> frames = {frame, frame};
+
+  const std::string csv = StageTiming::FramesToCSV(frames);
+  EXPECT_EQ(3u, CountLines(csv));
+  EXPECT_EQ(0u, csv.find("frame,total_ms,opcode_decode_ms,vertex_conversion_ms,texture_ms,"
+                         "shader_ms,flush_ms,other_ms\n"));
+  EXPECT_NE(std::string::npos, csv.find("\n3,16.500,0.000,0.000,2.000,0.000,4.250,10.250\n"));
+
+  const std::string json = StageTiming::FramesToJSON(frames);
+  EXPECT_EQ(4u, CountLines(json));
+  EXPECT_EQ(0u, json.find("[\n  {\"frame\": 3, \"total_ms\": 16.500, \"opcode_decode_ms\": 0.000"));
+  EXPECT_NE(std::string::npos, json.find("\"other_ms\": 10.250},\n"));
+  EXPECT_NE(std::string::npos, json.find("\"other_ms\": 10.250}\n]\n"));
+}
@@ -0,0 +1,309 @@
+// Copyright 2013 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <map>
+#include <vector>
+
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/TextureCacheIndex.h"
+
+namespace
+{
+struct Texture
+{
+  u32 address;
+  u32 size;
+  u64 hash;
+};
+
+u32 Random(u32& seed)
+{
+  seed = seed * 1103515245 + 12345;
+  return seed >> 8;
+}
+
+// A texture cache trace: what TextureCacheBase does with its indices per draw and per EFB copy
+enum class Op
+{
+  Lookup,      // Load: find the textures at an address, then the ones with a hash
+  Insert,      // Load of a texture that isn't cached yet
+  Invalidate,  // EFB copy: drop every texture overlapping a range
+};
+
+struct TraceEntry
+{
+  Op op;
+  Texture texture;
+};
+
+// About what a scene with many live textures produces: a few thousand textures spread
+// over MEM1, looked up for every draw, a few new ones and a few EFB copies per frame
+std::vector<TraceEntry> MakeTrace(u32 texture_count, u32 frames)
+{
+  std::vector<TraceEntry> trace;
+  std::vector<Texture> textures;
+  u32 seed = 0x600df00d;
+  for (u32 i = 0; i < texture_count; ++i)
+  {
+    const u32 size = 32u << (Random(seed) % 13);
+    const Texture texture = {(Random(seed) % (24 * 1024 * 1024 - size)) & ~31u, size,
+                             (u64)Random(seed) << 32 | Random(seed)};
+    textures.push_back(texture);
+    trace.push_back({Op::Insert, texture});
+  }
+  for (u32 frame = 0; frame < frames; ++frame)
+  {
+    for (u32 draw = 0; draw < 2000; ++draw)
+      trace.push_back({Op::Lookup, textures[Random(seed) % textures.size()]});
+    for (u32 i = 0; i < 8; ++i)
+    {
+      Texture& texture = textures[Random(seed) % textures.size()];
+      texture.hash = (u64)Random(seed) << 32 | Random(seed);
+      trace.push_back({Op::Insert, texture});
+    }
+    for (u32 i = 0; i < 4; ++i)
+    {
+      const Texture& texture = textures[Random(seed) % textures.size()];
+      trace.push_back({Op::Invalidate, {texture.address, 640 * 528 * 2, 0}});
+    }
+  }
+  return trace;
+}
+
+// The lookups of the texture cache before the flat index
+struct MultimapCache
+{
+  std::multimap<u32, const Texture*> by_address;
+  std::multimap<u64, const Texture*> by_hash;
+
+  size_t Replay(const std::vector<TraceEntry>& trace)
+  {
+    size_t found = 0;
+    for (const TraceEntry& entry : trace)
+    {
+      const Texture& texture = entry.texture;
+      if (entry.op == Op::Lookup)
+      {
+        auto range = by_address.equal_range(texture.address);
+        for (auto iter = range.first; iter != range.second; ++iter)
+          found += iter->second->hash == texture.hash;
+        auto hash_range = by_hash.equal_range(texture.hash);
+        for (auto iter = hash_range.first; iter != hash_range.second; ++iter)
+          found += iter->second->size == texture.size;
+      }
+      else if (entry.op == Op::Insert)
+      {
+        by_address.emplace(texture.address, &texture);
+        by_hash.emplace(texture.hash, &texture);
+      }
+      else
+      {
+        const u32 lower = texture.address > 4 * 1024 * 1024 ? texture.address - 4 * 1024 * 1024 : 0;
+        auto iter = by_address.lower_bound(lower);
+        auto end = by_address.upper_bound(texture.address + texture.size);
+        while (iter != end)
+        {
+          const Texture* other = iter->second;
+          if (other->address + other->size > texture.address &&
+              other->address < texture.address + texture.size)
+          {
+            auto hash_range = by_hash.equal_range(other->hash);
+            for (auto hash_iter = hash_range.first; hash_iter != hash_range.second; ++hash_iter)
+            {
+              if (hash_iter->second == other)
+              {
+                by_hash.erase(hash_iter);
+                break;
+              }
+            }
+            iter = by_address.erase(iter);
+            found++;
+          }
+          else
+          {
+            ++iter;
+          }
+        }
+      }
+    }
+    return found;
+  }
+};
+
+struct FlatCache
+{
+  // Values are trace indices, the texture cache keeps the handles in its entries the same way
+  TextureAddressMap<u32> by_address;
+  FlatMultiMap<u64, u32> by_hash;
+  std::vector<std::pair<u32, u32>> handles;
+  std::vector<u32> overlapping;
+
+  size_t Replay(const std::vector<TraceEntry>& trace)
+  {
+    handles.resize(trace.size());
+    size_t found = 0;
+    for (u32 i = 0; i < trace.size(); ++i)
+    {
+      const Texture& texture = trace[i].texture;
+      if (trace[i].op == Op::Lookup)
+      {
+        for (u32 handle = by_address.Find(texture.address); handle != by_address.NONE;
+             handle = by_address.Next(handle))
+        {
+          found += trace[by_address.Get(handle)].texture.hash == texture.hash;
+        }
+        for (u32 handle = by_hash.Find(texture.hash); handle != by_hash.NONE;
+             handle = by_hash.Next(handle))
+        {
+          found += trace[by_hash.Get(handle)].texture.size == texture.size;
+        }
+      }
+      else if (trace[i].op == Op::Insert)
+      {
+        handles[i] = {by_address.Insert(texture.address, texture.size, i),
+                      by_hash.Insert(texture.hash, i)};
+      }
+      else
+      {
+        by_address.FindOverlapping(texture.address, texture.size, &overlapping);
+        for (u32 other : overlapping)
+        {
+          by_address.Erase(handles[other].first);
+          by_hash.Erase(handles[other].second);
+          found++;
+        }
+      }
+    }
+    return found;
+  }
+};
+}
+
+TEST(TextureCacheIndex, MultiMapKeepsInsertionOrder)
+{
+  FlatMultiMap<u32, int> map;
+  std::multimap<u32, int> reference;
+  std::vector<std::pair<u32, u32>> handles;
+  u32 seed = 1;
+  for (int i = 0; i < 20000; ++i)
+  {
+    // Few keys, so there are long chains and the table grows and shrinks its runs
+    const u32 key = (Random(seed) % 300) << 5;
+    if (Random(seed) % 3 != 0 || handles.empty())
+    {
+      handles.emplace_back(map.Insert(key, i), key);
+      reference.emplace(key, i);
+    }
+    else
+    {
+      const size_t index = Random(seed) % handles.size();
+      const u32 handle = handles[index].first;
+      const int value = map.Get(handle);
+      EXPECT_EQ(handles[index].second, map.GetKey(handle));
+      auto range = reference.equal_range(handles[index].second);
+      reference.erase(std::find_if(range.first, range.second,
+                                   [value](const auto& pair) { return pair.second == value; }));
+      map.Erase(handle);
+      handles[index] = handles.back();
+      handles.pop_back();
+    }
+  }
+
+  ASSERT_EQ(reference.size(), map.GetSize());
+  for (u32 key = 0; key < (300 << 5); key += 32)
+  {
+    auto range = reference.equal_range(key);
+    u32 handle = map.Find(key);
+    for (auto iter = range.first; iter != range.second; ++iter)
+    {
+      ASSERT_NE(map.NONE, handle) << key;
+      EXPECT_EQ(iter->second, map.Get(handle));
+      handle = map.Next(handle);
+    }
+    EXPECT_EQ(map.NONE, handle) << key;
+  }
+
+  size_t count = 0;
+  map.ForEach([&](u32 handle) { count++; });
+  EXPECT_EQ(reference.size(), count);
+  map.Clear();
+  EXPECT_EQ(map.NONE, map.Find(0));
+}
+
+TEST(TextureCacheIndex, OverlapsMatchFullScan)
+{
+  TextureAddressMap<int> map;
+  std::vector<Texture> textures;
+  std::vector<u32> handles;
+  u32 seed = 2;
+  for (int i = 0; i < 3000; ++i)
+  {
+    // Sizes from a single block to more than the 512 MiB the pages wrap around at
+    const u32 size = Random(seed) % 50 == 0 ? 0x21000000 : (Random(seed) % 64) << (Random(seed) % 16);
+    const Texture texture = {(Random(seed) % 0x2000000) << 5, size, 0};
+    textures.push_back(texture);
+    handles.push_back(map.Insert(texture.address, texture.size, i));
+  }
+  for (int i = 0; i < 1000; ++i)
+  {
+    const int index = Random(seed) % textures.size();
+    if (handles[index] != map.NONE)
+    {
+      map.Erase(handles[index]);
+      handles[index] = map.NONE;
+    }
+  }
+
+  std::vector<int> found;
+  for (int i = 0; i < 2000; ++i)
+  {
+    const u32 address = (Random(seed) % 0x2000000) << 5;
+    const u32 size = i % 100 == 0 ? 0x30000000 : Random(seed) % (1 << (Random(seed) % 22));
+    std::vector<std::pair<u32, int>> expected;
+    for (size_t j = 0; j < textures.size(); ++j)
+    {
+      if (handles[j] != map.NONE && (u64)textures[j].address + textures[j].size > address &&
+          textures[j].address < (u64)address + size)
+      {
+        expected.emplace_back(textures[j].address, (int)j);
+      }
+    }
+    std::sort(expected.begin(), expected.end());
+
+    map.FindOverlapping(address, size, &found);
+    ASSERT_EQ(expected.size(), found.size()) << std::hex << address << " " << size;
+    for (size_t j = 0; j < found.size(); ++j)
+      EXPECT_EQ(expected[j].second, found[j]);
+  }
+}
+
+TEST(TextureCacheIndex, TraceReplay)
+{
+  for (u32 texture_count : {500u, 5000u, 20000u})
+  {
+    const std::vector<TraceEntry> trace = MakeTrace(texture_count, 60);
+    auto start = std::chrono::steady_clock::now();
+    MultimapCache multimap;
+    const size_t multimap_found = multimap.Replay(trace);
+    const std::chrono::duration<double, std::milli> multimap_time =
+        std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    FlatCache flat;
+    const size_t flat_found = flat.Replay(trace);
+    const std::chrono::duration<double, std::milli> flat_time =
+        std::chrono::steady_clock::now() - start;
+
+    EXPECT_EQ(multimap_found, flat_found);
+    EXPECT_EQ(multimap.by_address.size(), flat.by_address.GetSize());
+    EXPECT_EQ(multimap.by_hash.size(), flat.by_hash.GetSize());
+    printf("%6u textures, %zu operations: %8.2f ms multimap, %8.2f ms flat\n", texture_count,
+           trace.size(), multimap_time.count(), flat_time.count());
+  }
+}
@@ -0,0 +1,158 @@
+// Copyright 2013 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <cstring>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/Align.h"
+#include "Common/CommonTypes.h"
+#include "Common/MemoryUtil.h"
+#include "Core/ConfigManager.h"
+#include "Core/HW/Memmap.h"
+#include "VideoCommon/BPMemory.h"
+#include "VideoCommon/Fifo.h"
+#include "VideoCommon/TextureCacheBase.h"
+#include "VideoCommon/TextureDecoder.h"
+#include "VideoCommon/TexturePrefetch.h"
+#include "VideoCommon/TextureUtil.h"
+#include "VideoCommon/VideoConfig.h"
+
+namespace
+{
+// Decodes everything to RGBA, like the software backend
+class TestTextureCache : public TextureCacheBase
+{
+public:
+  PC_TexFormat GetNativeTextureFormat(const s32 texformat, const TlutFormat tlutfmt, u32 width,
+                                      u32 height) override
+  {
+    return PC_TEX_FMT_RGBA32;
+  }
+  bool Palettize(TCacheEntryBase* entry, const TCacheEntryBase* base_entry) override
+  {
+    return false;
+  }
+  void CopyEFB(u8* dst, const EFBCopyFormat& format, u32 native_width, u32 bytes_per_row,
+               u32 num_blocks_y, u32 memory_stride, bool is_depth_copy,
+               const EFBRectangle& src_rect, bool scale_by_half) override
+  {
+  }
+  bool CompileShaders() override { return true; }
+  void DeleteShaders() override {}
+  void LoadLut(u32 lutFmt, void* addr, u32 size) override {}
+
+private:
+  TCacheEntryBase* CreateTexture(const TCacheEntryConfig& config) override { return nullptr; }
+};
+
+class TexturePrefetchTest : public testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    SConfig::Init();
+    SConfig::GetInstance().bWii = false;
+    SConfig::GetInstance().bMMU = false;
+    SConfig::GetInstance().bFastmem = true;
+    SConfig::GetInstance().bCPUThread = true;
+    SConfig::GetInstance().m_GPUDeterminismMode = GPU_DETERMINISM_AUTO;
+    Memory::Init();
+
+    m_config = g_ActiveConfig;
+    g_ActiveConfig.bPredictiveFifo = true;
+    g_ActiveConfig.bTextureWriteWatch = true;
+    g_ActiveConfig.bHiresTextures = false;
+    g_ActiveConfig.bEnableGPUTextureDecoding = false;
+    g_ActiveConfig.iTexScalingType = 0;
+    g_ActiveConfig.iSafeTextureCache_ColorSamples = 0;
+    // The deterministic GPU thread preprocesses the FIFO without the loops of Fifo::Init
+    Fifo::UpdateWantDeterminism(true);
+    g_texture_cache = std::make_unique<TestTextureCache>();
+    TexturePrefetch::Init();
+    // The first range watched only turns write watching on
+    Memory::WatchPages(0, 32);
+  }
+
+  void TearDown() override
+  {
+    g_texture_cache.reset();
+    Fifo::UpdateWantDeterminism(false);
+    Memory::Shutdown();
+    g_ActiveConfig = m_config;
+    SConfig::Shutdown();
+  }
+
+  VideoConfig m_config;
+};
+}
+
+TEST_F(TexturePrefetchTest, MipmapsMatchSerialDecode)
+{
+  ASSERT_TRUE(TexturePrefetch::IsEnabled());
+
+  // Levels of 40x24 down to 1x1, the small ones are padded to whole blocks
+  const u32 address = 0x00100000;
+  const u32 width = 40;
+  const u32 height = 24;
+  const u32 texformat = GX_TF_RGB5A3;
+  const u32 levels = 6;
+  const u32 bsw = TexDecoder_GetBlockWidthInTexels(texformat);
+  const u32 bsh = TexDecoder_GetBlockHeightInTexels(texformat);
+  std::mt19937 random(42);
+  u8* src = Memory::GetPointer(address);
+  for (u32 i = 0; i < 64 * 1024; i++)
+    src[i] = (u8)random();
+
+  TexMode0 mode0 = {};
+  mode0.min_filter = TexMode0::TEXF_LINEAR;
+  TexMode1 mode1 = {};
+  mode1.max_lod = 0xFF;
+  TexImage0 image0 = {};
+  image0.width = width - 1;
+  image0.height = height - 1;
+  image0.format = texformat;
+  TexImage3 image3 = {};
+  image3.image_base = address >> 5;
+  TexturePrefetch::LoadBPReg(BPMEM_TX_SETMODE0 << 24 | mode0.hex);
+  TexturePrefetch::LoadBPReg(BPMEM_TX_SETMODE1 << 24 | mode1.hex);
+  TexturePrefetch::LoadBPReg(BPMEM_TX_SETIMAGE0 << 24 | image0.hex);
+  TexturePrefetch::LoadBPReg(BPMEM_TX_SETIMAGE3 << 24 | image3.hex);
+  TexturePrefetch::Draw();
+  TexturePrefetch::WaitForJobs();
+
+  const u32 expanded_width = Common::AlignUpSizePow2(width, bsw);
+  const u32 expanded_height = Common::AlignUpSizePow2(height, bsh);
+  const u32 size = TexDecoder_GetTextureSizeInBytes(expanded_width, expanded_height, texformat);
+  std::shared_ptr<TexturePrefetch::Texture> texture = TexturePrefetch::Take(address, size);
+  ASSERT_NE(nullptr, texture);
+  EXPECT_EQ(levels, texture->levels);
+  ASSERT_TRUE(
+      texture->IsDecoded(texformat, expanded_width, expanded_height, levels, true, false));
+  EXPECT_FALSE(
+      texture->IsDecoded(texformat, expanded_width, expanded_height, levels + 1, true, false));
+
+  // What Load decodes itself
+  const u8* level_src = src;
+  for (u32 level = 0; level < levels; level++)
+  {
+    const u32 level_width =
+        Common::AlignUpSizePow2(TextureUtil::CalculateLevelSize(width, level), bsw);
+    const u32 level_height =
+        Common::AlignUpSizePow2(TextureUtil::CalculateLevelSize(height, level), bsh);
+    std::vector<u8> expected(level_width * level_height * 4);
+    TexDecoder_Decode(expected.data(), level_src, level_width, level_height, texformat, 0,
+                      GX_TL_IA8, true, false);
+    ASSERT_NE(nullptr, texture->GetLevel(level));
+    EXPECT_EQ(0, memcmp(expected.data(), texture->GetLevel(level), expected.size()))
+        << "level " << level;
+    level_src += TexDecoder_GetTextureSizeInBytes(level_width, level_height, texformat);
+  }
+
+  // Taken once
+  EXPECT_EQ(nullptr, TexturePrefetch::Take(address, size));
+}
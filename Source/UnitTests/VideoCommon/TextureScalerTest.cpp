@@ -0,0 +1,124 @@
+// Copyright 2013 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CommonTypes.h"
+#include "Common/ThreadPool.h"
+#include "VideoCommon/TextureScalerCommon.h"
+#include "VideoCommon/VideoConfig.h"
+
+namespace
+{
+const char* const s_filter_names[] = {"none",       "xbrz",         "hybrid",     "bicubic",
+                                      "hybrid_bic", "jinc",         "jinc_sharp", "smoothstep",
+                                      "3point",     "ddt",          "ddt_sharp"};
+
+// Noise mixed with flat and posterized areas and some hard alpha, so that
+// every filter (and the deposterize pass) takes its different paths.
+std::vector<u32> MakeTexture(int width, int height)
+{
+  std::vector<u32> texture(width * height);
+  u32 seed = 0x12345678;
+  for (int y = 0; y < height; ++y)
+  {
+    for (int x = 0; x < width; ++x)
+    {
+      seed = seed * 1103515245 + 12345;
+      u32 color;
+      if ((x / 16 + y / 16) % 3 == 0)
+        color = 0xFF000000 | ((x / 4) * 0x00040404);
+      else if ((x / 16 + y / 16) % 3 == 1)
+        color = 0xFF203040;
+      else
+        color = seed;
+      if (y % 37 == 0)
+        color &= 0x00FFFFFF;
+      texture[y * width + x] = color;
+    }
+  }
+  return texture;
+}
+
+std::vector<u32> Scale(TextureScaler& scaler, const std::vector<u32>& texture, int width,
+                       int height, int factor)
+{
+  std::vector<u32> input(texture);
+  u32* output = scaler.Scale(input.data(), width, height);
+  return std::vector<u32>(output, output + width * height * factor * factor);
+}
+
+class TextureScalerTest : public testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    m_saved_config = g_ActiveConfig;
+    g_ActiveConfig.bTexDeposterize = false;
+  }
+
+  void TearDown() override { g_ActiveConfig = m_saved_config; }
+
+  VideoConfig m_saved_config;
+};
+}
+
+TEST_F(TextureScalerTest, MultiThreadedMatchesSingleThreaded)
+{
+  // Odd sizes so the bands do not line up with any block size.
+  const int width = 301, height = 277;
+  std::vector<u32> texture = MakeTexture(width, height);
+  TextureScaler single, multi;
+  single.SetMaxThreads(1);
+  multi.SetMaxThreads(0);
+  for (int deposterize = 0; deposterize < 2; ++deposterize)
+  {
+    g_ActiveConfig.bTexDeposterize = deposterize != 0;
+    for (int type = TextureScaler::XBRZ; type <= TextureScaler::DDT_SHARP; ++type)
+    {
+      g_ActiveConfig.iTexScalingType = type;
+      for (int factor = 2; factor <= 5; ++factor)
+      {
+        g_ActiveConfig.iTexScalingFactor = factor;
+        std::vector<u32> expected = Scale(single, texture, width, height, factor);
+        std::vector<u32> actual = Scale(multi, texture, width, height, factor);
+        EXPECT_TRUE(expected == actual) << s_filter_names[type] << " x" << factor
+                                        << " deposterize " << deposterize;
+      }
+    }
+  }
+}
+
+TEST_F(TextureScalerTest, Speed)
+{
+  const int width = 512, height = 512, factor = 3, iterations = 4;
+  std::vector<u32> texture = MakeTexture(width, height);
+  g_ActiveConfig.iTexScalingFactor = factor;
+
+  std::vector<int> thread_counts = {1, 2, 4};
+  int all_threads = static_cast<int>(Common::ThreadPool::WorkerCount()) + 1;
+  if (all_threads > 4)
+    thread_counts.push_back(all_threads);
+
+  for (int type = TextureScaler::XBRZ; type <= TextureScaler::DDT_SHARP; ++type)
+  {
+    g_ActiveConfig.iTexScalingType = type;
+    for (int threads : thread_counts)
+    {
+      TextureScaler scaler;
+      scaler.SetMaxThreads(threads);
+      std::vector<u32> input(texture);
+      auto start = std::chrono::steady_clock::now();
+      for (int i = 0; i < iterations; ++i)
+        scaler.Scale(input.data(), width, height);
+      std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+      printf("%-14s x%d threads %2d: %8.2f MPix/s\n", s_filter_names[type], factor, threads,
+             (double)width * height * iterations / (elapsed.count() * 1000 * 1000));
+    }
+  }
+}